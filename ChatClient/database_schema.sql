@@ -46,3 +46,8 @@ ALTER TABLE user ADD COLUMN IF NOT EXISTS desc TEXT;
 -- (4, 1),
 -- (1, 5),
 -- (5, 1);
+
+-- 4. 聊天消息表增加服务端消息 ID（ChatServer 的 MsgIdGenerator 生成）
+-- 注意：主键 id 仍为自增列，离线消息分页和确认都按 id；msg_id 只用于识别重复写入
+ALTER TABLE messages ADD COLUMN IF NOT EXISTS msg_id BIGINT NULL DEFAULT NULL;
+ALTER TABLE messages ADD UNIQUE INDEX IF NOT EXISTS uk_msg_id (msg_id);
@@ -45,7 +45,8 @@ enum ReqId{
     // 新增：好友回复结果通知（TCP 下发给发起方）
     ID_NOTIFY_FRIEND_REPLY = 1022,
     ID_GET_OFFLINE_MSG_REQ = 1023,
-    ID_NOTIFY_TEXT_CHAT_MSG_RSP = 1024 // 客户端确认收到通知 (ACK)
+    ID_NOTIFY_TEXT_CHAT_MSG_RSP = 1024, // 客户端确认收到通知 (ACK)
+    ID_NOTIFY_OFFLINE_MSG_BATCH = 1027  // 离线消息批量下发（多条一帧）
 };
 
 enum Modules{
@@ -374,6 +374,50 @@ void TcpMgr::initHandlers()
         // 仍然保留通过 sig_recv_pkg 的整包派发（已在上层监听）
     });
 
+    // 离线消息批量下发（1027）：{error, last_id, more, inbox_id, msgs:[同 1019 的消息体...]}
+    // 来自服务端 Redis 收件箱的帧带 inbox_id（last_id 为 0），来自数据库的帧带 last_id
+    _handlers.insert(ID_NOTIFY_OFFLINE_MSG_BATCH, [this](ReqId id, int len, QByteArray data) {
+        Q_UNUSED(id);
+        Q_UNUSED(len);
+
+        QJsonParseError jerr;
+        QJsonDocument doc = QJsonDocument::fromJson(data, &jerr);
+        if (jerr.error != QJsonParseError::NoError || !doc.isObject()) {
+            qDebug() << "[OfflineMsg] parse batch failed:" << jerr.errorString();
+            return;
+        }
+        auto obj = doc.object();
+        if (obj.value("error").toInt(-1) != ErrorCodes::SUCCESS) {
+            qDebug() << "[OfflineMsg] batch error code=" << obj.value("error").toInt(-1);
+            return;
+        }
+        auto msgs = obj.value("msgs").toArray();
+        qint64 lastId = obj.value("last_id").toVariant().toLongLong();
+        qDebug() << "[OfflineMsg] batch msgs=" << msgs.size() << " last_id=" << lastId
+                 << " more=" << obj.value("more").toBool();
+        for (const auto& m : msgs) {
+            auto msgObj = m.toObject();
+            int fromuid = msgObj.value("fromuid").toInt();
+            int touid = msgObj.value("touid").toInt();
+            for (const auto& v : msgObj.value("text_array").toArray()) {
+                auto o = v.toObject();
+                emit sig_text_notify(fromuid, touid, o.value("msgid").toString(), o.value("content").toString());
+            }
+        }
+        if (msgs.isEmpty()) {
+            return;
+        }
+        // 原样回传本帧的 last_id / inbox_id：服务端把 id <= last_id 的未读消息标记为已读，收件箱删到 inbox_id
+        QJsonObject ackRoot;
+        ackRoot["uid"] = UserMgr::GetInstance()->GetUid();
+        ackRoot["max_msg_id"] = lastId;
+        if (obj.contains("inbox_id")) {
+            ackRoot["inbox_id"] = obj.value("inbox_id").toString();
+        }
+        QString ackJson = QString::fromUtf8(QJsonDocument(ackRoot).toJson(QJsonDocument::Compact));
+        emit sig_send_data(ReqId::ID_NOTIFY_TEXT_CHAT_MSG_RSP, ackJson);
+    });
+
 }
 
 void TcpMgr::slot_tcp_connect(ServerInfo si)
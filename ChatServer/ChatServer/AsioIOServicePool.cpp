@@ -1,44 +1,236 @@
 #include "AsioIOServicePool.h"
+#include <algorithm>
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include "ConfigMgr.h"
+#include "Logger.h"
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 using namespace std;
-AsioIOServicePool::AsioIOServicePool(std::size_t size) :_ioServices(size),
-_works(size), _nextIOService(0) {
-    for (std::size_t i = 0; i < size; ++i) {
-        _works[i] = std::unique_ptr<Work>(new Work(_ioServices[i].get_executor()));
-        std::cout << "AsioIOServicePool: created work for io[" << i << "]\n";
+
+namespace {
+
+// 解析 "0-3,8,10-11" 形式的 CPU 列表（与 /sys/devices/system/node/nodeN/cpulist 格式相同）
+std::vector<int> ParseCpuList(const std::string& list) {
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.find_first_not_of(" \t\r\n") == std::string::npos) {
+            continue;
+        }
+        try {
+            std::size_t dash = item.find('-');
+            int first = std::stoi(item.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        }
+        catch (const std::exception&) {
+            LOG_WARN << "[IOPool] invalid cpu list item: " << item;
+        }
+    }
+    return cpus;
+}
+
+// 每个 NUMA 节点上的 CPU（读 sysfs；非 Linux 或没有 NUMA 信息时返回空）
+std::vector<std::vector<int>> NumaNodeCpus() {
+    std::vector<std::vector<int>> nodes;
+    for (int node = 0;; ++node) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!file) {
+            break;
+        }
+        std::string line;
+        std::getline(file, line);
+        nodes.push_back(ParseCpuList(line));
     }
+    return nodes;
+}
+
+// 把当前线程绑定到一个 CPU 上
+bool PinCurrentThread(int cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+} // namespace
+
+// 构造 IO 线程池
+//
+// 实现逻辑：
+//   1. [IOPool] ThreadCount 为 IO 线程数，不配置或为 0 时使用 CPU 核数
+//   2. [IOPool] PinThreads = true 时每个线程绑定一个 CPU，CpuList 可指定 CPU 列表（如 0-7,16-23），
+//      不指定时按 NUMA 节点交替选取进程可用的 CPU
+//   3. 每个线程绑核后自己创建 io_context、work 和负载计数（Linux 默认首次访问分配，内存在本节点上），
+//      全部线程就绪后构造函数才返回，之后 GetIOService 可以安全使用
+AsioIOServicePool::AsioIOServicePool() : _nextIOService(0) {
+    auto& cfg = ConfigMgr::Inst();
+    std::size_t size = std::thread::hardware_concurrency();
+    std::string count_str = cfg["IOPool"]["ThreadCount"];
+    if (!count_str.empty()) {
+        try {
+            std::size_t count = std::stoul(count_str);
+            if (count > 0) {
+                size = count;
+            }
+        }
+        catch (const std::exception&) {
+            LOG_WARN << "[IOPool] invalid ThreadCount: " << count_str;
+        }
+    }
+    if (size == 0) {
+        size = 1;
+    }
+
+    std::vector<int> cpus(size, -1);
+    if (cfg["IOPool"]["PinThreads"] == "true") {
+        cpus = AssignCpus(size, cfg["IOPool"]["CpuList"]);
+    }
+
+    _ioServices.resize(size);
+    _works.resize(size);
+    _stats.resize(size);
 
     //�������ioservice����������̣߳�ÿ���߳��ڲ�����ioservice
-    for (std::size_t i = 0; i < _ioServices.size(); ++i) {
-        _threads.emplace_back([this, i]() {
-            std::cout << "thread " << i << " start run()\n";
-            _ioServices[i].run();
-            std::cout << "thread " << i << " exit run()\n";
+    std::vector<std::promise<void>> ready(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        _threads.emplace_back([this, i, cpu = cpus[i], &ready]() {
+            RunThread(i, cpu, ready[i]);
             });
     }
-    std::cout << "AsioIOServicePool started " << _threads.size() << " threads\n";
+    for (auto& r : ready) {
+        r.get_future().wait();
+    }
+    LOG_INFO << "[IOPool] started " << _threads.size() << " threads";
+}
+
+std::vector<int> AsioIOServicePool::AssignCpus(std::size_t threads, const std::string& cpu_list) {
+    std::vector<int> order;
+    if (!cpu_list.empty()) {
+        order = ParseCpuList(cpu_list);
+    }
+    else {
+#ifdef __linux__
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        sched_getaffinity(0, sizeof(allowed), &allowed);
+        std::vector<std::vector<int>> nodes = NumaNodeCpus();
+        if (nodes.empty()) {
+            nodes.emplace_back();
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                nodes[0].push_back(cpu);
+            }
+        }
+        // 只保留进程可用的 CPU（taskset / cgroup 限制），然后各节点轮流取一个
+        for (auto& node : nodes) {
+            std::vector<int> usable;
+            for (int cpu : node) {
+                if (cpu >= 0 && cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) {
+                    usable.push_back(cpu);
+                }
+            }
+            node.swap(usable);
+        }
+        std::size_t widest = 0;
+        for (const auto& node : nodes) {
+            widest = std::max(widest, node.size());
+        }
+        for (std::size_t k = 0; k < widest; ++k) {
+            for (const auto& node : nodes) {
+                if (k < node.size()) {
+                    order.push_back(node[k]);
+                }
+            }
+        }
+#endif
+    }
+
+    std::vector<int> cpus(threads, -1);
+    if (order.empty()) {
+        LOG_WARN << "[IOPool] PinThreads is set but no usable cpu was found, threads are not pinned";
+        return cpus;
+    }
+    // 线程数多于 CPU 时循环复用
+    for (std::size_t i = 0; i < threads; ++i) {
+        cpus[i] = order[i % order.size()];
+    }
+    return cpus;
+}
+
+void AsioIOServicePool::RunThread(std::size_t index, int cpu, std::promise<void>& ready) {
+    if (cpu >= 0 && !PinCurrentThread(cpu)) {
+        LOG_WARN << "[IOPool] failed to pin io[" << index << "] to cpu " << cpu;
+    }
+    // 每个 io_context 只由这一个线程 run()，并发提示为 1
+    _ioServices[index].reset(new IOService(1));
+    _stats[index].reset(new IOContextStats());
+    _works[index].reset(new Work(_ioServices[index]->get_executor()));
+    LOG_INFO << "[IOPool] io[" << index << "] running" << (cpu >= 0 ? " on cpu " + std::to_string(cpu) : "");
+    IOService& io_context = *_ioServices[index];
+    ready.set_value();
+
+    io_context.run();
+    LOG_INFO << "[IOPool] io[" << index << "] exit run()";
 }
 
 AsioIOServicePool::~AsioIOServicePool() {
     Stop();
-    std::cout << "AsioIOServicePool destruct" << std::endl;
+    LOG_INFO << "[IOPool] destruct";
 }
 
 boost::asio::io_context& AsioIOServicePool::GetIOService() {
-    auto idx = _nextIOService;
-    auto& service = _ioServices[_nextIOService++];
-    if (_nextIOService == _ioServices.size()) {
-        _nextIOService = 0;
+    return *_ioServices[NextIndex()];
+}
+
+std::size_t AsioIOServicePool::NextIndex() {
+    return _nextIOService.fetch_add(1, std::memory_order_relaxed) % _ioServices.size();
+}
+
+// 连接数最少的 io_context
+// 
+// 实现逻辑：
+//   逐个读取当前连接数取最小值，相同时取下标小的；计数是宽松读取，只作负载参考
+std::size_t AsioIOServicePool::LeastLoadedIndex() {
+    std::size_t best = 0;
+    uint64_t best_connections = _stats[0]->connections.load(std::memory_order_relaxed);
+    for (std::size_t i = 1; i < _ioServices.size(); ++i) {
+        uint64_t connections = _stats[i]->connections.load(std::memory_order_relaxed);
+        if (connections < best_connections) {
+            best = i;
+            best_connections = connections;
+        }
+    }
+    return best;
+}
+
+void AsioIOServicePool::LogStats() {
+    for (std::size_t i = 0; i < _ioServices.size(); ++i) {
+        LOG_INFO << "[IOPool] io[" << i << "] connections=" << _stats[i]->connections.load(std::memory_order_relaxed)
+            << " accepted=" << _stats[i]->accepted.load(std::memory_order_relaxed)
+            << " events=" << _stats[i]->events.load(std::memory_order_relaxed);
     }
-    std::cout << "GetIOService -> idx=" << idx << "\n";
-    return service;
 }
 
 void AsioIOServicePool::Stop() {
     //��Ϊ����ִ��work.reset��������iocontext��run��״̬���˳�
     //��iocontext�Ѿ����˶���д�ļ����¼��󣬻���Ҫ�ֶ�stop�÷���
-    std::cout << "AsioIOServicePool::Stop() called\n";
+    LOG_INFO << "[IOPool] Stop() called";
     for (auto& work : _works) {
+        if (!work) {
+            continue;
+        }
         //�ѷ�����ֹͣ
         auto& io_context = boost::asio::query(
             work->get_executor(),
@@ -50,7 +242,9 @@ void AsioIOServicePool::Stop() {
     }
 
     for (auto& t : _threads) {
-        t.join();
+        if (t.joinable()) {
+            t.join();
+        }
     }
-    std::cout << "AsioIOServicePool::Stop() finished\n";
+    LOG_INFO << "[IOPool] Stop() finished";
 }
\ No newline at end of file
@@ -1,6 +1,19 @@
 #include <vector>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <future>
+#include <thread>
 #include <boost/asio.hpp>
 #include "Singleton.h"
+
+// 单个 io_context 的负载计数（按缓存行对齐，各 IO 线程更新自己的计数互不干扰）
+struct alignas(64) IOContextStats {
+    std::atomic<uint64_t> connections{ 0 };  // 当前连接数
+    std::atomic<uint64_t> accepted{ 0 };     // 累计接入的连接数
+    std::atomic<uint64_t> events{ 0 };       // 累计处理的读写完成事件数
+};
+
 class AsioIOServicePool :public Singleton<AsioIOServicePool>
 {
     friend Singleton<AsioIOServicePool>;
@@ -11,14 +24,32 @@ public:
     ~AsioIOServicePool();
     AsioIOServicePool(const AsioIOServicePool&) = delete;
     AsioIOServicePool& operator=(const AsioIOServicePool&) = delete;
-    // 使用 round-robin 的方式返回一个 io_service
+    // 使用 round-robin 的方式返回一个 io_service（线程安全）
     boost::asio::io_context& GetIOService();
+    // 按下标取 io_context 及其负载计数，下标范围 [0, Size())
+    boost::asio::io_context& GetIOService(std::size_t index) { return *_ioServices[index]; }
+    IOContextStats& GetStats(std::size_t index) { return *_stats[index]; }
+    std::size_t Size() const { return _ioServices.size(); }
+    // 下一个 round-robin 下标
+    std::size_t NextIndex();
+    // 当前连接数最少的 io_context 下标
+    std::size_t LeastLoadedIndex();
+    // 输出每个 io_context 的连接数和事件数
+    void LogStats();
     void Stop();
 private:
-    AsioIOServicePool(std::size_t size = std::thread::hardware_concurrency());
-    std::vector<IOService> _ioServices;
+    // 线程数、是否绑核、绑到哪些 CPU 从 [IOPool] 读取
+    AsioIOServicePool();
+    // 在第 index 个 IO 线程上执行：绑核后创建该线程的 io_context、work 和负载计数，然后 run()
+    void RunThread(std::size_t index, int cpu, std::promise<void>& ready);
+    // 为每个 IO 线程选定 CPU（-1 表示不绑核）
+    static std::vector<int> AssignCpus(std::size_t threads, const std::string& cpu_list);
+
+    // io_context / 负载计数由各自的 IO 线程在绑核之后分配，内存落在该线程所在的 NUMA 节点上
+    std::vector<std::unique_ptr<IOService>> _ioServices;
     std::vector<WorkPtr> _works;
     std::vector<std::thread> _threads;
-    std::size_t _nextIOService;
+    std::vector<std::unique_ptr<IOContextStats>> _stats;
+    std::atomic<std::size_t> _nextIOService;
 };
 
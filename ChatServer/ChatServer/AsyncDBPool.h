@@ -1,117 +1,129 @@
 #pragma once
-#include <queue>
 #include <thread>
 #include <mutex>
-#include <condition_variable>
-#include <functional>
-#include <vector>
-#include <atomic>
 #include <memory>
-#include <iostream>
+#include <algorithm>
+#include <string>
 #include "Singleton.h"
+#include "ConfigMgr.h"
+#include "TaskExecutor.h"
+
+// 默认排队上限：按每个任务约 1KB 估算，约 100MB
+#define ASYNC_DB_QUEUE_CAPACITY 100000
+
+// Block 策略下投递方默认最长等待时间（毫秒）
+#define ASYNC_DB_BLOCK_TIMEOUT_MS 50
 
 // 异步数据库线程池
 // 
 // 作用：
 //   将耗时的数据库操作从主逻辑线程分离，避免阻塞网络IO和业务处理。
-//   采用生产者-消费者模型，主线程生产任务，后台线程池消费任务。
+//   任务由 TaskExecutor 执行（每线程一个队列 + 工作窃取），投递的 lambda 不超过 48 字节时不分配内存。
+//   排队数有上限（[AsyncDB] QueueCapacity），MySQL 变慢时按 [AsyncDB] Overflow 反压或拒绝，
+//   而不是无限堆积直到内存耗尽；ack、拉取离线消息走 High 车道，不排在普通任务后面。
+//   聊天消息入库不走这里，由 ChatMsgWriter 攒批写入。
 //
 // 使用方式：
-//   AsyncDBPool::GetInstance()->PostTask([=](){
+//   bool accepted = AsyncDBPool::GetInstance()->PostTask([=](){
 //       // 执行数据库操作
 //       MysqlMgr::GetInstance()->Query(...);
-//   });
+//   }, TaskPriority::High);
+//   // accepted 为 false 时任务不会执行，调用方需要处理（回错误码 / 让客户端重试）
 class AsyncDBPool : public Singleton<AsyncDBPool> {
     friend class Singleton<AsyncDBPool>;
 public:
-    // 定义任务类型：无参无返回值的函数对象（通常使用Lambda表达式封装）
-    using Task = std::function<void()>;
-
     // 初始化线程池
     // 参数：
-    //   threadNum: 线程池中的工作线程数量，默认为 hardware_concurrency()
+    //   threadNum: 线程池中的工作线程数量，<= 0 时为 max(4, hardware_concurrency())
     // 注意：
-    //   必须在系统启动时调用一次
+    //   必须在系统启动时调用一次，重复调用不生效。
+    //   队列上限和溢出策略读取 [AsyncDB] QueueCapacity / Overflow(block|reject|shed_low) / BlockTimeoutMs
     void Init(int threadNum = -1) {
         // 如果threadNum为-1，则使用CPU核心数
         if (threadNum <= 0) {
             threadNum = std::max(4, (int)std::thread::hardware_concurrency());
         }
-        if (b_stop_) return; // 避免重复初始化
-        
-        for (int i = 0; i < threadNum; ++i) {
-            threads_.emplace_back([this] {
-                while (true) {
-                    Task task;
-                    {
-                        // 获取互斥锁，访问任务队列
-                        std::unique_lock<std::mutex> lock(mutex_);
-                        
-                        // 等待条件满足：停止运行 或 队列不为空
-                        cond_.wait(lock, [this] { return b_stop_ || !tasks_.empty(); });
-                        
-                        // 如果收到停止信号且队列已空，则退出线程
-                        if (b_stop_ && tasks_.empty()) return;
-                        
-                        // 取出任务
-                        task = std::move(tasks_.front());
-                        tasks_.pop();
-                    }
-                    
-                    // 执行任务（捕获异常防止线程崩溃）
-                    try {
-                        task();
-                    } catch (const std::exception& e) {
-                        std::cerr << "[AsyncDBPool] Task exception: " << e.what() << std::endl;
-                    } catch (...) {
-                        std::cerr << "[AsyncDBPool] Task unknown exception" << std::endl;
-                    }
-                }
-            });
+        std::lock_guard<std::mutex> lock(init_mutex_);
+        if (executor_) return; // 避免重复初始化
+
+        auto& cfg = ConfigMgr::Inst();
+        std::size_t capacity = ReadNumber(cfg["AsyncDB"]["QueueCapacity"], ASYNC_DB_QUEUE_CAPACITY);
+        int block_timeout_ms = static_cast<int>(ReadNumber(cfg["AsyncDB"]["BlockTimeoutMs"], ASYNC_DB_BLOCK_TIMEOUT_MS));
+        OverflowPolicy overflow = OverflowPolicy::Block;
+        std::string overflow_str = cfg["AsyncDB"]["Overflow"];
+        if (overflow_str == "reject") {
+            overflow = OverflowPolicy::Reject;
+        }
+        else if (overflow_str == "shed_low") {
+            overflow = OverflowPolicy::ShedLow;
         }
+        else if (!overflow_str.empty() && overflow_str != "block") {
+            LOG_WARN << "[AsyncDBPool] unknown Overflow: " << overflow_str << ", use block";
+        }
+
+        executor_.reset(new TaskExecutor(threadNum, "AsyncDBPool", capacity, overflow, block_timeout_ms));
+        LOG_INFO << "[AsyncDBPool] started " << threadNum << " threads, capacity=" << capacity
+            << " overflow=" << (overflow_str.empty() ? "block" : overflow_str);
     }
 
-    // 停止线程池
-    // 作用：
-    //   1. 设置停止标志
-    //   2. 唤醒所有等待中的线程
-    //   3. 等待所有线程安全退出
+    // 停止线程池：已投递的任务执行完后回收线程
     // 注意：
     //   通常在程序退出或析构时调用
     void Stop() {
-        {
-            std::unique_lock<std::mutex> lock(mutex_);
-            b_stop_ = true;
-        }
-        cond_.notify_all();
-        for (auto& t : threads_) {
-            if (t.joinable()) t.join();
+        if (executor_) {
+            executor_->Stop();
         }
     }
 
     // 投递任务
     // 参数：
-    //   task: 要执行的函数对象或Lambda
+    //   task: 要执行的函数对象或Lambda（可以只可移动）
+    //   priority: 车道，ack / 拉取离线消息用 High，其他读写用 Normal，可丢弃的任务用 Low
+    // 返回值：
+    //   队列满被拒绝（Block 策略下等待超时）或线程池未运行时返回 false，任务不会执行
     // 线程安全：
     //   该函数是线程安全的，可以从任意线程调用
-    void PostTask(Task task) {
-        {
-            std::unique_lock<std::mutex> lock(mutex_);
-            tasks_.push(std::move(task));
+    template <typename F>
+    bool PostTask(F&& task, TaskPriority priority = TaskPriority::Normal) {
+        if (!executor_) {
+            LOG_ERROR << "[AsyncDBPool] pool not running, task dropped";
+            return false;
+        }
+        return executor_->Post(SmallTask(std::forward<F>(task)), priority);
+    }
+
+    // 排队数、排队时间等监控数据
+    TaskExecutor::Stats GetStats() {
+        return executor_ ? executor_->Snapshot() : TaskExecutor::Stats();
+    }
+
+    // 输出一行监控日志（由 CServer 的统计定时器调用）
+    void LogStats() {
+        if (executor_) {
+            executor_->LogStats();
         }
-        cond_.notify_one(); // 唤醒一个工作线程来处理
     }
 
 private:
-    AsyncDBPool() : b_stop_(false) {}
+    AsyncDBPool() {}
+
+    static std::size_t ReadNumber(const std::string& value, std::size_t fallback) {
+        if (value.empty()) {
+            return fallback;
+        }
+        try {
+            return std::stoul(value);
+        }
+        catch (const std::exception&) {
+            LOG_WARN << "[AsyncDBPool] invalid number in [AsyncDB]: " << value;
+            return fallback;
+        }
+    }
     ~AsyncDBPool() { Stop(); }
 
     AsyncDBPool(const AsyncDBPool&) = delete;
     AsyncDBPool& operator=(const AsyncDBPool&) = delete;
 
-    std::vector<std::thread> threads_;  // 线程容器
-    std::queue<Task> tasks_;            // 任务队列
-    std::mutex mutex_;                  // 互斥锁，保护任务队列
-    std::condition_variable cond_;      // 条件变量，用于线程同步
-    std::atomic<bool> b_stop_;          // 停止标志
+    std::mutex init_mutex_;
+    std::unique_ptr<TaskExecutor> executor_;  // Init 之后不再改变
 };
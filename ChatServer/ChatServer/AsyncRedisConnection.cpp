@@ -0,0 +1,328 @@
+#include "AsyncRedisConnection.h"
+#include <exception>
+#include "Logger.h"
+
+AsyncRedisConnection::AsyncRedisConnection(boost::asio::io_context& io_context, std::string host,
+	unsigned short port, std::string password)
+	: _io_context(io_context), _socket(io_context), _resolver(io_context), _reconnect_timer(io_context),
+	_host(std::move(host)), _port(port), _password(std::move(password)),
+	_connected(false), _broken(false), _writing(false), _closed(false)
+{
+	ResetOutput();
+}
+
+void AsyncRedisConnection::Start()
+{
+	auto self = shared_from_this();
+	boost::asio::post(_io_context, [self]() { self->DoConnect(); });
+}
+
+// 关闭连接
+//
+// 实现逻辑：
+//   先在锁内置 _closed，之后的 Submit 立即以错误回调；
+//   真正的 socket 关闭和未完成命令的失败回调在 IO 线程中完成
+void AsyncRedisConnection::Close()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_closed) {
+			return;
+		}
+		_closed = true;
+	}
+	auto self = shared_from_this();
+	boost::asio::post(_io_context, [self]() {
+		self->_reconnect_timer.cancel();
+		self->_resolver.cancel();
+		self->HandleError("closed");
+		});
+}
+
+// 提交一条命令
+//
+// 实现逻辑：
+//   1. 锁内编码追加到 _out，回调入队 _pending
+//   2. 已连接且没有写在进行时投递一次 Flush，否则由正在进行的写完成后顺带写出
+//   3. 连接已关闭、断线重连中或积压超过 ASYNC_REDIS_MAX_PENDING 时，在调用线程上直接以错误回调
+void AsyncRedisConnection::Submit(const std::vector<std::string>& args, RedisCallback callback)
+{
+	bool kick = false;
+	bool rejected = false;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_closed || _broken || _pending.size() >= ASYNC_REDIS_MAX_PENDING) {
+			rejected = true;
+		}
+		else {
+			RespAppendCommand(_out, args);
+			_pending.push_back(std::move(callback));
+			if (_connected && !_writing) {
+				_writing = true;
+				kick = true;
+			}
+		}
+	}
+
+	if (rejected) {
+		if (callback) {
+			callback(RedisValue::MakeError("ERR redis connection unavailable"));
+		}
+		return;
+	}
+	if (kick) {
+		auto self = shared_from_this();
+		boost::asio::post(_io_context, [self]() { self->Flush(); });
+	}
+}
+
+// 提交多条命令：在同一把锁内编码，保证它们在发送缓冲区中连续、回调连续
+void AsyncRedisConnection::SubmitBatch(const std::vector<std::vector<std::string>>& commands,
+	std::vector<RedisCallback> callbacks)
+{
+	bool kick = false;
+	bool rejected = false;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_closed || _broken || _pending.size() + commands.size() > ASYNC_REDIS_MAX_PENDING) {
+			rejected = true;
+		}
+		else {
+			for (std::size_t i = 0; i < commands.size(); ++i) {
+				RespAppendCommand(_out, commands[i]);
+				_pending.push_back(std::move(callbacks[i]));
+			}
+			if (_connected && !_writing) {
+				_writing = true;
+				kick = true;
+			}
+		}
+	}
+
+	if (rejected) {
+		for (auto& callback : callbacks) {
+			if (callback) {
+				callback(RedisValue::MakeError("ERR redis connection unavailable"));
+			}
+		}
+		return;
+	}
+	if (kick) {
+		auto self = shared_from_this();
+		boost::asio::post(_io_context, [self]() { self->Flush(); });
+	}
+}
+
+std::size_t AsyncRedisConnection::Pending()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _pending.size();
+}
+
+void AsyncRedisConnection::DoConnect()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_closed) {
+			return;
+		}
+	}
+
+	auto self = shared_from_this();
+	_resolver.async_resolve(_host, std::to_string(_port),
+		[self](const boost::system::error_code& ec, boost::asio::ip::tcp::resolver::results_type results) {
+			if (ec) {
+				if (ec != boost::asio::error::operation_aborted) {
+					self->HandleError("resolve failed: " + ec.message());
+				}
+				return;
+			}
+			boost::asio::async_connect(self->_socket, results,
+				[self](const boost::system::error_code& ec, const boost::asio::ip::tcp::endpoint&) {
+					if (ec) {
+						if (ec != boost::asio::error::operation_aborted) {
+							self->HandleError("connect failed: " + ec.message());
+						}
+						return;
+					}
+					boost::system::error_code ignored;
+					self->_socket.set_option(boost::asio::ip::tcp::no_delay(true), ignored);
+					{
+						std::lock_guard<std::mutex> lock(self->_mutex);
+						self->_connected = true;
+						self->_broken = false;
+						self->_writing = true;
+					}
+					LOG_INFO << "[AsyncRedis] connected to " << self->_host << ":" << self->_port;
+					self->DoRead();
+					self->Flush();
+				});
+		});
+}
+
+// 写出积攒的命令（只在 IO 线程执行）
+//
+// 实现逻辑：
+//   把 _out 整体 swap 到 _writing_buf 后解锁写出，写期间新命令继续追加到 _out；
+//   没有数据可写时清除 _writing，下一条 Submit 会重新投递 Flush
+void AsyncRedisConnection::Flush()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	if (!_connected || _out.empty()) {
+		_writing = false;
+		return;
+	}
+	_writing_buf.clear();
+	_writing_buf.swap(_out);
+	lock.unlock();
+
+	auto self = shared_from_this();
+	boost::asio::async_write(_socket, boost::asio::buffer(_writing_buf),
+		[self](const boost::system::error_code& ec, std::size_t) {
+			self->HandleWrite(ec);
+		});
+}
+
+void AsyncRedisConnection::HandleWrite(const boost::system::error_code& ec)
+{
+	if (ec) {
+		// operation_aborted 只会由我们自己关闭 socket 引起，错误已经处理过
+		if (ec != boost::asio::error::operation_aborted) {
+			HandleError("write failed: " + ec.message());
+		}
+		return;
+	}
+	Flush();
+}
+
+void AsyncRedisConnection::DoRead()
+{
+	auto self = shared_from_this();
+	_socket.async_read_some(boost::asio::buffer(_read_buf),
+		[self](const boost::system::error_code& ec, std::size_t bytes_transferred) {
+			self->HandleRead(ec, bytes_transferred);
+		});
+}
+
+// 处理读到的数据
+//
+// 实现逻辑：
+//   Redis 对同一连接上的命令按序回复，所以每解析出一个完整回复就对应 _pending 的队首回调。
+//   回调在锁外执行，回调中可以继续 Submit 新命令
+void AsyncRedisConnection::HandleRead(const boost::system::error_code& ec, std::size_t bytes_transferred)
+{
+	if (ec) {
+		if (ec != boost::asio::error::operation_aborted) {
+			HandleError("read failed: " + ec.message());
+		}
+		return;
+	}
+
+	_parser.Feed(_read_buf.data(), bytes_transferred);
+	for (;;) {
+		RedisValue value;
+		RespParser::Result result = _parser.Next(value);
+		if (result == RespParser::Result::NeedMore) {
+			break;
+		}
+		if (result == RespParser::Result::Error) {
+			HandleError("protocol error");
+			return;
+		}
+
+		RedisCallback callback;
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_pending.empty()) {
+				callback = nullptr;
+			}
+			else {
+				callback = std::move(_pending.front());
+				_pending.pop_front();
+			}
+		}
+		if (!callback) {
+			continue;
+		}
+		try {
+			callback(std::move(value));
+		}
+		catch (const std::exception& e) {
+			LOG_ERROR << "[AsyncRedis] callback exception: " << e.what();
+		}
+	}
+
+	DoRead();
+}
+
+// 连接出错
+//
+// 实现逻辑：
+//   1. 锁内标记断开，取出所有未完成回调，重置发送缓冲区（只保留 AUTH）
+//   2. 关闭 socket，清空解析器
+//   3. 在锁外以 Error 回调所有未完成命令
+//   4. 未关闭时 ASYNC_REDIS_RECONNECT_MS 毫秒后重连；重连期间新命令快速失败
+void AsyncRedisConnection::HandleError(const std::string& reason)
+{
+	std::deque<RedisCallback> failed;
+	bool closed = false;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_connected = false;
+		_broken = true;
+		_writing = false;
+		failed.swap(_pending);
+		ResetOutput();
+		closed = _closed;
+	}
+
+	boost::system::error_code ignored;
+	_socket.close(ignored);
+	_parser.Reset();
+
+	if (closed) {
+		LOG_INFO << "[AsyncRedis] " << _host << ":" << _port << " closed, failing "
+			<< failed.size() << " pending commands";
+	}
+	else {
+		LOG_WARN << "[AsyncRedis] " << _host << ":" << _port << " " << reason
+			<< ", failing " << failed.size() << " pending commands";
+	}
+	for (auto& callback : failed) {
+		if (!callback) {
+			continue;
+		}
+		try {
+			callback(RedisValue::MakeError("ERR redis connection lost: " + reason));
+		}
+		catch (const std::exception& e) {
+			LOG_ERROR << "[AsyncRedis] callback exception: " << e.what();
+		}
+	}
+
+	if (closed) {
+		return;
+	}
+	auto self = shared_from_this();
+	_reconnect_timer.expires_after(std::chrono::milliseconds(ASYNC_REDIS_RECONNECT_MS));
+	_reconnect_timer.async_wait([self](const boost::system::error_code& ec) {
+		if (!ec) {
+			self->DoConnect();
+		}
+		});
+}
+
+// 重置发送缓冲区：配置了密码时，连接建立后的第一条命令总是 AUTH
+void AsyncRedisConnection::ResetOutput()
+{
+	_out.clear();
+	if (_password.empty()) {
+		return;
+	}
+	RespAppendCommand(_out, std::vector<std::string>{ "AUTH", _password });
+	_pending.push_back([](RedisValue reply) {
+		if (reply.IsError()) {
+			LOG_WARN << "[AsyncRedis] AUTH failed: " << reply.str;
+		}
+		});
+}
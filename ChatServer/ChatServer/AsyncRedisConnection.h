@@ -0,0 +1,88 @@
+#pragma once
+#include <array>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <boost/asio.hpp>
+#include "RespCodec.h"
+
+// 单条连接读缓冲区大小
+#define ASYNC_REDIS_READ_BUFFER (16 * 1024)
+// 单条连接允许排队 + 在途的最大命令数，超过时新命令直接以错误回调（快速失败，不阻塞调用方）
+#define ASYNC_REDIS_MAX_PENDING 65536
+// 断线后重连间隔（毫秒）
+#define ASYNC_REDIS_RECONNECT_MS 1000
+
+// 命令完成回调：在连接所属的 IO 线程上执行，不能阻塞；
+// 需要做阻塞操作（MySQL 等）时应投递回 LogicSystem 工作线程
+typedef std::function<void(RedisValue)> RedisCallback;
+
+// AsyncRedisConnection：一条由 Asio 驱动的 Redis 连接
+//
+// 作用：
+//   替代 RedisConPool 中"借连接 -> 阻塞等回复 -> 还连接"的模式，一条连接上可以有任意多条在途命令
+//
+// 实现逻辑：
+//   1. Submit 可在任意线程调用：锁内把命令编码追加到发送缓冲区，回调按顺序进入 _pending 队列
+//   2. 当前没有写在进行时才向 io_context 投递一次 Flush；写期间到达的命令积攒在缓冲区里，
+//      上一次写完成后一起写出，天然形成 pipeline
+//   3. 读循环持续 async_read_some，RespParser 每解析出一个回复就弹出队首回调（Redis 按序回复）
+//   4. 连接出错时所有未完成命令以 Error 回调，然后定时重连；重连后先发 AUTH
+class AsyncRedisConnection : public std::enable_shared_from_this<AsyncRedisConnection>
+{
+public:
+	AsyncRedisConnection(boost::asio::io_context& io_context, std::string host, unsigned short port,
+		std::string password);
+
+	// 开始连接（只调用一次）
+	void Start();
+
+	// 关闭连接，未完成的命令以 Error 回调
+	void Close();
+
+	// 提交一条命令
+	// 参数：
+	//   - args: 命令及参数，如 {"HGET", key, field}
+	//   - callback: 回复回调（可为空，表示不关心结果）
+	void Submit(const std::vector<std::string>& args, RedisCallback callback);
+
+	// 提交多条命令，保证在同一次写中连续发出，回调按命令顺序依次执行
+	void SubmitBatch(const std::vector<std::vector<std::string>>& commands, std::vector<RedisCallback> callbacks);
+
+	// 排队 + 在途的命令数
+	std::size_t Pending();
+
+private:
+	void DoConnect();
+	void Flush();
+	void HandleWrite(const boost::system::error_code& ec);
+	void DoRead();
+	void HandleRead(const boost::system::error_code& ec, std::size_t bytes_transferred);
+	// 连接出错：失败所有未完成命令并安排重连
+	void HandleError(const std::string& reason);
+	// 重置发送缓冲区，如配置了密码则放入 AUTH（锁内调用）
+	void ResetOutput();
+
+	boost::asio::io_context& _io_context;
+	boost::asio::ip::tcp::socket _socket;
+	boost::asio::ip::tcp::resolver _resolver;
+	boost::asio::steady_timer _reconnect_timer;
+	std::string _host;
+	unsigned short _port;
+	std::string _password;
+
+	std::mutex _mutex;                   // 保护下面的发送缓冲区和回调队列
+	std::string _out;                    // 尚未写出的命令（已编码）
+	std::deque<RedisCallback> _pending;  // 每条已提交命令一个回调，顺序与发送顺序一致
+	bool _connected;
+	bool _broken;                        // 出错后到重连成功之前为 true，期间新命令快速失败
+	bool _writing;                       // 有 async_write 在进行，或已投递 Flush
+	bool _closed;
+
+	std::string _writing_buf;            // 正在写出的数据（只在 IO 线程访问）
+	RespParser _parser;                  // 只在 IO 线程访问
+	std::array<char, ASYNC_REDIS_READ_BUFFER> _read_buf;
+};
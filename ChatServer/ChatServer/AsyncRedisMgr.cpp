@@ -0,0 +1,117 @@
+#include "AsyncRedisMgr.h"
+#include "AsioIOServicePool.h"
+#include "ConfigMgr.h"
+
+// 构造函数
+//
+// 实现逻辑：
+//   1. 读取 [Redis] Host/Port/Passwd，以及连接数 [Redis] AsyncConnections（缺省 2）
+//   2. 每条连接绑定 AsioIOServicePool 中的一个 io_context（轮询分配），并发起连接
+// 注意：
+//   应在 main 中启动 CServer 之前先构造本单例，连接在启动阶段就建立好
+AsyncRedisMgr::AsyncRedisMgr() : _next(0)
+{
+	auto& cfg = ConfigMgr::Inst();
+	std::string host = cfg["Redis"]["Host"];
+	std::string port_str = cfg["Redis"]["Port"];
+	std::string pwd = cfg["Redis"]["Passwd"];
+
+	unsigned short port = 6379;
+	std::size_t conn_count = 2;
+	try {
+		port = static_cast<unsigned short>(std::stoi(port_str));
+	}
+	catch (const std::exception&) {
+		LOG_WARN << "[AsyncRedisMgr] invalid Redis Port: " << port_str;
+	}
+	std::string count_str = cfg["Redis"]["AsyncConnections"];
+	if (!count_str.empty()) {
+		try {
+			conn_count = std::stoul(count_str);
+		}
+		catch (const std::exception&) {
+			LOG_WARN << "[AsyncRedisMgr] invalid AsyncConnections: " << count_str;
+		}
+	}
+	if (conn_count == 0) {
+		conn_count = 1;
+	}
+
+	auto pool = AsioIOServicePool::GetInstance();
+	for (std::size_t i = 0; i < conn_count; ++i) {
+		auto conn = std::make_shared<AsyncRedisConnection>(pool->GetIOService(), host, port, pwd);
+		conn->Start();
+		_connections.push_back(conn);
+	}
+	LOG_INFO << "[AsyncRedisMgr] " << conn_count << " pipelined connections to " << host << ":" << port;
+}
+
+AsyncRedisMgr::~AsyncRedisMgr()
+{
+	Close();
+}
+
+void AsyncRedisMgr::Command(const std::vector<std::string>& args, RedisCallback callback)
+{
+	NextConnection().Submit(args, std::move(callback));
+}
+
+std::future<RedisValue> AsyncRedisMgr::CommandFuture(const std::vector<std::string>& args)
+{
+	auto promise = std::make_shared<std::promise<RedisValue>>();
+	std::future<RedisValue> future = promise->get_future();
+	Command(args, [promise](RedisValue reply) {
+		promise->set_value(std::move(reply));
+		});
+	return future;
+}
+
+// 在同一连接上执行多条命令
+//
+// 实现逻辑：
+//   同一连接上的回调按提交顺序执行，最后一条命令的回调到达时所有回复都已就绪，
+//   此时把收集到的结果一次性交给调用者
+void AsyncRedisMgr::Pipeline(const std::vector<std::vector<std::string>>& commands,
+	std::function<void(std::vector<RedisValue>)> callback)
+{
+	if (commands.empty()) {
+		if (callback) {
+			callback({});
+		}
+		return;
+	}
+
+	struct PipelineState {
+		std::vector<RedisValue> replies;
+		std::function<void(std::vector<RedisValue>)> callback;
+	};
+	auto state = std::make_shared<PipelineState>();
+	state->replies.resize(commands.size());
+	state->callback = std::move(callback);
+
+	std::vector<RedisCallback> callbacks;
+	callbacks.reserve(commands.size());
+	for (std::size_t i = 0; i < commands.size(); ++i) {
+		bool last = (i + 1 == commands.size());
+		callbacks.emplace_back([state, i, last](RedisValue reply) {
+			state->replies[i] = std::move(reply);
+			if (last && state->callback) {
+				state->callback(std::move(state->replies));
+			}
+			});
+	}
+	NextConnection().SubmitBatch(commands, std::move(callbacks));
+}
+
+void AsyncRedisMgr::Close()
+{
+	for (auto& conn : _connections) {
+		conn->Close();
+	}
+}
+
+AsyncRedisConnection& AsyncRedisMgr::NextConnection()
+{
+	std::size_t idx = _next.fetch_add(1, std::memory_order_relaxed) % _connections.size();
+	return *_connections[idx];
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Singleton.h"
+#include "AsyncRedisConnection.h"
+
+// AsyncRedisMgr：异步 Redis 客户端
+//
+// 作用：
+//   在 AsioIOServicePool 的 io_context 上维护若干条 AsyncRedisConnection，
+//   对外提供回调和 future 两种接口，业务线程发出命令后不再被挂起等待回复
+//
+// 说明：
+//   - 连接数由 [Redis] AsyncConnections 指定，缺省为 2
+//   - 单条命令按轮询选择连接；需要保证相对顺序的多条命令请用 Pipeline（同一连接、同一次写）
+//   - 阻塞式的 RedisMgr 仍然保留，未迁移的调用点不受影响
+class AsyncRedisMgr : public Singleton<AsyncRedisMgr>
+{
+	friend class Singleton<AsyncRedisMgr>;
+public:
+	~AsyncRedisMgr();
+
+	// 执行单条命令，回复在 IO 线程回调
+	void Command(const std::vector<std::string>& args, RedisCallback callback);
+
+	// 执行单条命令，返回 future（适合在非 IO 线程中等待结果，如测试和启动流程）
+	std::future<RedisValue> CommandFuture(const std::vector<std::string>& args);
+
+	// 在同一连接上连续执行多条命令，全部回复到达后一次性回调（顺序与 commands 一致）
+	void Pipeline(const std::vector<std::vector<std::string>>& commands,
+		std::function<void(std::vector<RedisValue>)> callback);
+
+	void Close();
+
+private:
+	AsyncRedisMgr();
+
+	AsyncRedisConnection& NextConnection();
+
+	std::vector<std::shared_ptr<AsyncRedisConnection>> _connections;
+	std::atomic<std::size_t> _next;
+};
@@ -1,17 +1,21 @@
 #include "CServer.h"
 #include"AsioIOServicePool.h"
 #include "UserMgr.h"
+#include "RouteCache.h"
+#include "AsyncDBPool.h"
+#include "MysqlMgr.h"
+#include "ConfigMgr.h"
 
 // 构造函数：初始化TCP服务器
 // 
 // 实现逻辑：
 //   1. 保存IO上下文和端口
-//   2. 验证端口号
-//   3. 创建acceptor并绑定到指定端口
-//   4. 开始监听
-//   5. 开始异步接受连接
+//   2. 验证端口号，读取 [Server] ReusePort / AcceptBalance / IOStatsIntervalSec
+//   3. 创建acceptor并绑定到指定端口、开始监听（ReusePort 模式下每个 io_context 一个）
+//   4. 在每个acceptor上开始异步接受连接
 CServer::CServer(boost::asio::io_context& io_context, unsigned short port)
-    : _io_context(io_context), _port(port), _acceptor(io_context)
+    : _io_context(io_context), _port(port), _reuse_port(false), _least_loaded(true),
+    _stats_interval_sec(IO_STATS_INTERVAL_SEC), _stats_timer(io_context)
 {
     std::cout << "CServer ctor called with port: " << port << std::endl;
 
@@ -21,16 +25,34 @@ CServer::CServer(boost::asio::io_context& io_context, unsigned short port)
         throw std::runtime_error("Invalid port: 0");
     }
 
+    auto& cfg = ConfigMgr::Inst();
+    _reuse_port = cfg["Server"]["ReusePort"] == "true";
+    _least_loaded = cfg["Server"]["AcceptBalance"] != "round_robin";
+    std::string interval_str = cfg["Server"]["IOStatsIntervalSec"];
+    if (!interval_str.empty()) {
+        try {
+            _stats_interval_sec = std::stoi(interval_str);
+        }
+        catch (const std::exception&) {
+            LOG_WARN << "[CServer] invalid IOStatsIntervalSec: " << interval_str;
+        }
+    }
+#ifndef SO_REUSEPORT
+    if (_reuse_port) {
+        LOG_WARN << "[CServer] SO_REUSEPORT not supported on this platform, using a single acceptor";
+        _reuse_port = false;
+    }
+#endif
+
+    auto pool = AsioIOServicePool::GetInstance();
+    std::size_t acceptor_count = _reuse_port ? pool->Size() : 1;
     try {
-        // 创建endpoint并绑定
-        boost::asio::ip::tcp::endpoint ep(boost::asio::ip::tcp::v4(), port);
-        _acceptor.open(ep.protocol());
-        _acceptor.set_option(boost::asio::socket_base::reuse_address(true));  // 允许地址重用
-        _acceptor.bind(ep);
-        _acceptor.listen(boost::asio::socket_base::max_listen_connections);  // 开始监听
-
-        auto ep_local = _acceptor.local_endpoint();
-        std::cout << "Acceptor bound, local endpoint port: " << ep_local.port() << std::endl;
+        for (std::size_t i = 0; i < acceptor_count; ++i) {
+            boost::asio::io_context& ctx = _reuse_port ? pool->GetIOService(i) : _io_context;
+            _acceptors.emplace_back(new tcp::acceptor(ctx));
+            OpenAcceptor(*_acceptors.back(), _reuse_port);
+        }
+        LOG_INFO << "Acceptor bound, local endpoint port: " << _acceptors.front()->local_endpoint().port();
     }
     catch (const boost::system::system_error& e) {
         std::cerr << "Acceptor init failed, port=" << port << ", err=" << e.what() << std::endl;
@@ -38,83 +60,153 @@ CServer::CServer(boost::asio::io_context& io_context, unsigned short port)
     }
 
     std::cout << "Server start success, listen on port : " << _port << std::endl;
-    std::cout << "CServer StartAccept using io_context at " << &(_io_context) << "\n";
+    LOG_INFO << "[CServer] acceptors=" << _acceptors.size() << " io_contexts=" << pool->Size()
+        << " mode=" << (_reuse_port ? "reuse_port" : (_least_loaded ? "least_loaded" : "round_robin"));
 
     // 开始异步接受连接
-    StartAccept();
+    for (std::size_t i = 0; i < _acceptors.size(); ++i) {
+        StartAccept(i);
+    }
+    ScheduleStatsLog();
+}
+
+// 打开acceptor
+// 
+// 实现逻辑：
+//   reuse_address 允许快速重启；reuse_port 时多个 acceptor 绑定同一端口，由内核按四元组哈希分配连接
+void CServer::OpenAcceptor(tcp::acceptor& acceptor, bool reuse_port)
+{
+    boost::asio::ip::tcp::endpoint ep(boost::asio::ip::tcp::v4(), _port);
+    acceptor.open(ep.protocol());
+    acceptor.set_option(boost::asio::socket_base::reuse_address(true));  // 允许地址重用
+#ifdef SO_REUSEPORT
+    if (reuse_port) {
+        typedef boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> reuse_port_option;
+        acceptor.set_option(reuse_port_option(true));
+    }
+#endif
+    acceptor.bind(ep);
+    acceptor.listen(boost::asio::socket_base::max_listen_connections);  // 开始监听
 }
 
 // 析构函数：清理资源
 CServer::~CServer()
 {
+    _stats_timer.cancel();
 }
 
 // 清除会话
 // 
 // 参数：
-//   - session_id: 会话ID
+//   - handle: 会话句柄
 // 
 // 实现逻辑：
-//   1. 从UserMgr中移除用户会话
-//   2. 加锁保证线程安全
-//   3. 从_sessions中删除会话
-void CServer::ClearSession(std::string session_id)
+//   1. 加锁从_sessions中取出并删除会话（查找+删除是原子的，过期句柄不生效，
+//      读写两端同时出错时只有一方能继续）
+//   2. 锁外从UserMgr中移除用户会话（仅当映射仍指向本会话），并广播路由失效
+void CServer::ClearSession(SessionHandle handle)
 {
-    //  修复：扩大锁范围，保证 查找+删除 是原子的，避免竞态条件
-    std::lock_guard<std::mutex> lock(_mutex);
-    
-    auto it = _sessions.find(session_id);
-    if (it != _sessions.end()) {
-        // 移除用户的 session 映射
-        UserMgr::GetInstance()->RmvUserSession(it->second->GetUserId());
-        // 直接用迭代器删除更高效，避免二次查找
-        _sessions.erase(it);
+    std::shared_ptr<CSession> session;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        session = _sessions.Remove(handle);
+    }
+    if (!session) {
+        return;
+    }
+
+    AsioIOServicePool::GetInstance()->GetStats(session->GetIOIndex()).connections.fetch_sub(1, std::memory_order_relaxed);
+
+    // 移除用户的 session 映射（用户已在新连接上重新登录时映射指向新会话，不能删）
+    int uid = session->GetUserId();
+    // 已登录的用户下线，通知各服务器失效该用户的路由缓存
+    if (uid != 0 && UserMgr::GetInstance()->RmvUserSession(uid, session.get())) {
+        RouteCache::GetInstance()->PublishInvalidation(uid);
     }
 }
 
 // 开始异步接受连接
 // 
 // 实现逻辑：
-//   1. 创建一个新的CSession对象
-//   2. 异步接受客户端连接
+//   1. 选择新连接所在的 io_context，在其上创建CSession对象（之后该连接的读写都在这个 io_context 的线程上）
+//   2. 在指定acceptor上异步接受客户端连接
 //   3. 当有连接时，调用HandleAccept处理
-void CServer::StartAccept() {
-    // 使用传递过来的_io_context，例如AsioIOServicePool::GetInstance()
-    std::cout << "CServer StartAccept using io_context at " << &(_io_context) << "\n";
+void CServer::StartAccept(std::size_t acceptor_index) {
+    auto pool = AsioIOServicePool::GetInstance();
+    std::size_t io_index = PickIOContext(acceptor_index);
 
     // 创建新的会话对象
-    std::shared_ptr<CSession> new_session = std::make_shared<CSession>(_io_context, this);
+    std::shared_ptr<CSession> new_session = std::make_shared<CSession>(pool->GetIOService(io_index), this, io_index);
 
     // 异步接受连接
-    _acceptor.async_accept(new_session->GetSocket(),
-        std::bind(&CServer::HandleAccept, this, new_session, std::placeholders::_1));
+    _acceptors[acceptor_index]->async_accept(new_session->GetSocket(),
+        std::bind(&CServer::HandleAccept, this, acceptor_index, new_session, std::placeholders::_1));
+}
+
+// 选择 io_context
+// 
+// 实现逻辑：
+//   ReusePort 模式下连接留在接受它的 io_context；否则按配置取连接数最少的，或轮询
+std::size_t CServer::PickIOContext(std::size_t acceptor_index) {
+    auto pool = AsioIOServicePool::GetInstance();
+    if (_reuse_port) {
+        return acceptor_index;
+    }
+    return _least_loaded ? pool->LeastLoadedIndex() : pool->NextIndex();
 }
 
 // 处理接受连接的回调
 // 
 // 参数：
+//   - acceptor_index: acceptor 下标
 //   - new_session: 新的会话对象
 //   - error: 错误码
 // 
 // 实现逻辑：
 //   1. 检查是否有错误
-//   2. 如果没有错误，启动会话并将会话加入_sessions
+//   2. 如果没有错误，将会话加入_sessions、设置句柄、更新所在 io_context 的连接计数，再启动会话
+//      （先有句柄再开始读，消息分发和出错清理都依赖句柄）
 //   3. 继续异步接受下一个连接
-void CServer::HandleAccept(std::shared_ptr<CSession> new_session, const boost::system::error_code& error) {
+void CServer::HandleAccept(std::size_t acceptor_index, std::shared_ptr<CSession> new_session, const boost::system::error_code& error) {
     if (!error) {
-        // 启动会话
-        new_session->Start();
+        SessionHandle handle;
+        {
+            // 加锁保证线程安全
+            lock_guard<mutex> lock(_mutex);
+            handle = _sessions.Insert(new_session);
+        }
+        new_session->SetHandle(handle);
 
-        // 加锁保证线程安全
-        lock_guard<mutex> lock(_mutex);
+        IOContextStats& stats = AsioIOServicePool::GetInstance()->GetStats(new_session->GetIOIndex());
+        stats.connections.fetch_add(1, std::memory_order_relaxed);
+        stats.accepted.fetch_add(1, std::memory_order_relaxed);
 
-        // 将会话加入_sessions
-        _sessions.insert(std::make_pair(new_session->GetSessionId(), new_session));
+        // 启动会话
+        new_session->Start();
     }
     else {
-        cout << "session accept failed, error is " << error.what() << std::endl;
+        LOG_WARN << "session accept failed, error is " << error.message();
     }
 
     // 继续接受下一个连接
-    StartAccept();
+    StartAccept(acceptor_index);
+}
+
+// 定时输出各 io_context 的连接数和事件数（确认连接和负载是否均匀），以及数据库任务队列、消息攒批写入、MySQL 连接池和预编译语句缓存的统计
+void CServer::ScheduleStatsLog() {
+    if (_stats_interval_sec <= 0) {
+        return;
+    }
+    _stats_timer.expires_after(std::chrono::seconds(_stats_interval_sec));
+    _stats_timer.async_wait([this](const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        AsioIOServicePool::GetInstance()->LogStats();
+        AsyncDBPool::GetInstance()->LogStats();
+        LogicSystem::GetInstance()->LogStats();
+        MysqlMgr::GetInstance()->LogPoolStats();
+        MysqlMgr::GetInstance()->LogStmtCacheStats();
+        ScheduleStatsLog();
+        });
 }
@@ -4,11 +4,15 @@
 #include <boost/asio.hpp>
 #include "CSession.h"
 #include <memory.h>
-#include <map>
 #include <mutex>
+#include <vector>
+#include "SessionSlab.h"
 using namespace std;
 using boost::asio::ip::tcp;
 
+// 缺省每隔多少秒输出一次各 io_context 的连接数和事件数（[Server] IOStatsIntervalSec，0 关闭）
+#define IO_STATS_INTERVAL_SEC 60
+
 // CServer类：TCP服务器，用于接受客户端连接
 // 
 // 作用：
@@ -17,9 +21,12 @@ using boost::asio::ip::tcp;
 //   3. 为每个连接创建CSession对象
 // 
 // 实现逻辑：
-//   1. 使用boost::asio的acceptor接受TCP连接
+//   1. 使用boost::asio的acceptor接受TCP连接，新连接分散到 AsioIOServicePool 的各个 io_context：
+//      - 缺省一个 acceptor，按 [Server] AcceptBalance 选择 round_robin 或 least_loaded（缺省）
+//      - [Server] ReusePort = true 时每个 io_context 一个 SO_REUSEPORT acceptor，由内核分配连接，
+//        连接留在接受它的 io_context 上（不支持 SO_REUSEPORT 的平台退回单 acceptor）
 //   2. 使用异步方式接受连接，实现高并发
-//   3. 使用map存储所有会话（session_id -> session）
+//   3. 所有会话放在 SessionSlab 中，用句柄（槽位下标 + 代数）O(1) 增删
 //   4. 使用互斥锁保证线程安全
 class CServer
 {
@@ -35,25 +42,39 @@ public:
 
     // 清除会话
     // 参数：
-    //   - session_id: 会话ID
+    //   - handle: 会话句柄（同一会话多次调用时，只有第一次生效）
     // 作用：
     //   从服务器中移除指定会话
-    void ClearSession(std::string);
+    void ClearSession(SessionHandle handle);
 
 private:
     // 处理接受连接的回调
     // 参数：
+    //   - acceptor_index: 接受该连接的 acceptor 下标
     //   - new_session: 新的会话对象
     //   - error: 错误码
-    void HandleAccept(std::shared_ptr<CSession>, const boost::system::error_code& error);
+    void HandleAccept(std::size_t acceptor_index, std::shared_ptr<CSession>, const boost::system::error_code& error);
+
+    // 在指定 acceptor 上开始异步接受连接
+    void StartAccept(std::size_t acceptor_index);
+
+    // 为新连接选择 io_context（返回在 AsioIOServicePool 中的下标）
+    std::size_t PickIOContext(std::size_t acceptor_index);
+
+    // 打开、绑定并监听一个 acceptor
+    void OpenAcceptor(tcp::acceptor& acceptor, bool reuse_port);
 
-    // 开始异步接受连接
-    void StartAccept();
+    // 定时输出各 io_context 的负载计数
+    void ScheduleStatsLog();
 
     boost::asio::io_context& _io_context;  // IO上下文引用
     short _port;                            // 监听端口号
-    tcp::acceptor _acceptor;               // TCP接受器
-    std::map<std::string, std::shared_ptr<CSession>> _sessions;  // 会话映射表
+    std::vector<std::unique_ptr<tcp::acceptor>> _acceptors;  // TCP接受器（ReusePort 模式下每个 io_context 一个）
+    bool _reuse_port;                       // 每个 io_context 独立 acceptor
+    bool _least_loaded;                     // 单 acceptor 时按最少连接数分配
+    int _stats_interval_sec;                // 负载计数输出间隔
+    boost::asio::steady_timer _stats_timer;
+    SessionSlab<CSession> _sessions;       // 会话表（句柄 -> 会话）
     std::mutex _mutex;                     // 互斥锁
 };
 
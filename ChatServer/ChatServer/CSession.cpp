@@ -1,20 +1,31 @@
 #include "CSession.h"
 #include "CServer.h"
+#include "ConfigMgr.h"
+#include "AsioIOServicePool.h"
+#include <algorithm>
 
-CSession::CSession(boost::asio::io_context& io_context, CServer* server) :
-	_socket(io_context), _server(server), _b_close(false), _b_head_parse(false),
-	_strand(io_context.get_executor()) {
-	boost::uuids::uuid  a_uuid = boost::uuids::random_generator()();
-	_session_id = boost::uuids::to_string(a_uuid);
-	_recv_head_node = make_shared<MsgNode>(HEAD_TOTAL_LEN);
+CSession::CSession(boost::asio::io_context& io_context, CServer* server, std::size_t io_index) :
+	_b_close(false), _socket(io_context), _handle(INVALID_SESSION_HANDLE),
+	_io_index(io_index), _io_stats(&AsioIOServicePool::GetInstance()->GetStats(io_index)),
+	_server(server), _inflight_frames(0), _drain_watermark(0), _recv_begin(0), _recv_end(0), _user_uid(0), _codec(WireCodec::Json),
+	_login_pending(false), _offline_syncing(false), _strand(io_context.get_executor()) {
+	_write_bufs.reserve(SEND_BATCH_MAX_FRAMES);
 }
 
 boost::asio::ip::tcp::socket& CSession::GetSocket() {
 	return _socket;
 }
 
-std::string& CSession::GetSessionId()
+// 获取会话 UUID
+//
+// 实现逻辑：
+//   第一次调用时生成，之后直接返回；random_generator 构造时要读系统熵源，每个线程只构造一次
+const std::string& CSession::GetSessionId()
 {
+	std::call_once(_session_id_once, [this]() {
+		thread_local boost::uuids::random_generator generator;
+		_session_id = boost::uuids::to_string(generator());
+		});
 	return _session_id;
 }
 
@@ -28,13 +39,30 @@ int CSession::GetUserId()
 	return _user_uid;
 }
 
+bool CSession::HoldMsg(RecvNode node)
+{
+	if (_held_msgs.size() >= LOGIN_HOLD_MAX) {
+		return false;
+	}
+	_held_msgs.push_back(std::move(node));
+	return true;
+}
+
+std::vector<RecvNode> CSession::EndLogin()
+{
+	_login_pending = false;
+	std::vector<RecvNode> held;
+	held.swap(_held_msgs);
+	return held;
+}
+
 
 CSession::~CSession() {
-	std::cout << "~CSession destruct " << std::endl;
+	LOG_DEBUG << "~CSession destruct ";
 }
 
 void CSession::Start() {
-	AsyncReadHead(HEAD_TOTAL_LEN);
+	AsyncReadFrames();
 }
 
 void CSession::Close() {
@@ -46,305 +74,308 @@ std::shared_ptr<CSession>CSession::SharedSelf() {
 	return shared_from_this();
 }
 
+// 发送合并统计（所有会话共享）
+SendStats& CSession::GetSendStats()
+{
+	static SendStats stats;
+	return stats;
+}
+
+// 单次 async_write 最多合并的字节数，读取 [Session] SendBatchBytes，缺省 64KB
+static std::size_t SendBatchBytes()
+{
+	static const std::size_t batch_bytes = []() -> std::size_t {
+		std::string value = ConfigMgr::Inst()["Session"]["SendBatchBytes"];
+		if (!value.empty()) {
+			try {
+				std::size_t bytes = std::stoul(value);
+				if (bytes > 0) {
+					return bytes;
+				}
+			}
+			catch (const std::exception&) {
+				LOG_WARN << "[CSession] invalid SendBatchBytes: " << value;
+			}
+		}
+		return SEND_BATCH_BYTES;
+	}();
+	return batch_bytes;
+}
+
 void CSession::Send(std::string msg, short msgid) {
+	Send(msg.data(), static_cast<short>(msg.length()), msgid);
+}
+
+void CSession::Send(const char* msg, short max_length, short msgid) {
 	std::lock_guard<std::mutex> lock(_send_lock);
 	int send_que_size = _send_que.size();
 	
 	// ✅ 修复：增强的发送队列流控
 	if (send_que_size > MAX_SENDQUE) {
-		std::cout << "session: " << _session_id << " send que fulled, size is " << MAX_SENDQUE << std::endl;
+		LOG_WARN << "session: " << _handle << " send que fulled, size is " << MAX_SENDQUE;
 		
 		// P2级修复：踢掉慢消费者，而不是简单丢包
 		// 在高并发IM系统中，保护服务器内存比保护单条消息更重要
-		std::cout << "[FlowControl] Slow consumer detected for session " << _session_id 
-		          << ", uid=" << _user_uid << ". Closing connection to prevent memory exhaustion." << std::endl;
+		LOG_WARN << "[FlowControl] Slow consumer detected for session " << _handle 
+		          << ", uid=" << _user_uid << ". Closing connection to prevent memory exhaustion.";
 		
 		// 异步关闭连接，让客户端重连
 		// 这比静默丢包更好，客户端能感知到问题并重连
 		auto self = SharedSelf();
 		boost::asio::post(_socket.get_executor(), [self]() {
 			self->Close();
-			self->_server->ClearSession(self->_session_id);
+			self->_server->ClearSession(self->_handle);
 		});
 		return;
 	}
 
-	_send_que.push(std::make_shared<SendNode>(msg.c_str(), msg.length(), msgid));
+	_send_que.push_back(MsgNodePtr(new SendNode(msg, max_length, msgid)));
+	// 队列非空说明已有写操作在进行，写完成后会把新消息一起带走
 	if (send_que_size > 0) {
 		return;
 	}
-	auto& msgnode = _send_que.front();
-	short out_msgid = 0;
-	::memcpy(&out_msgid, msgnode->_data, HEAD_ID_LEN);
-	out_msgid = boost::asio::detail::socket_ops::network_to_host_short(out_msgid);
-	short out_len = 0;
-	::memcpy(&out_len, msgnode->_data + HEAD_ID_LEN, HEAD_DATA_LEN);
-	out_len = boost::asio::detail::socket_ops::network_to_host_short(out_len);
-	int uid = _user_uid;
-	auto self = SharedSelf();
-	boost::asio::async_write(
-		_socket,
-		boost::asio::buffer(msgnode->_data, msgnode->_total_len),
-		boost::asio::bind_executor(_strand,
-			[self, out_msgid, out_len, uid](const boost::system::error_code& ec, std::size_t bytes_transferred) {
-				if (!ec) {
-					std::cout << "[TCP][Write] ok uid=" << uid << " msgid=" << out_msgid
-						<< " body_len=" << out_len << " bytes=" << bytes_transferred << std::endl;
-				}
-				else {
-					std::cout << "[TCP][Write] fail uid=" << uid << " msgid=" << out_msgid
-						<< " body_len=" << out_len << " err=" << ec.message() << std::endl;
-				}
-				self->HandleWrite(ec, self);
-			}
-		)
-	);
+	StartWrite();
 }
 
-void CSession::Send(char* msg, short max_length, short msgid) {
+std::size_t CSession::SendQueueSize() {
 	std::lock_guard<std::mutex> lock(_send_lock);
-	int send_que_size = _send_que.size();
-	
-	// ✅ 修复：增强的发送队列流控（与上面的Send方法保持一致）
-	if (send_que_size > MAX_SENDQUE) {
-		std::cout << "session: " << _session_id << " send que fulled, size is " << MAX_SENDQUE << std::endl;
-		
-		std::cout << "[FlowControl] Slow consumer detected for session " << _session_id 
-		          << ", uid=" << _user_uid << ". Closing connection to prevent memory exhaustion." << std::endl;
-		
-		auto self = SharedSelf();
-		boost::asio::post(_socket.get_executor(), [self]() {
-			self->Close();
-			self->_server->ClearSession(self->_session_id);
-		});
-		return;
+	return _send_que.size();
+}
+
+// 注册发送队列排空回调
+// 
+// 实现逻辑：
+//   队列已经不超过水位时直接调用；否则保存下来，由 HandleWrite 在弹出写完的帧后检查并调用（锁外）
+void CSession::OnSendQueueDrained(std::size_t low_watermark, std::function<void()> callback) {
+	{
+		std::lock_guard<std::mutex> lock(_send_lock);
+		if (_send_que.size() > low_watermark) {
+			_drain_watermark = low_watermark;
+			_on_drained = std::move(callback);
+			return;
+		}
 	}
+	callback();
+}
 
-	_send_que.push(std::make_shared<SendNode>(msg, max_length, msgid));
-	if (send_que_size > 0) {
-		return;
+// 发起一次合并写
+// 
+// 实现逻辑：
+//   1. 从队首开始收集帧，直到累计字节数达到 SendBatchBytes 或帧数达到 SEND_BATCH_MAX_FRAMES
+//      （至少带上一帧，超大帧单独发送）
+//   2. 用一个 buffer 序列发起 async_write（内核侧为一次 writev）
+//   3. 写完成前这些帧留在队列中、_write_bufs 保持不变，保证缓冲区有效
+// 
+// 注意：调用方必须持有 _send_lock，且 _send_que 非空
+void CSession::StartWrite()
+{
+	_write_bufs.clear();
+	std::size_t batch_bytes = 0;
+	const std::size_t max_batch_bytes = SendBatchBytes();
+	for (auto& node : _send_que) {
+		std::size_t len = static_cast<std::size_t>(node->_total_len);
+		if (!_write_bufs.empty() &&
+			(batch_bytes + len > max_batch_bytes || _write_bufs.size() >= SEND_BATCH_MAX_FRAMES)) {
+			break;
+		}
+		_write_bufs.emplace_back(node->_data, len);
+		batch_bytes += len;
 	}
-	auto& msgnode = _send_que.front();
-	short out_msgid = 0;
-	::memcpy(&out_msgid, msgnode->_data, HEAD_ID_LEN);
-	out_msgid = boost::asio::detail::socket_ops::network_to_host_short(out_msgid);
-	short out_len = 0;
-	::memcpy(&out_len, msgnode->_data + HEAD_ID_LEN, HEAD_DATA_LEN);
-	out_len = boost::asio::detail::socket_ops::network_to_host_short(out_len);
+	_inflight_frames = _write_bufs.size();
+
+	std::size_t frames = _inflight_frames;
 	int uid = _user_uid;
 	auto self = SharedSelf();
 	boost::asio::async_write(
 		_socket,
-		boost::asio::buffer(msgnode->_data, msgnode->_total_len),
+		ConstBufferSpan{ _write_bufs.data(), _write_bufs.data() + _write_bufs.size() },
 		boost::asio::bind_executor(_strand,
-			[self, out_msgid, out_len, uid](const boost::system::error_code& ec, std::size_t bytes_transferred) {
-				if (!ec) {
-					std::cout << "[TCP][Write] ok uid=" << uid << " msgid=" << out_msgid
-						<< " body_len=" << out_len << " bytes=" << bytes_transferred << std::endl;
+			[self, frames, uid](const boost::system::error_code& ec, std::size_t bytes_transferred) {
+				if (ec) {
+					LOG_WARN << "[TCP][Write] fail uid=" << uid << " frames=" << frames
+						<< " err=" << ec.message();
 				}
 				else {
-					std::cout << "[TCP][Write] fail uid=" << uid << " msgid=" << out_msgid
-						<< " body_len=" << out_len << " err=" << ec.message() << std::endl;
+					self->RecordSendStats(frames, bytes_transferred);
 				}
-				self->HandleWrite(ec, self);
+				self->HandleWrite(ec);
 			}
 		)
 	);
 }
 
-void CSession::AsyncReadHead(int total_len)
+// 记录一次合并写的帧数和字节数，每 SEND_STATS_LOG_INTERVAL 次写输出一次累计值和内存池计数
+void CSession::RecordSendStats(std::size_t frames, std::size_t bytes)
+{
+	SendStats& stats = GetSendStats();
+	uint64_t writes = stats.writes.fetch_add(1, std::memory_order_relaxed) + 1;
+	uint64_t total_frames = stats.frames.fetch_add(frames, std::memory_order_relaxed) + frames;
+	uint64_t total_bytes = stats.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+	if (writes % SEND_STATS_LOG_INTERVAL == 0) {
+		LOG_INFO << "[TCP][SendStats] writes=" << writes << " frames=" << total_frames
+			<< " bytes=" << total_bytes
+			<< " frames_per_write=" << static_cast<double>(total_frames) / writes;
+		MsgPool::Stats pool = MsgPool::GetStats();
+		LOG_INFO << "[MsgPool] pool_hits=" << pool.pool_hits << " mallocs=" << pool.mallocs
+			<< " frees=" << pool.frees;
+	}
+}
+
+// 读取并解析消息帧
+// 
+// 实现逻辑：
+//   1. 直接读入会话的接收块尾部，一次 async_read_some 可能带回多个帧或半个帧
+//   2. ParseFrames 把所有完整帧作为块内视图投递到逻辑层，剩余的半帧留在块中
+//   3. 继续读取，直到出错或遇到非法帧头时关闭会话
+void CSession::AsyncReadFrames()
 {
+	PrepareRecvBlock();
 	auto self = shared_from_this();
-	asyncReadFull(HEAD_TOTAL_LEN, [self, this](const boost::system::error_code& ec, std::size_t bytes_transfered) {
-		try {
+	_socket.async_read_some(
+		boost::asio::buffer(_recv_block->Data() + _recv_end, RecvBlock::Capacity() - _recv_end),
+		[self, this](const boost::system::error_code& ec, std::size_t bytes_transfered) {
 			if (ec) {
-				std::cout << "handle read failed, error is " << ec.what() << std::endl;
+				LOG_INFO << "handle read failed, error is " << ec.message();
 				Close();
-				_server->ClearSession(_session_id);
+				_server->ClearSession(_handle);
 				return;
 			}
 
-			if (bytes_transfered < HEAD_TOTAL_LEN) {
-				std::cout << "read length not match, read [" << bytes_transfered << "] , total ["
-					<< HEAD_TOTAL_LEN << "]" << std::endl;
+			_io_stats->events.fetch_add(1, std::memory_order_relaxed);
+			_recv_end += bytes_transfered;
+			if (!ParseFrames()) {
 				Close();
-				_server->ClearSession(_session_id);
+				_server->ClearSession(_handle);
 				return;
 			}
 
-			_recv_head_node->Clear();
-			memcpy(_recv_head_node->_data, _data, bytes_transfered);
-
-			//获取头部MSGID数据
-			short msg_id = 0;
-			memcpy(&msg_id, _recv_head_node->_data, HEAD_ID_LEN);
-			//网络字节序转化为本地字节序
-			msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
-			std::cout << "msg_id is " << msg_id << std::endl;
-			
-			// ✅ 修复：严格的消息ID验证
-			// 检查消息ID是否在合法范围内（避免负数和过大值）
-			if (msg_id < 0 || msg_id > MAX_LENGTH) {
-				std::cout << "invalid msg_id is " << msg_id << " (must be 0-" << MAX_LENGTH << ")" << std::endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
-			}
-			
-			short msg_len = 0;
-			memcpy(&msg_len, _recv_head_node->_data + HEAD_ID_LEN, HEAD_DATA_LEN);
-			//网络字节序转化为本地字节序
-			msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
-			std::cout << "msg_len is " << msg_len << std::endl;
-
-			// ✅ 修复：严格的消息长度验证
-			// 1. 检查负数（防止整数溢出攻击）
-			// 2. 检查最大长度（防止内存耗尽攻击）
-			// 3. 添加合理的最大包体限制（10MB）
-			const int MAX_PACKAGE_SIZE = 10 * 1024 * 1024;  // 10MB
-			if (msg_len < 0) {
-				std::cout << "invalid negative msg_len: " << msg_len << std::endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
-			}
-			if (msg_len > MAX_LENGTH) {
-				std::cout << "msg_len too large: " << msg_len << " (max: " << MAX_LENGTH << ")" << std::endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
-			}
-			if (msg_len > MAX_PACKAGE_SIZE) {
-				std::cout << "potential DoS attack: msg_len=" << msg_len << " exceeds " << MAX_PACKAGE_SIZE << " bytes" << std::endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
-			}
-
-			_recv_msg_node = std::make_shared<RecvNode>(msg_len, msg_id);
-			AsyncReadBody(msg_len);
-		}
-		catch (boost::system::error_code& e) {
-			std::cout << "Exception code is " << e.what() << std::endl;
-		}
+			AsyncReadFrames();
 		});
 }
 
-//读取完整长度
-void CSession::asyncReadFull(std::size_t maxLength, std::function<void(const boost::system::error_code&, std::size_t)> handler)
+// 准备接收块
+// 
+// 实现逻辑：
+//   1. 数据已全部解析且没有 RecvNode 再引用该块时，从块首重新开始写
+//   2. 尾部还能放下一个最大帧时直接继续写
+//   3. 否则把未解析完的半帧移到块首；块仍被逻辑层引用时改为拷贝到新块（最多一帧）
+void CSession::PrepareRecvBlock()
 {
-	::memset(_data, 0, MAX_LENGTH);
-	asyncReadLen(0, maxLength, handler);
-}
+	if (!_recv_block) {
+		_recv_block = RecvBlockPool::Inst().Acquire();
+		_recv_begin = _recv_end = 0;
+		return;
+	}
 
-//读取指定字节数
-void CSession::asyncReadLen(std::size_t read_len, std::size_t total_len,
-	std::function<void(const boost::system::error_code&, std::size_t)> handler)
-{
-	auto self = shared_from_this();
-	_socket.async_read_some(boost::asio::buffer(_data + read_len, total_len - read_len),
-		[read_len, total_len, handler, self](const boost::system::error_code& ec, std::size_t  bytesTransfered) {
-			if (ec) {
-				// 出现错误，调用回调函数
-				handler(ec, read_len + bytesTransfered);
-				return;
-			}
+	std::size_t pending = _recv_end - _recv_begin;
+	if (pending == 0 && _recv_block->Unique()) {
+		_recv_begin = _recv_end = 0;
+		return;
+	}
 
-			if (read_len + bytesTransfered >= total_len) {
-				//长度够了就调用回调函数
-				handler(ec, read_len + bytesTransfered);
-				return;
-			}
+	if (RecvBlock::Capacity() - _recv_end >= HEAD_TOTAL_LEN + MAX_LENGTH) {
+		return;
+	}
 
-			// 没有错误，且长度不足则继续读取
-			self->asyncReadLen(read_len + bytesTransfered, total_len, handler);
-		});
+	if (_recv_block->Unique()) {
+		::memmove(_recv_block->Data(), _recv_block->Data() + _recv_begin, pending);
+	}
+	else {
+		RecvBlockPtr fresh = RecvBlockPool::Inst().Acquire();
+		::memcpy(fresh->Data(), _recv_block->Data() + _recv_begin, pending);
+		_recv_block = std::move(fresh);
+	}
+	_recv_begin = 0;
+	_recv_end = pending;
 }
 
-void CSession::AsyncReadBody(int total_len)
+// 解析接收块中的完整帧
+// 
+// 帧格式：[消息ID(2字节)][数据长度(2字节)][数据内容]，均为网络字节序
+// 
+// 返回值：
+//   帧头合法返回true；消息ID或长度越界返回false，由调用方关闭连接
+bool CSession::ParseFrames()
 {
-	auto self = shared_from_this();
-	asyncReadFull(total_len, [self, this, total_len](const boost::system::error_code& ec, std::size_t bytes_transfered) {
-		try {
-			if (ec) {
-				std::cout << "handle read failed, error is " << ec.what() << std::endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
-			}
+	while (_recv_end - _recv_begin >= HEAD_TOTAL_LEN) {
+		const char* head = _recv_block->Data() + _recv_begin;
 
-			if (bytes_transfered < total_len) {
-				std::cout << "read length not match, read [" << bytes_transfered << "] , total ["
-					<< total_len << "]" << std::endl;
-				Close();
-				_server->ClearSession(_session_id);
-				return;
-			}
+		//获取头部MSGID数据
+		short msg_id = 0;
+		memcpy(&msg_id, head, HEAD_ID_LEN);
+		//网络字节序转化为本地字节序
+		msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
 
-			memcpy(_recv_msg_node->_data, _data, bytes_transfered);
-			_recv_msg_node->_cur_len += bytes_transfered;
-			_recv_msg_node->_data[_recv_msg_node->_total_len] = '\0';
-			std::cout << "receive data is " << _recv_msg_node->_data << std::endl;
-			//此处将消息投递到逻辑队列中
-			LogicSystem::GetInstance()->PostMsgToQue(std::make_shared<LogicNode>(shared_from_this(), _recv_msg_node));
-			//继续监听头部接受事件
-			AsyncReadHead(HEAD_TOTAL_LEN);
+		// 检查消息ID是否在合法范围内（避免负数和过大值）
+		if (msg_id < 0 || msg_id > MAX_LENGTH) {
+			LOG_WARN << "invalid msg_id is " << msg_id << " (must be 0-" << MAX_LENGTH << ")";
+			return false;
 		}
-		catch (boost::system::error_code& e) {
-			std::cout << "Exception code is " << e.what() << std::endl;
+
+		short msg_len = 0;
+		memcpy(&msg_len, head + HEAD_ID_LEN, HEAD_DATA_LEN);
+		msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
+
+		// 检查负数（防止整数溢出攻击）和最大长度（防止内存耗尽攻击）
+		if (msg_len < 0 || msg_len > MAX_LENGTH) {
+			LOG_WARN << "invalid msg_len: " << msg_len << " (max: " << MAX_LENGTH << ")";
+			return false;
 		}
-		});
+
+		// 半帧：等待下一次读取
+		if (_recv_end - _recv_begin < static_cast<std::size_t>(HEAD_TOTAL_LEN + msg_len)) {
+			break;
+		}
+
+		LOG_DEBUG << "receive msg_id is " << msg_id << " msg_len is " << msg_len;
+		//此处将消息投递到逻辑队列中
+		LogicSystem::GetInstance()->PostMsgToQue(LogicNode(shared_from_this(),
+			RecvNode(_recv_block, head + HEAD_TOTAL_LEN, msg_len, msg_id)));
+		_recv_begin += HEAD_TOTAL_LEN + msg_len;
+	}
+	return true;
 }
 
-void CSession::HandleWrite(const boost::system::error_code& error, std::shared_ptr<CSession> shared_self) {
+void CSession::HandleWrite(const boost::system::error_code& error) {
 	//增加异常处理
 	try {
 		if (!error) {
-			std::lock_guard<std::mutex> lock(_send_lock);
-			//cout << "send data " << _send_que.front()->_data+HEAD_LENGTH << std::endl;
-			_send_que.pop();
-			if (!_send_que.empty()) {
-				auto& msgnode = _send_que.front();
-				auto self = shared_self;
-				short out_msgid = 0;
-				::memcpy(&out_msgid, msgnode->_data, HEAD_ID_LEN);
-				out_msgid = boost::asio::detail::socket_ops::network_to_host_short(out_msgid);
-				short out_len = 0;
-				::memcpy(&out_len, msgnode->_data + HEAD_ID_LEN, HEAD_DATA_LEN);
-				out_len = boost::asio::detail::socket_ops::network_to_host_short(out_len);
-				int uid = _user_uid;
-				std::cout << "[TCP][Write] next uid=" << uid << " msgid=" << out_msgid
-					<< " body_len=" << out_len << std::endl;
-				boost::asio::async_write(
-					_socket,
-					boost::asio::buffer(msgnode->_data, msgnode->_total_len),
-					boost::asio::bind_executor(_strand,
-						[self, out_msgid, out_len, uid](const boost::system::error_code& ec, std::size_t bytes_transferred) {
-							if (!ec) {
-								std::cout << "[TCP][Write] ok uid=" << uid << " msgid=" << out_msgid
-									<< " body_len=" << out_len << " bytes=" << bytes_transferred << std::endl;
-							}
-							else {
-								std::cout << "[TCP][Write] fail uid=" << uid << " msgid=" << out_msgid
-									<< " body_len=" << out_len << " err=" << ec.message() << std::endl;
-							}
-							self->HandleWrite(ec, self);
-						}
-					)
-				);
+			_io_stats->events.fetch_add(1, std::memory_order_relaxed);
+			std::function<void()> on_drained;
+			{
+				std::lock_guard<std::mutex> lock(_send_lock);
+				// 弹出刚写完的整批帧，期间新入队的消息组成下一批
+				for (std::size_t i = 0; i < _inflight_frames && !_send_que.empty(); ++i) {
+					_send_que.pop_front();
+				}
+				_inflight_frames = 0;
+				if (!_send_que.empty()) {
+					StartWrite();
+				}
+				if (_on_drained && _send_que.size() <= _drain_watermark) {
+					on_drained.swap(_on_drained);
+				}
+			}
+			// 回调可能再次 Send，不能持有 _send_lock
+			if (on_drained) {
+				on_drained();
 			}
 		}
 		else {
-			std::cout << "handle write failed, error is " << error.what() << std::endl;
+			LOG_WARN << "handle write failed, error is " << error.message();
 			Close();
-			_server->ClearSession(_session_id);
+			_server->ClearSession(_handle);
 		}
 	}
 	catch (std::exception& e) {
-		std::cerr << "Exception code : " << e.what() << std::endl;
+		LOG_ERROR << "Exception code : " << e.what();
 	}
 }
 
-LogicNode::LogicNode(std::shared_ptr<CSession> session, std::shared_ptr<RecvNode> recvnode) :_session(session), _recvnode(recvnode)
+LogicNode::LogicNode(std::shared_ptr<CSession> session, RecvNode recvnode) :_session(std::move(session)), _recvnode(std::move(recvnode))
+{
+}
+
+LogicNode::LogicNode(std::shared_ptr<CSession> session, std::function<void()> task) :_session(std::move(session)), _task(std::move(task))
 {
 }
\ No newline at end of file
@@ -4,10 +4,14 @@
 #include"LogicSystem.h"
 #include<boost/asio.hpp>
 #include"MsgNode.h"
-#include<queue>
+#include<deque>
+#include<atomic>
+#include<vector>
+#include<functional>
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include "const.h"
+#include "SessionSlab.h"
 #define MAX_LENGTH 1024 * 2
 
 #define HEAD_TOTAL_LEN 4
@@ -18,60 +22,142 @@
 #define MAX_RECVQUE 10000
 #define MAX_SENDQUE 1000
 
+// 单次合并写缺省的最大字节数（可由 [Session] SendBatchBytes 覆盖）
+#define SEND_BATCH_BYTES (64 * 1024)
+// 单次合并写最多的帧数（与 Asio 单次 writev 的 iovec 上限一致）
+#define SEND_BATCH_MAX_FRAMES 64
+// 每多少次合并写输出一次发送统计
+#define SEND_STATS_LOG_INTERVAL 10000
+// 登录进行中最多暂存的消息数（正常客户端在登录回包前不会发消息，超出视为异常连接）
+#define LOGIN_HOLD_MAX 64
+
 class CServer;
+struct IOContextStats;
+
+// 指向一段 const_buffer 数组的轻量 buffer 序列
+// async_write 会按值保存 buffer 序列，传 vector 会在每次写时拷贝（堆分配），传这个视图不会
+struct ConstBufferSpan {
+	typedef boost::asio::const_buffer value_type;
+	typedef const boost::asio::const_buffer* const_iterator;
+
+	const_iterator first;
+	const_iterator last;
+
+	const_iterator begin() const { return first; }
+	const_iterator end() const { return last; }
+};
+
+// 发送合并统计：frames / writes 即每次系统调用平均带走的帧数
+struct SendStats {
+	std::atomic<uint64_t> writes{ 0 };   // async_write 次数
+	std::atomic<uint64_t> frames{ 0 };   // 发送的帧数
+	std::atomic<uint64_t> bytes{ 0 };    // 发送的字节数
+};
 
 class CSession : public std::enable_shared_from_this<CSession>
 {
 public:
-	CSession(boost::asio::io_context& io_context, CServer* server);
+	// io_index: 会话所在 io_context 在 AsioIOServicePool 中的下标（用于负载计数）
+	CSession(boost::asio::io_context& io_context, CServer* server, std::size_t io_index);
 	void Start();
 	void Close();
-	void Send(char* msg, short max_length, short msgid);
+	void Send(const char* msg, short max_length, short msgid);
 	void Send(std::string msg, short msgid);
-	void AsyncReadHead(int total_len);
-	void asyncReadFull(std::size_t maxLength,
-		std::function<void(const boost::system::error_code&, std::size_t)> handler);
-	void asyncReadLen(std::size_t read_len, std::size_t total_len,
-		std::function<void(const boost::system::error_code&, std::size_t)> handler);
-	void AsyncReadBody(int total_len);
+	// 发送队列中的帧数（含正在写的一批）
+	std::size_t SendQueueSize();
+	// 发送队列降到 low_watermark 帧及以下时调用一次 callback（在 IO 线程上调用，当前已满足则立即调用）
+	// 用于大批量下发（如离线消息）按对端的接收速度推进，不把队列推过 MAX_SENDQUE；只保留最后一次注册的回调
+	void OnSendQueueDrained(std::size_t low_watermark, std::function<void()> callback);
+	void AsyncReadFrames();
 	boost::asio::ip::tcp::socket& GetSocket();
-	std::string& GetSessionId();
+	// 会话 UUID：只在第一次调用时生成（目前只用于日志），会话表和分发都用句柄
+	const std::string& GetSessionId();
+	// 会话句柄（CServer 在 accept 后分配，Start 之前设置）
+	void SetHandle(SessionHandle handle) { _handle = handle; }
+	SessionHandle GetHandle() const { return _handle; }
+	std::size_t GetIOIndex() const { return _io_index; }
 	void SetUserId(int uid);
 	int GetUserId();
+	// 登录期间（异步校验 token、写登录状态）暂存本会话后续的消息，登录结束后按顺序处理，
+	// 保证其他消息不会在用户绑定之前执行；只在本会话所属的逻辑工作线程上调用
+	void BeginLogin() { _login_pending = true; }
+	bool LoginPending() const { return _login_pending; }
+	// 暂存一条消息，超过 LOGIN_HOLD_MAX 条时返回 false
+	bool HoldMsg(RecvNode node);
+	// 登录结束，取出暂存的消息
+	std::vector<RecvNode> EndLogin();
+	// 离线消息同步（OfflineSync）同一会话同时只能有一个，它们共用 OnSendQueueDrained 的回调
+	// 开始时返回 false 说明已有同步在运行；结束在 DB 线程上调用
+	bool TryBeginOfflineSync() { return !_offline_syncing.exchange(true, std::memory_order_acq_rel); }
+	void EndOfflineSync() { _offline_syncing.store(false, std::memory_order_release); }
+	// 消息体编码（缺省 JSON，协商后切换；gRPC 线程投递通知时也会读取）
+	void SetCodec(WireCodec codec) { _codec.store(codec, std::memory_order_release); }
+	WireCodec GetCodec() const { return _codec.load(std::memory_order_acquire); }
 	~CSession();
 
 	std::shared_ptr<CSession> SharedSelf();
 
+	// 所有会话共享的发送合并统计
+	static SendStats& GetSendStats();
+
 private:
-	void HandleWrite(const boost::system::error_code& error, std::shared_ptr<CSession> shared_self);
+	// 写完成（写回调捕获的 self 保证会话存活到这里）
+	void HandleWrite(const boost::system::error_code& error);
+	// 把队首的若干帧合并成一次 async_write（调用方持有 _send_lock）
+	void StartWrite();
+	void RecordSendStats(std::size_t frames, std::size_t bytes);
+	// 读之前保证接收块尾部至少能放下一个最大帧
+	void PrepareRecvBlock();
+	// 从接收块中解析所有完整帧并投递到逻辑层，遇到非法帧头返回false
+	bool ParseFrames();
 
 	bool _b_close;
 	tcp::socket _socket;
+	SessionHandle _handle;
+	std::size_t _io_index;
+	IOContextStats* _io_stats;
 	std::string _session_id;
-	char _data[MAX_LENGTH];
+	std::once_flag _session_id_once;
 	CServer* _server;
-	std::queue<std::shared_ptr<MsgNode> > _send_que;
+	std::deque<MsgNodePtr> _send_que;
 	std::mutex _send_lock;
-	//收到的消息结构
-	std::shared_ptr<RecvNode> _recv_msg_node;
-	bool _b_head_parse;
-	//收到的头部结构
-	std::shared_ptr<MsgNode> _recv_head_node;
+	// 正在写的一批帧数（位于 _send_que 队首）
+	std::size_t _inflight_frames;
+	// 正在写的一批帧对应的 buffer，写完成前保持不变，容量复用
+	std::vector<boost::asio::const_buffer> _write_bufs;
+	// 发送队列降到 _drain_watermark 时的回调（由 _send_lock 保护）
+	std::size_t _drain_watermark;
+	std::function<void()> _on_drained;
+	//接收缓冲块，[_recv_begin, _recv_end) 为已读入但尚未解析的数据
+	RecvBlockPtr _recv_block;
+	std::size_t _recv_begin;
+	std::size_t _recv_end;
 	std::function<void()> func_;
 
 	int _user_uid;
+	std::atomic<WireCodec> _codec;
+	// 登录进行中暂存的消息（只在逻辑工作线程访问，不加锁）
+	bool _login_pending;
+	std::vector<RecvNode> _held_msgs;
+	// 是否有离线消息同步在运行
+	std::atomic<bool> _offline_syncing;
 
 	boost::asio::strand<boost::asio::io_context::executor_type> _strand;
 };
 
+// 逻辑层队列元素：一条收到的消息，或一个需要回到该会话工作线程上执行的任务
+// （异步 Redis 回复到达后的后续处理通过任务重新进入同一个 LogicWorker）
 class LogicNode {
 	friend class LogicSystem;
 public:
-	LogicNode(std::shared_ptr<CSession>, std::shared_ptr<RecvNode>);
+	LogicNode() = default;
+	LogicNode(std::shared_ptr<CSession>, RecvNode);
+	LogicNode(std::shared_ptr<CSession>, std::function<void()> task);
 
 private:
 	std::shared_ptr<CSession> _session;
-	std::shared_ptr<RecvNode> _recvnode;
+	RecvNode _recvnode;
+	std::function<void()> _task;
 };
 
 
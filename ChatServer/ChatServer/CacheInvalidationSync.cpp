@@ -142,7 +142,7 @@ void CacheInvalidationSync::SubscriberLoop()
 
 void CacheInvalidationSync::HandleMessage(const std::string& message)
 {
-    std::cout << "[CacheInvalidationSync] Received: " << message << std::endl;
+    LOG_DEBUG << "[CacheInvalidationSync] Received: " << message;
 
     if (message.rfind("INVALIDATE:", 0) == 0) {
         // 单个失效: "INVALIDATE:uid"
@@ -150,7 +150,7 @@ void CacheInvalidationSync::HandleMessage(const std::string& message)
         int uid = std::stoi(uid_str);
         if (invalidate_cb_) {
             invalidate_cb_(uid);
-            std::cout << "[CacheInvalidationSync] Invalidated uid=" << uid << std::endl;
+            LOG_DEBUG << "[CacheInvalidationSync] Invalidated uid=" << uid;
         }
     }
     else if (message.rfind("INVALIDATE_BATCH:", 0) == 0) {
@@ -159,7 +159,7 @@ void CacheInvalidationSync::HandleMessage(const std::string& message)
         std::vector<int> uids = ParseUidList(uid_list);
         if (invalidate_batch_cb_) {
             invalidate_batch_cb_(uids);
-            std::cout << "[CacheInvalidationSync] Invalidated " << uids.size() << " users" << std::endl;
+            LOG_DEBUG << "[CacheInvalidationSync] Invalidated " << uids.size() << " users";
         }
     }
     else if (message == "CLEAR_ALL") {
@@ -189,8 +189,7 @@ std::vector<int> CacheInvalidationSync::ParseUidList(const std::string& uid_list
 
 bool CacheInvalidationSync::PublishInvalidation(int uid)
 {
-    std::string message = "INVALIDATE:" + std::to_string(uid);
-    return RedisMgr::GetInstance()->Publish(channel_, message);
+    return RedisMgr::GetInstance()->Publish(channel_, InvalidationMessage(uid));
 }
 
 bool CacheInvalidationSync::PublishInvalidationBatch(const std::vector<int>& uids)
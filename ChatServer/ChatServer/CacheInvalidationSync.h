@@ -66,6 +66,13 @@ public:
      */
     bool PublishInvalidation(int uid);
 
+    /**
+     * @brief 构造单个失效消息 "INVALIDATE:uid"
+     *
+     * 供不经过 RedisMgr 发布的调用方（如 AsyncRedisMgr 的 pipeline）使用，保证消息格式一致
+     */
+    static std::string InvalidationMessage(int uid) { return "INVALIDATE:" + std::to_string(uid); }
+
     /**
      * @brief 发布批量失效消息
      * @param uids 用户 ID 列表
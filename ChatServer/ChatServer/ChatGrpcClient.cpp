@@ -6,8 +6,442 @@
 #include"MysqlMgr.h"
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <iostream>
 
+// 一次在途的跨服批量请求（完成队列的 tag）
+struct ChatBatchCall {
+    ChatPeerLink* link = nullptr;
+    ClientContext context;
+    TextChatMsgReq req;
+    TextChatMsgRsp rsp;
+    Status status;
+    std::vector<TextChatCallback> callbacks;  // 单条请求一个，批量请求与 req.batch 按下标对应
+    std::unique_ptr<grpc::ClientAsyncResponseReader<TextChatMsgRsp>> reader;
+};
+
+namespace {
+    TextChatMsgRsp FailedTextChatRsp(const TextChatMsgReq& req)
+    {
+        TextChatMsgRsp rsp;
+        rsp.set_error(ErrorCodes::RPCFailed);
+        rsp.set_fromuid(req.fromuid());
+        rsp.set_touid(req.touid());
+        rsp.set_msg_id(req.msg_id());
+        return rsp;
+    }
+}
+
+ChatPeerLink::ChatPeerLink(std::string name, const std::string& host, const std::string& port, grpc::CompletionQueue* cq)
+    : _name(std::move(name)),
+      _stub(ChatService::NewStub(grpc::CreateChannel(host + ":" + port, grpc::InsecureChannelCredentials()))),
+      _cq(cq), _in_flight(nullptr), _stopped(false), _legacy(false)
+{
+}
+
+bool ChatPeerLink::Enqueue(const TextChatMsgReq& req, const TextChatCallback& cb)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_stopped || _pending.size() >= CHAT_PEER_MAX_PENDING) {
+        return false;
+    }
+    _pending.push_back(PendingTextChat{ req, cb });
+    if (_in_flight == nullptr) {
+        StartCallLocked();
+    }
+    return true;
+}
+
+void ChatPeerLink::StartCallLocked()
+{
+    std::size_t n = _legacy ? 1 : std::min<std::size_t>(_pending.size(), CHAT_PEER_MAX_BATCH);
+    auto* call = new ChatBatchCall;
+    call->link = this;
+    call->context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(CHAT_PEER_DEADLINE_MS));
+    call->callbacks.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        PendingTextChat& item = _pending.front();
+        if (n == 1) {
+            call->req = std::move(item.req);
+        }
+        else {
+            *call->req.add_batch() = std::move(item.req);
+        }
+        call->callbacks.push_back(std::move(item.cb));
+        _pending.pop_front();
+    }
+
+    call->reader = _stub->PrepareAsyncNotifyTextChatMsg(&call->context, call->req, _cq);
+    call->reader->StartCall();
+    call->reader->Finish(&call->rsp, &call->status, call);
+    _in_flight = call;
+}
+
+// 请求完成
+//
+// 实现逻辑：
+//   1. 对方未升级时（老版本忽略 batch 字段，按 touid = 0 的空请求处理，回包没有 batch），
+//      本批放回队首按单条格式逐条重发，之后不再合批
+//   2. 否则先发出排队的消息，再分发本次的回调（回调期间下一批已经在途）
+//   3. 失败或回包的 batch 条数不符时，本批每条都按 RPCFailed 回调，消息仍在库中等待离线拉取
+void ChatPeerLink::OnCallDone(ChatBatchCall* call)
+{
+    std::unique_ptr<ChatBatchCall> done(call);
+    std::size_t n = done->callbacks.size();
+    bool is_batch = done->req.batch_size() > 0;
+    bool ok = done->status.ok();
+    bool resend = ok && is_batch && done->rsp.batch_size() == 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _in_flight = nullptr;
+        if (resend && !_stopped) {
+            if (!_legacy) {
+                LOG_WARN << "[TextChat][gRPC][Client] target=" << _name << " does not support batch, send one message per call";
+                _legacy = true;
+            }
+            for (std::size_t i = n; i-- > 0;) {
+                _pending.push_front(PendingTextChat{ std::move(*done->req.mutable_batch(static_cast<int>(i))),
+                    std::move(done->callbacks[i]) });
+            }
+            StartCallLocked();
+            return;
+        }
+        if (!_stopped && !_pending.empty()) {
+            StartCallLocked();
+        }
+    }
+
+    if (!ok) {
+        LOG_WARN << "[TextChat][gRPC][Client] async rpc failed target=" << _name << " msgs=" << n
+                 << " error_code=" << done->status.error_code()
+                 << " error_message=" << done->status.error_message();
+    }
+    else if (is_batch && done->rsp.batch_size() != static_cast<int>(n)) {
+        LOG_WARN << "[TextChat][gRPC][Client] batch rsp size mismatch target=" << _name
+                 << " sent=" << n << " got=" << done->rsp.batch_size();
+        ok = false;
+    }
+    else {
+        LOG_DEBUG << "[TextChat][gRPC][Client] async rpc ok target=" << _name << " msgs=" << n;
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const TextChatMsgReq& item = is_batch ? done->req.batch(static_cast<int>(i)) : done->req;
+        if (!ok) {
+            done->callbacks[i](FailedTextChatRsp(item));
+        }
+        else {
+            done->callbacks[i](is_batch ? done->rsp.batch(static_cast<int>(i)) : done->rsp);
+        }
+    }
+}
+
+// 关闭
+//
+// 注意：
+//   排队的消息在锁外按 RPCFailed 回调；在途请求被取消后由 OnCallDone 按 RPCFailed 回调
+void ChatPeerLink::Shutdown()
+{
+    std::deque<PendingTextChat> dropped;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopped = true;
+        dropped.swap(_pending);
+        if (_in_flight != nullptr) {
+            _in_flight->context.TryCancel();
+        }
+    }
+    for (auto& item : dropped) {
+        item.cb(FailedTextChatRsp(item.req));
+    }
+}
+
+// 长连接上的一条流，OnDone 之后自行释放
+//
+// 注意：
+//   gRPC 不会在 Start* 调用中内联执行 On* 回调，ChatPeerStream 可以持锁调用 Start / Write
+class ChatPeerStream::Call : public grpc::ClientBidiReactor<PeerFrame, PeerFrame> {
+public:
+    explicit Call(ChatPeerStream* owner) : _owner(owner) {}
+
+    void Start(ChatService::Stub* stub, PeerFrame hello)
+    {
+        _hello = std::move(hello);
+        // 对方不可达时等通道连上（通道自带重连退避），而不是立即失败
+        _context.set_wait_for_ready(true);
+        stub->async()->PeerStream(&_context, this);
+        StartWrite(&_hello);
+        StartRead(&_in);
+        StartCall();
+    }
+
+    // 写一帧，上一次写完成之前不能再调用
+    void Write(std::shared_ptr<const PeerFrame> frame)
+    {
+        _out = std::move(frame);
+        StartWrite(_out.get());
+    }
+
+    void Cancel() { _context.TryCancel(); }
+
+    void OnWriteDone(bool ok) override { _owner->OnWriteDone(this, ok); }
+
+    void OnReadDone(bool ok) override
+    {
+        if (!ok) {
+            return;
+        }
+        _owner->OnRead(this, _in);
+        StartRead(&_in);
+    }
+
+    void OnDone(const grpc::Status& status) override
+    {
+        _owner->OnDone(this, status);
+        delete this;
+    }
+
+private:
+    ChatPeerStream* _owner;
+    ClientContext _context;
+    PeerFrame _hello;
+    PeerFrame _in;
+    std::shared_ptr<const PeerFrame> _out;  // 正在写的帧（对方可能在写完成前就确认了它，不能只引用 _unacked）
+};
+
+ChatPeerStream::ChatPeerStream(std::string name, std::string self_name, const std::string& host, const std::string& port,
+    ChatPeerLink* fallback)
+    : _name(std::move(name)), _self_name(std::move(self_name)),
+      _stub(ChatService::NewStub(grpc::CreateChannel(host + ":" + port, grpc::InsecureChannelCredentials()))),
+      _fallback(fallback),
+      _epoch(std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::system_clock::now().time_since_epoch()).count()),
+      _written(0), _next_seq(1), _call(nullptr), _ready(false), _writing(false), _stopped(false),
+      _unsupported(false), _retry_pending(false), _backoff_ms(CHAT_PEER_RECONNECT_MIN_MS)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    ConnectLocked();
+}
+
+ChatPeerStream::~ChatPeerStream()
+{
+    Shutdown();
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cond.wait(lock, [this]() {
+        return _call == nullptr && !_retry_pending;
+        });
+}
+
+bool ChatPeerStream::Enqueue(const TextChatMsgReq& req, const TextChatCallback& cb)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_stopped) {
+            return false;
+        }
+        if (!_unsupported) {
+            if (_pending.size() >= CHAT_PEER_MAX_PENDING) {
+                return false;
+            }
+            _pending.push_back(PendingTextChat{ req, cb });
+            PumpLocked();
+            return true;
+        }
+    }
+    return _fallback->Enqueue(req, cb);
+}
+
+// 关闭：排队和未确认的消息在锁外按 RPCFailed 回调
+void ChatPeerStream::Shutdown()
+{
+    std::vector<std::pair<TextChatCallback, TextChatMsgRsp>> dropped;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_stopped) {
+            return;
+        }
+        _stopped = true;
+        for (auto& item : _unacked) {
+            for (int i = 0; i < item.frame->msgs_size(); ++i) {
+                dropped.emplace_back(std::move(item.callbacks[i]), FailedTextChatRsp(item.frame->msgs(i)));
+            }
+        }
+        for (auto& pending : _pending) {
+            dropped.emplace_back(std::move(pending.cb), FailedTextChatRsp(pending.req));
+        }
+        _pending.clear();
+        _unacked.clear();
+        _written = 0;
+        if (_call != nullptr) {
+            _call->Cancel();
+        }
+        if (_retry_pending) {
+            _retry_alarm.Cancel();
+        }
+    }
+    for (auto& item : dropped) {
+        item.first(item.second);
+    }
+}
+
+void ChatPeerStream::ConnectLocked()
+{
+    PeerFrame hello;
+    hello.set_from_server(_self_name);
+    hello.set_epoch(_epoch);
+    _call = new Call(this);
+    _ready = false;
+    _writing = true;  // 握手帧
+    _written = 0;
+    _call->Start(_stub.get(), std::move(hello));
+}
+
+void ChatPeerStream::PumpLocked()
+{
+    if (_call == nullptr || !_ready || _writing || _stopped) {
+        return;
+    }
+    if (_written == _unacked.size()) {
+        if (_pending.empty() || _unacked.size() >= CHAT_PEER_STREAM_WINDOW) {
+            return;
+        }
+        std::size_t n = std::min<std::size_t>(_pending.size(), CHAT_PEER_MAX_BATCH);
+        auto frame = std::make_shared<PeerFrame>();
+        frame->set_seq(_next_seq++);
+        Frame item;
+        item.callbacks.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            PendingTextChat& pending = _pending.front();
+            *frame->add_msgs() = std::move(pending.req);
+            item.callbacks.push_back(std::move(pending.cb));
+            _pending.pop_front();
+        }
+        item.frame = std::move(frame);
+        _unacked.push_back(std::move(item));
+    }
+    _writing = true;
+    _call->Write(_unacked[_written++].frame);
+}
+
+// 弹出已确认的帧
+//
+// 注意：
+//   续传时对方已处理过、但确认丢在断开的流上的帧没有逐条结果（对方不保存），投递结果未知，
+//   按 RPCFailed 回调，调用方照常走离线收件箱兜底（消息也已入库），不会当成已送达
+void ChatPeerStream::PopAckedLocked(const PeerFrame& ack, std::vector<std::pair<TextChatCallback, TextChatMsgRsp>>& done)
+{
+    while (!_unacked.empty() && _unacked.front().frame->seq() <= ack.ack()) {
+        Frame& item = _unacked.front();
+        const PeerFrame& frame = *item.frame;
+        bool with_results = frame.seq() == ack.ack() && ack.results_size() == frame.msgs_size();
+        for (int i = 0; i < frame.msgs_size(); ++i) {
+            done.emplace_back(std::move(item.callbacks[i]), with_results ? ack.results(i) : FailedTextChatRsp(frame.msgs(i)));
+        }
+        _unacked.pop_front();
+        if (_written > 0) {
+            --_written;
+        }
+    }
+}
+
+void ChatPeerStream::OnWriteDone(Call* call, bool ok)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (call != _call) {
+        return;
+    }
+    _writing = false;
+    // 写失败说明流已断开，OnDone 随后到来
+    if (ok) {
+        PumpLocked();
+    }
+}
+
+// 收到对方的帧：第一帧是握手回复（续传位置），之后都是确认
+void ChatPeerStream::OnRead(Call* call, const PeerFrame& frame)
+{
+    std::vector<std::pair<TextChatCallback, TextChatMsgRsp>> done;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (call != _call) {
+            return;
+        }
+        if (!_ready) {
+            _ready = true;
+            _backoff_ms = CHAT_PEER_RECONNECT_MIN_MS;
+            _written = 0;
+            PopAckedLocked(frame, done);
+            LOG_INFO << "[TextChat][PeerStream] connected target=" << _name << " resume_after=" << frame.ack()
+                     << " resend_frames=" << _unacked.size() << " pending=" << _pending.size();
+        }
+        else {
+            PopAckedLocked(frame, done);
+        }
+        PumpLocked();
+    }
+    for (auto& item : done) {
+        item.first(item.second);
+    }
+}
+
+// 流结束
+//
+// 实现逻辑：
+//   1. 已关闭：通知析构函数
+//   2. 对方不支持 PeerStream：未确认的帧和排队的消息按顺序转交 ChatPeerLink，之后都走单次调用
+//   3. 其他情况：退避后重连，未确认的帧保留，连上后按对方的续传位置重发
+void ChatPeerStream::OnDone(Call* call, const grpc::Status& status)
+{
+    std::vector<PendingTextChat> handoff;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (call == _call) {
+            _call = nullptr;
+            _ready = false;
+            _writing = false;
+        }
+        if (_stopped) {
+            _cond.notify_all();
+            return;
+        }
+        if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED) {
+            LOG_WARN << "[TextChat][PeerStream] target=" << _name << " does not support PeerStream, fall back to unary";
+            _unsupported = true;
+            for (auto& item : _unacked) {
+                for (int i = 0; i < item.frame->msgs_size(); ++i) {
+                    handoff.push_back(PendingTextChat{ item.frame->msgs(i), std::move(item.callbacks[i]) });
+                }
+            }
+            for (auto& pending : _pending) {
+                handoff.push_back(std::move(pending));
+            }
+            _unacked.clear();
+            _pending.clear();
+            _written = 0;
+        }
+        else {
+            LOG_WARN << "[TextChat][PeerStream] stream closed target=" << _name
+                     << " error_code=" << status.error_code() << " error_message=" << status.error_message()
+                     << " unacked_frames=" << _unacked.size() << ", reconnect in " << _backoff_ms << "ms";
+            _retry_pending = true;
+            _retry_alarm.Set(std::chrono::system_clock::now() + std::chrono::milliseconds(_backoff_ms), [this](bool ok) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _retry_pending = false;
+                if (ok && !_stopped) {
+                    ConnectLocked();
+                }
+                _cond.notify_all();
+                });
+            _backoff_ms = std::min(_backoff_ms * 2, CHAT_PEER_RECONNECT_MAX_MS);
+        }
+    }
+    for (auto& item : handoff) {
+        if (!_fallback->Enqueue(item.req, item.cb)) {
+            item.cb(FailedTextChatRsp(item.req));
+        }
+    }
+}
+
 // 构造函数：初始化ChatGrpcClient
 // 
 // 作用：
@@ -21,6 +455,10 @@
 ChatGrpcClient::ChatGrpcClient() {
     auto& cfg = ConfigMgr::Inst();
     auto server_list = cfg["PeerServer"]["Servers"];
+    // 跨服文本消息的通道：stream（长连接，缺省）或 unary（每批一次调用）
+    bool use_stream = cfg["PeerServer"]["Transport"] != "unary";
+    std::string self_name = cfg["SelfServer"]["Name"];
+    std::transform(self_name.begin(), self_name.end(), self_name.begin(), ::tolower);
 
     std::vector<std::string> words;
 
@@ -66,10 +504,44 @@ ChatGrpcClient::ChatGrpcClient() {
             rpc_port = cfg[section]["Port"];
         }
         _pools[name_key] = std::make_unique<ChatConPool>(5, host, rpc_port);
-        std::cout << "[gRPC][Pool] add section=" << section
-                  << " name_key=" << name_key
-                  << " host=" << host
-                  << " rpc_port=" << rpc_port << std::endl;
+        _links[name_key] = std::make_unique<ChatPeerLink>(name_key, host, rpc_port, &_cq);
+        if (use_stream) {
+            _streams[name_key] = std::make_unique<ChatPeerStream>(name_key, self_name, host, rpc_port,
+                _links[name_key].get());
+        }
+        LOG_INFO << "[gRPC][Pool] add section=" << section
+                 << " name_key=" << name_key
+                 << " host=" << host
+                 << " rpc_port=" << rpc_port
+                 << " transport=" << (use_stream ? "stream" : "unary");
+    }
+
+    _cq_thread = std::thread([this]() {
+        DrainCompletionQueue();
+        });
+}
+
+ChatGrpcClient::~ChatGrpcClient()
+{
+    // 长连接先结束（可能把消息转交 ChatPeerLink）；再关闭各通道（不再发出新请求，取消在途请求），
+    // 最后关闭完成队列，线程取完剩余事件后退出
+    _streams.clear();
+    for (auto& kv : _links) {
+        kv.second->Shutdown();
+    }
+    _cq.Shutdown();
+    if (_cq_thread.joinable()) {
+        _cq_thread.join();
+    }
+}
+
+void ChatGrpcClient::DrainCompletionQueue()
+{
+    void* tag = nullptr;
+    bool ok = false;
+    while (_cq.Next(&tag, &ok)) {
+        auto* call = static_cast<ChatBatchCall*>(tag);
+        call->link->OnCallDone(call);
     }
 }
 
@@ -138,13 +610,13 @@ TextChatMsgRsp ChatGrpcClient::NotifyTextChatMsg(std::string server_ip, const Te
     // 查找连接池时统一使用小写键
     std::string key = server_ip;
     std::transform(key.begin(), key.end(), key.begin(), ::tolower);
-    std::cout << "[TextChat][gRPC][Client] call target=" << server_ip
-              << " normalized=" << key << std::endl;
+    LOG_DEBUG << "[TextChat][gRPC][Client] call target=" << server_ip
+              << " normalized=" << key;
     auto find_iter = _pools.find(key);
     if (find_iter == _pools.end()) {
-        std::cout << "[TextChat][gRPC][Client] pool not found for key=" << key << " pools=";
-        for (auto &kv : _pools) std::cout << kv.first << ' ';
-        std::cout << std::endl;
+        std::string pool_names;
+        for (auto &kv : _pools) pool_names += kv.first + ' ';
+        LOG_WARN << "[TextChat][gRPC][Client] pool not found for key=" << key << " pools=" << pool_names;
         rsp.set_error(ErrorCodes::RPCFailed);
         return rsp;
     }
@@ -162,12 +634,38 @@ TextChatMsgRsp ChatGrpcClient::NotifyTextChatMsg(std::string server_ip, const Te
         });
 
     if (!status.ok()) {
-        std::cout << "[TextChat][gRPC][Client] rpc failed ok=false error_code=" << status.error_code()
-                  << " error_message=" << status.error_message() << std::endl;
+        LOG_WARN << "[TextChat][gRPC][Client] rpc failed ok=false error_code=" << status.error_code()
+                 << " error_message=" << status.error_message();
         rsp.set_error(ErrorCodes::RPCFailed);
         return rsp;
     }
-    std::cout << "[TextChat][gRPC][Client] rpc ok" << std::endl;
+    LOG_DEBUG << "[TextChat][gRPC][Client] rpc ok";
 
     return rsp;
 }
+
+void ChatGrpcClient::NotifyTextChatMsgAsync(const std::string& server_name, const TextChatMsgReq& req, TextChatCallback cb)
+{
+    std::string key = server_name;
+    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+    auto stream_iter = _streams.find(key);
+    if (stream_iter != _streams.end()) {
+        if (!stream_iter->second->Enqueue(req, cb)) {
+            LOG_WARN << "[TextChat][PeerStream] queue full target=" << key
+                     << " fromuid=" << req.fromuid() << " touid=" << req.touid();
+            cb(FailedTextChatRsp(req));
+        }
+        return;
+    }
+    auto find_iter = _links.find(key);
+    if (find_iter == _links.end()) {
+        LOG_WARN << "[TextChat][gRPC][Client] link not found for key=" << key;
+        cb(FailedTextChatRsp(req));
+        return;
+    }
+    if (!find_iter->second->Enqueue(req, cb)) {
+        LOG_WARN << "[TextChat][gRPC][Client] link queue full target=" << key
+                 << " fromuid=" << req.fromuid() << " touid=" << req.touid();
+        cb(FailedTextChatRsp(req));
+    }
+}
@@ -8,10 +8,28 @@
 #include<json/reader.h>
 #include"message.grpc.pb.h"
 #include"message.pb.h"
+#include<grpcpp/alarm.h>
 #include<atomic>
+#include<condition_variable>
+#include<deque>
+#include<functional>
+#include<thread>
 #include<unordered_map>
+#include<vector>
 #include"data.h"
 
+// 跨服文本消息每个批量请求最多合并的条数
+#define CHAT_PEER_MAX_BATCH 256
+// 每台目标服务器最多排队的条数，超出时直接按 RPCFailed 回调（消息已入库，对方上线拉取离线消息时补齐）
+#define CHAT_PEER_MAX_PENDING 10000
+// 跨服批量请求的超时（毫秒）
+#define CHAT_PEER_DEADLINE_MS 3000
+// 跨服长连接上已发出未确认的帧数上限（超过后新消息留在排队中，等确认腾出窗口）
+#define CHAT_PEER_STREAM_WINDOW 64
+// 跨服长连接断开后重连的等待时间（毫秒），连续失败时翻倍到上限
+#define CHAT_PEER_RECONNECT_MIN_MS 100
+#define CHAT_PEER_RECONNECT_MAX_MS 5000
+
 // gRPC相关的类型别名
 using grpc::Channel;          // gRPC通道
 using grpc::ClientContext;    // 客户端上下文
@@ -29,6 +47,7 @@ using message::LoginRsp;         // 登录响应
 using message::TextChatMsgReq;    // 文本聊天消息请求
 using message::TextChatMsgRsp;    // 文本聊天消息响应
 using message::TextChatData;     // 文本聊天数据
+using message::PeerFrame;        // 跨服长连接的帧
 
 // ChatConPool类：ChatServer的gRPC客户端连接池
 // 
@@ -113,6 +132,134 @@ private:
     std::condition_variable cond_;                         // 条件变量（用于等待连接）
 };
 
+// 跨服文本消息的回调：rsp.error() 为 Success / RecipientOffline / RPCFailed
+using TextChatCallback = std::function<void(const TextChatMsgRsp& rsp)>;
+
+// 排队等待发出的一条跨服文本消息
+struct PendingTextChat {
+    TextChatMsgReq req;
+    TextChatCallback cb;
+};
+
+struct ChatBatchCall;
+
+// ChatPeerLink：到一台 ChatServer 的异步文本消息通道
+//
+// 作用：
+//   代替在逻辑线程上同步等待 NotifyTextChatMsg：消息入队后立即返回，
+//   同一目标服务器的消息合并成一个批量 TextChatMsgReq（batch 字段）发出
+//
+// 实现逻辑：
+//   1. 同一时刻最多一个请求在途（保证同一对用户之间的消息到达顺序）
+//   2. 没有请求在途时，入队的消息立即发出；有请求在途时先排队，
+//      在途请求完成后把排队的消息（最多 CHAT_PEER_MAX_BATCH 条）合成一个请求发出，
+//      负载越高每批越大，吞吐不再受限于每条消息一个 RTT
+//   3. 只有一条时按原来的单条格式发送
+//   4. 对方未升级（不认识 batch 字段，回包没有 batch）时，该批按单条格式逐条重发，之后每个请求只带一条
+//   5. 完成事件由 ChatGrpcClient 的完成队列线程处理，回调也在该线程中执行，不能阻塞
+class ChatPeerLink {
+public:
+    ChatPeerLink(std::string name, const std::string& host, const std::string& port, grpc::CompletionQueue* cq);
+
+    // 入队一条消息，排队已满或通道已关闭时返回 false（不会调用 cb）
+    bool Enqueue(const TextChatMsgReq& req, const TextChatCallback& cb);
+
+    // 请求完成（完成队列线程调用）：分发回调，接着发出排队的消息
+    void OnCallDone(ChatBatchCall* call);
+
+    // 关闭：排队的消息按 RPCFailed 回调，取消在途请求，之后入队失败
+    void Shutdown();
+
+private:
+    // 把排队的消息合成一个请求发出（调用方持有 _mutex，且没有请求在途）
+    void StartCallLocked();
+
+    std::string _name;
+    std::unique_ptr<ChatService::Stub> _stub;
+    grpc::CompletionQueue* _cq;
+
+    std::mutex _mutex;
+    std::deque<PendingTextChat> _pending;
+    ChatBatchCall* _in_flight;  // 在途请求，完成时由 OnCallDone 释放
+    bool _stopped;
+    bool _legacy;               // 对方不支持 batch，每个请求只带一条
+};
+
+// ChatPeerStream：到一台 ChatServer 的跨服长连接（ChatService.PeerStream 双向流，发起方）
+//
+// 作用：
+//   代替每批消息一次 NotifyTextChatMsg 调用：一条长期存在的流上连续发送投递帧，省掉每次调用的建立开销
+//
+// 实现逻辑：
+//   1. 连接后先发握手帧（本服名 + epoch），对方回复已处理到的 seq，未确认的帧从其后重发（续传）
+//   2. 同一时刻只有一个写操作；写完成时把排队的消息（最多 CHAT_PEER_MAX_BATCH 条）合成下一帧，
+//      已发出未确认的帧超过 CHAT_PEER_STREAM_WINDOW 时停止成帧，等确认腾出窗口（流控）
+//   3. 对方按帧回确认，带每条消息的结果，据此回调；续传时对方已处理过的帧没有结果（当时的确认已丢失），
+//      投递结果未知，按 RPCFailed 回调
+//   4. 流断开后按退避时间重连；对方不支持 PeerStream（UNIMPLEMENTED）时，排队和未确认的消息转交 ChatPeerLink，
+//      之后都走单次调用
+//
+// 注意：
+//   回调在 gRPC 的回调线程中执行，不能阻塞；析构时取消当前流并等待其结束
+class ChatPeerStream {
+public:
+    ChatPeerStream(std::string name, std::string self_name, const std::string& host, const std::string& port,
+        ChatPeerLink* fallback);
+    ~ChatPeerStream();
+
+    ChatPeerStream(const ChatPeerStream&) = delete;
+    ChatPeerStream& operator=(const ChatPeerStream&) = delete;
+
+    // 入队一条消息，排队已满或已关闭时返回 false（不会调用 cb）
+    bool Enqueue(const TextChatMsgReq& req, const TextChatCallback& cb);
+
+    // 关闭：不再发送，排队和未确认的消息按 RPCFailed 回调，取消当前流
+    void Shutdown();
+
+private:
+    class Call;
+    friend class Call;
+
+    // 已成帧、等待对方确认的一帧（重连后从头重发）
+    struct Frame {
+        std::shared_ptr<const PeerFrame> frame;
+        std::vector<TextChatCallback> callbacks;
+    };
+
+    // 以下 *Locked 函数要求调用方持有 _mutex
+    void ConnectLocked();
+    // 写出下一帧（重发的帧优先，其次由排队的消息新成一帧）
+    void PumpLocked();
+    // 弹出 seq 不大于 ack 的帧，回调收集到 done 中（在锁外执行）
+    void PopAckedLocked(const PeerFrame& ack, std::vector<std::pair<TextChatCallback, TextChatMsgRsp>>& done);
+
+    // Call 的回调
+    void OnWriteDone(Call* call, bool ok);
+    void OnRead(Call* call, const PeerFrame& frame);
+    void OnDone(Call* call, const grpc::Status& status);
+
+    std::string _name;
+    std::string _self_name;
+    std::unique_ptr<ChatService::Stub> _stub;
+    ChatPeerLink* _fallback;     // 对方不支持长连接时改走单次调用
+    long long _epoch;            // 本进程的标识（创建时的毫秒时间）
+
+    std::mutex _mutex;
+    std::condition_variable _cond;  // 析构时等待流和重连定时器结束
+    std::deque<PendingTextChat> _pending;
+    std::deque<Frame> _unacked;
+    std::size_t _written;        // _unacked 中在当前流上已写出的帧数
+    long long _next_seq;
+    Call* _call;                 // 当前流，断开后为 nullptr
+    bool _ready;                 // 已收到握手回复
+    bool _writing;
+    bool _stopped;
+    bool _unsupported;           // 对方不支持 PeerStream，全部转交 _fallback
+    grpc::Alarm _retry_alarm;
+    bool _retry_pending;
+    int _backoff_ms;
+};
+
 // ChatGrpcClient类：ChatServer的gRPC客户端
 // 
 // 作用：
@@ -124,7 +271,9 @@ private:
 // 主要功能：
 //   - NotifyAddFriend: 通知添加好友（跨服务器）
 //   - NotifyAuthFriend: 通知认证好友（跨服务器）
-//   - NotifyTextChatMsg: 通知文本聊天消息（跨服务器）
+//   - NotifyTextChatMsg: 通知文本聊天消息（跨服务器，同步）
+//   - NotifyTextChatMsgAsync: 通知文本聊天消息（跨服务器，异步批量，走长连接 ChatPeerStream 或单次调用 ChatPeerLink，
+//     由 [PeerServer] Transport = stream / unary 选择，缺省为 stream）
 //   - GetBaseInfo: 获取用户基础信息
 // 
 // 使用场景：
@@ -134,10 +283,8 @@ class ChatGrpcClient : public Singleton<ChatGrpcClient>
     friend class Singleton<ChatGrpcClient>;  // 允许Singleton访问私有构造函数
 
 public:
-    // 析构函数：清理资源
-    ~ChatGrpcClient() {
-
-    }
+    // 析构函数：取消在途请求，停止完成队列线程
+    ~ChatGrpcClient();
 
     // 通知添加好友（当前未实现）
     AddFriendRsp NotifyAddFriend(std::string server_ip, const AddFriendReq& req);
@@ -151,6 +298,14 @@ public:
     // 通知文本聊天消息（当前未实现）
     TextChatMsgRsp NotifyTextChatMsg(std::string server_ip, const TextChatMsgReq& req);
 
+    // 异步通知文本聊天消息：立即返回，结果通过 cb 回调
+    // 参数：
+    //   - server_name: 目标服务器名（不区分大小写）
+    //   - req: 单条消息请求
+    //   - cb: 完成回调；目标服务器未配置或排队已满时在当前线程中立即以 RPCFailed 回调，
+    //     否则在完成队列线程中回调
+    void NotifyTextChatMsgAsync(const std::string& server_name, const TextChatMsgReq& req, TextChatCallback cb);
+
 private:
     // 私有构造函数：单例模式
     // 从配置文件中读取多个ChatServer的连接信息，为每个ChatServer创建连接池
@@ -158,6 +313,14 @@ private:
 
     // 存储多个ChatServer的连接池（server_name -> connection_pool）
     std::unordered_map<std::string, std::unique_ptr<ChatConPool> > _pools;
+
+    // 处理完成队列事件（在 _cq_thread 中运行）
+    void DrainCompletionQueue();
+
+    grpc::CompletionQueue _cq;                                                // 所有 ChatPeerLink 共用的完成队列
+    std::unordered_map<std::string, std::unique_ptr<ChatPeerLink> > _links;  // 构造后只读（server_name -> 异步通道）
+    std::unordered_map<std::string, std::unique_ptr<ChatPeerStream> > _streams;  // 构造后只读，Transport = unary 时为空
+    std::thread _cq_thread;
 };
 
 
@@ -0,0 +1,307 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "data.h"
+#include "Logger.h"
+
+// 每批最多写入的消息条数
+#define CHAT_MSG_WRITER_BATCH_ROWS 256
+// 队首消息最多等待多少毫秒就写入（不足一批也写）
+#define CHAT_MSG_WRITER_FLUSH_MS 5
+// 每批消息体总字节数上限，保证一条 INSERT 远小于 MySQL 的 max_allowed_packet（旧版本缺省 4MB）
+#define CHAT_MSG_WRITER_BATCH_BYTES (1024 * 1024)
+// 排队上限，超过后 Submit 返回 false
+#define CHAT_MSG_WRITER_CAPACITY 100000
+
+// ChatMsgWriter：聊天消息的攒批写入（group commit）
+//
+// 作用：
+//   原来每条消息一个 INSERT、一个隐式事务，MySQL 每条都要一次网络往返和一次 redo log 刷盘。
+//   这里先把消息攒起来，凑够 N 条或队首等了 T 毫秒后用一条多行 INSERT 写入，一次提交
+//
+// 实现逻辑：
+//   1. Submit 只入队；队列由空变非空、或攒够一批时才唤醒写入线程
+//   2. 写入线程等到队首消息满 T 毫秒或攒够 N 条，取一批（同时受字节数上限约束）交给 batch 写入函数
+//   3. 上一批写入期间到达的消息不再等待，写完立即取下一批，负载越高每批越大
+//   4. 整批失败时逐条重写，避免一条坏数据（如超长消息）连累整批；逐条也失败的才算失败
+//   5. 单个写入线程，消息按提交顺序入库（库内自增 id 与提交顺序一致，离线分页和确认都按这个 id）
+//   6. Stop 时写完队列中剩余的消息再退出
+//
+// 注意：
+//   需要结果的调用方传入 done，写入完成后得到 true / false；不需要的不传，不分配 promise
+class ChatMsgWriter
+{
+public:
+	// 写入一批消息（多行 INSERT），成功返回 true
+	typedef std::function<bool(const std::vector<ChatMsgRow>&)> BatchSink;
+	// 写入单条消息（整批失败后的逐条重试）
+	typedef std::function<bool(const ChatMsgRow&)> RowSink;
+
+	struct Options {
+		std::size_t batch_rows = CHAT_MSG_WRITER_BATCH_ROWS;
+		int flush_ms = CHAT_MSG_WRITER_FLUSH_MS;
+		std::size_t batch_bytes = CHAT_MSG_WRITER_BATCH_BYTES;
+		std::size_t capacity = CHAT_MSG_WRITER_CAPACITY;
+	};
+
+	struct Stats {
+		std::size_t pending = 0;         // 排队中的消息数
+		uint64_t submitted = 0;          // 入队的消息数
+		uint64_t rejected = 0;           // 队列满被拒绝的消息数
+		uint64_t written = 0;            // 写入成功的消息数
+		uint64_t failed = 0;             // 逐条重试后仍失败的消息数
+		uint64_t batches = 0;            // 写入的批数
+		uint64_t fallback_batches = 0;   // 整批失败、改为逐条写入的批数
+		double avg_batch_rows = 0;       // 平均每批条数
+		double avg_flush_ms = 0;         // 平均每批写入耗时
+		double max_flush_ms = 0;         // 最长一批写入耗时
+	};
+
+	ChatMsgWriter(const Options& options, BatchSink batch_sink, RowSink row_sink)
+		: _options(options), _batch_sink(std::move(batch_sink)), _row_sink(std::move(row_sink)),
+		_stop(false), _submitted(0), _rejected(0),
+		_written(0), _failed(0), _batches(0), _fallback_batches(0), _flush_us(0), _max_flush_us(0)
+	{
+		if (_options.batch_rows == 0) {
+			_options.batch_rows = 1;
+		}
+		if (_options.flush_ms < 0) {
+			_options.flush_ms = 0;
+		}
+		_thread = std::thread([this]() { Run(); });
+	}
+
+	~ChatMsgWriter() { Stop(); }
+
+	ChatMsgWriter(const ChatMsgWriter&) = delete;
+	ChatMsgWriter& operator=(const ChatMsgWriter&) = delete;
+
+	// 提交一条消息
+	// 参数：
+	//   - row: 消息
+	//   - done: 可选，输出写入结果的 future
+	// 返回值：
+	//   入队成功返回 true；队列满或已停止返回 false，此时消息不会写入，done 不会被设置
+	bool Submit(ChatMsgRow row, std::future<bool>* done = nullptr)
+	{
+		Pending pending;
+		pending.row = std::move(row);
+		std::future<bool> result;
+		if (done) {
+			pending.done.reset(new std::promise<bool>());
+			result = pending.done->get_future();
+		}
+
+		bool wake = false;
+		{
+			std::lock_guard<std::mutex> lock(_mtx);
+			if (_stop || (_options.capacity > 0 && _queue.size() >= _options.capacity)) {
+				++_rejected;
+				return false;
+			}
+			if (_queue.empty()) {
+				_oldest = std::chrono::steady_clock::now();
+				wake = true;
+			}
+			_queue.push_back(std::move(pending));
+			++_submitted;
+			// 攒够一批时提前唤醒，不等超时
+			wake = wake || _queue.size() == _options.batch_rows;
+		}
+		if (wake) {
+			_cv.notify_one();
+		}
+		if (done) {
+			*done = std::move(result);
+		}
+		return true;
+	}
+
+	// 写完排队中的消息后停止，重复调用不生效
+	void Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mtx);
+			_stop = true;
+		}
+		_cv.notify_one();
+		if (_thread.joinable()) {
+			_thread.join();
+		}
+	}
+
+	Stats Snapshot() const
+	{
+		Stats stats;
+		{
+			std::lock_guard<std::mutex> lock(_mtx);
+			stats.pending = _queue.size();
+			stats.submitted = _submitted;
+			stats.rejected = _rejected;
+		}
+		stats.written = _written.load(std::memory_order_relaxed);
+		stats.failed = _failed.load(std::memory_order_relaxed);
+		stats.batches = _batches.load(std::memory_order_relaxed);
+		stats.fallback_batches = _fallback_batches.load(std::memory_order_relaxed);
+		if (stats.batches > 0) {
+			stats.avg_batch_rows = static_cast<double>(stats.written + stats.failed) / stats.batches;
+			stats.avg_flush_ms = _flush_us.load(std::memory_order_relaxed) / 1000.0 / stats.batches;
+		}
+		stats.max_flush_ms = _max_flush_us.load(std::memory_order_relaxed) / 1000.0;
+		return stats;
+	}
+
+	void LogStats() const
+	{
+		Stats stats = Snapshot();
+		LOG_INFO << "[ChatMsgWriter] pending=" << stats.pending
+			<< " submitted=" << stats.submitted
+			<< " written=" << stats.written
+			<< " failed=" << stats.failed
+			<< " rejected=" << stats.rejected
+			<< " batches=" << stats.batches
+			<< " fallback_batches=" << stats.fallback_batches
+			<< " avg_batch_rows=" << stats.avg_batch_rows
+			<< " avg_flush_ms=" << stats.avg_flush_ms
+			<< " max_flush_ms=" << stats.max_flush_ms;
+	}
+
+private:
+	struct Pending {
+		ChatMsgRow row;
+		std::unique_ptr<std::promise<bool>> done;
+	};
+
+	void Run()
+	{
+		std::vector<ChatMsgRow> rows;
+		std::vector<std::unique_ptr<std::promise<bool>>> dones;
+		rows.reserve(_options.batch_rows);
+		dones.reserve(_options.batch_rows);
+		// 上一批写入期间有消息到达：这些消息已经等过一次写入，直接取
+		bool carry = false;
+
+		for (;;) {
+			std::unique_lock<std::mutex> lock(_mtx);
+			_cv.wait(lock, [this]() { return _stop || !_queue.empty(); });
+			if (_queue.empty()) {
+				break;  // 已停止且队列为空
+			}
+			if (!carry) {
+				auto deadline = _oldest + std::chrono::milliseconds(_options.flush_ms);
+				_cv.wait_until(lock, deadline, [this]() {
+					return _stop || _queue.size() >= _options.batch_rows;
+					});
+			}
+
+			std::size_t bytes = 0;
+			while (!_queue.empty() && rows.size() < _options.batch_rows) {
+				Pending& front = _queue.front();
+				// 至少取一条，超长消息单独成批
+				if (!rows.empty() && bytes + front.row.payload.size() > _options.batch_bytes) {
+					break;
+				}
+				bytes += front.row.payload.size();
+				rows.push_back(std::move(front.row));
+				dones.push_back(std::move(front.done));
+				_queue.pop_front();
+			}
+			carry = !_queue.empty();
+			lock.unlock();
+
+			Flush(rows, dones);
+			rows.clear();
+			dones.clear();
+		}
+	}
+
+	void Flush(const std::vector<ChatMsgRow>& rows, std::vector<std::unique_ptr<std::promise<bool>>>& dones)
+	{
+		auto start = std::chrono::steady_clock::now();
+		uint64_t written = 0;
+		uint64_t failed = 0;
+
+		bool ok = false;
+		try {
+			ok = _batch_sink(rows);
+		}
+		catch (const std::exception& e) {
+			LOG_ERROR << "[ChatMsgWriter] batch write exception: " << e.what();
+		}
+
+		if (ok) {
+			written = rows.size();
+			for (auto& done : dones) {
+				if (done) {
+					done->set_value(true);
+				}
+			}
+		}
+		else {
+			LOG_WARN << "[ChatMsgWriter] batch of " << rows.size() << " rows failed, retry one by one";
+			_fallback_batches.store(_fallback_batches.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			for (std::size_t i = 0; i < rows.size(); ++i) {
+				bool row_ok = false;
+				try {
+					row_ok = _row_sink(rows[i]);
+				}
+				catch (const std::exception& e) {
+					LOG_ERROR << "[ChatMsgWriter] row write exception: " << e.what();
+				}
+				if (row_ok) {
+					++written;
+				}
+				else {
+					++failed;
+					LOG_ERROR << "[ChatMsgWriter] lost msg from uid=" << rows[i].from_uid << " to uid=" << rows[i].to_uid;
+				}
+				if (dones[i]) {
+					dones[i]->set_value(row_ok);
+				}
+			}
+		}
+
+		// 计数只有写入线程修改
+		uint64_t us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start).count());
+		_written.store(_written.load(std::memory_order_relaxed) + written, std::memory_order_relaxed);
+		_failed.store(_failed.load(std::memory_order_relaxed) + failed, std::memory_order_relaxed);
+		_batches.store(_batches.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		_flush_us.store(_flush_us.load(std::memory_order_relaxed) + us, std::memory_order_relaxed);
+		if (us > _max_flush_us.load(std::memory_order_relaxed)) {
+			_max_flush_us.store(us, std::memory_order_relaxed);
+		}
+	}
+
+	Options _options;
+	BatchSink _batch_sink;
+	RowSink _row_sink;
+
+	mutable std::mutex _mtx;
+	std::condition_variable _cv;
+	std::deque<Pending> _queue;
+	std::chrono::steady_clock::time_point _oldest;  // 队首消息入队时间（队列由空变非空时记录）
+	bool _stop;
+	uint64_t _submitted;  // 以下两项由 _mtx 保护
+	uint64_t _rejected;
+
+	std::atomic<uint64_t> _written;
+	std::atomic<uint64_t> _failed;
+	std::atomic<uint64_t> _batches;
+	std::atomic<uint64_t> _fallback_batches;
+	std::atomic<uint64_t> _flush_us;
+	std::atomic<uint64_t> _max_flush_us;
+
+	std::thread _thread;
+};
@@ -14,6 +14,8 @@
 #include<boost/asio.hpp>
 #include<atomic>
 #include"RedisMgr.h"
+#include "AsyncRedisMgr.h"
+#include "RouteCache.h"
 #include "ChatServiceImpl.h"
 #include "const.h"
 #include <filesystem>
@@ -122,6 +124,8 @@ int main()
     std::cout << "trying to load config at: " << (std::filesystem::current_path() / "config_chat2.ini") << std::endl;
 
     auto& cfg = ConfigMgr::Inst();
+    // 运行期日志级别（编译期已去掉的级别无法再打开）
+    Logger::Inst().SetLevel(Logger::ParseLevel(cfg["Log"]["Level"], LogLevel::Info));
     auto server_name = cfg["SelfServer"]["Name"];
     std::transform(server_name.begin(), server_name.end(), server_name.begin(), ::tolower);
 
@@ -135,14 +139,30 @@ int main()
         std::string mysql_url = "tcp://" + mysql_host + ":" + mysql_port_str;
         using MySqlPoolSingleton = Singleton<MySqlPool>;
         auto mysqlPool = MySqlPoolSingleton::GetInstance();
-        // 根据CPU核心数动态设置MySQL连接池大小
-        size_t mysql_pool_size = std::max(16u, std::thread::hardware_concurrency() * 2);
-        std::cout << "[ChatServer] MySQL pool size: " << mysql_pool_size << std::endl;
-        mysqlPool->Init(mysql_url, mysql_user, mysql_passwd, mysql_schema, mysql_pool_size);
+        // 连接池上限缺省按CPU核心数设置，常驻连接数缺省为上限的四分之一，空闲时自动收缩
+        int mysql_pool_max = static_cast<int>(std::max(16u, std::thread::hardware_concurrency() * 2));
+        int mysql_pool_min = std::max(4, mysql_pool_max / 4);
+        int mysql_acquire_timeout_ms = 3000;
+        try {
+            if (!cfg["Mysql"]["PoolMax"].empty()) mysql_pool_max = std::stoi(cfg["Mysql"]["PoolMax"]);
+            if (!cfg["Mysql"]["PoolMin"].empty()) mysql_pool_min = std::stoi(cfg["Mysql"]["PoolMin"]);
+            if (!cfg["Mysql"]["AcquireTimeoutMs"].empty()) mysql_acquire_timeout_ms = std::stoi(cfg["Mysql"]["AcquireTimeoutMs"]);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "[ChatServer] invalid [Mysql] pool config: " << e.what() << std::endl;
+        }
+        LOG_INFO << "[ChatServer] MySQL pool min=" << mysql_pool_min << " max=" << mysql_pool_max;
+        mysqlPool->Init(mysql_url, mysql_user, mysql_passwd, mysql_schema,
+            mysql_pool_min, mysql_pool_max, mysql_acquire_timeout_ms);
 
         // 获取IO服务池单例
         auto pool = AsioIOServicePool::GetInstance();
 
+        // 建立异步 Redis 连接（绑定到 pool 的 io_context，需在 CServer 开始 accept 之前完成）
+        AsyncRedisMgr::GetInstance();
+        // 路由缓存订阅失效频道（PUBLISH 走上面的异步连接）
+        RouteCache::GetInstance()->Start();
+
         // 初始化登录计数为0（在Redis中存储该ChatServer的连接数）
         RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name, "0");
 
@@ -392,7 +412,9 @@ int main()
 
         // 清理资源
         RedisMgr::GetInstance()->HDel(LOGIN_COUNT, server_name);
+        RouteCache::GetInstance()->Stop();
         RedisMgr::GetInstance()->Close();
+        AsyncRedisMgr::GetInstance()->Close();
         grpc_server_thread.join(); // 等待 gRPC 线程退出
         // [FriendNotify]
         if (redis_sub_thread.joinable()) redis_sub_thread.join();
@@ -6,6 +6,7 @@
 #include<json/reader.h>
 #include"RedisMgr.h"
 #include"MysqlMgr.h"
+#include "ClientCodec.h"
 
 // 构造函数：初始化ChatServiceImpl
 ChatServiceImpl::ChatServiceImpl()
@@ -20,9 +21,9 @@ Status ChatServiceImpl::NotifyAddFriend(ServerContext* context, const AddFriendR
     auto session = UserMgr::GetInstance()->GetSession(touid);
 
     // [FriendNotify]
-    std::cout << "[FriendNotify][Chat][gRPC] NotifyAddFriend applyuid=" << request->applyuid()
+    LOG_INFO << "[FriendNotify][Chat][gRPC] NotifyAddFriend applyuid=" << request->applyuid()
         << " to_uid=" << request->touid() << " name=\"" << request->name() << "\""
-        << " has_session=" << std::boolalpha << (session != nullptr) << std::endl;
+        << " has_session=" << std::boolalpha << (session != nullptr);
 
     Defer defer([reply, request]() {
         reply->set_error(ErrorCodes::Success);
@@ -33,7 +34,7 @@ Status ChatServiceImpl::NotifyAddFriend(ServerContext* context, const AddFriendR
     // 用户不在内存中，直接返回
     if (session == nullptr) {
         // [FriendNotify]
-        std::cout << "[FriendNotify][Chat][gRPC] target user offline, skip TCP notify" << std::endl;
+        LOG_INFO << "[FriendNotify][Chat][gRPC] target user offline, skip TCP notify";
         return Status::OK;
     }
 
@@ -45,12 +46,12 @@ Status ChatServiceImpl::NotifyAddFriend(ServerContext* context, const AddFriendR
     rtvalue["name"] = request->name();
     rtvalue["desc"] = request->desc();
 
-    std::string return_str = rtvalue.toStyledString();
+    std::string return_str = ToCompactJson(rtvalue);
 
     // [FriendNotify]
-    std::cout << "[FriendNotify][Chat][gRPC] send TCP notify uid=" << touid
+    LOG_INFO << "[FriendNotify][Chat][gRPC] send TCP notify uid=" << touid
         << " msgid=" << ID_NOTIFY_ADD_FRIEND
-        << " body=" << return_str << std::endl;
+        << " body=" << return_str;
 
     session->Send(return_str, ID_NOTIFY_ADD_FRIEND);
 
@@ -61,55 +62,136 @@ Status ChatServiceImpl::NotifyAddFriend(ServerContext* context, const AddFriendR
 Status ChatServiceImpl::NotifyAuthFriend(ServerContext* context, const AuthFriendReq* request, AuthFriendRsp* response)
 {
     // [FriendNotify]
-    std::cout << "[FriendNotify][Chat][gRPC] NotifyAuthFriend from_uid=" << request->fromuid()
-        << " to_uid=" << request->touid() << std::endl;
+    LOG_INFO << "[FriendNotify][Chat][gRPC] NotifyAuthFriend from_uid=" << request->fromuid()
+        << " to_uid=" << request->touid();
     return Status::OK;
 }
 
+namespace {
+    // 向本服的目标会话下发一条跨服文本消息，目标不在本服时回 RecipientOffline
+    void DeliverTextChat(const TextChatMsgReq& request, TextChatMsgRsp* response)
+    {
+        response->set_error(ErrorCodes::Success);
+        response->set_fromuid(request.fromuid());
+        response->set_touid(request.touid());
+        response->set_msg_id(request.msg_id());
+
+        // 目标用户是否在本服在线
+        auto touid = request.touid();
+        auto session = UserMgr::GetInstance()->GetSession(touid);
+        if (session == nullptr) {
+            LOG_DEBUG << "[TextChat][gRPC] target uid=" << touid << " offline on this server, setting error to RecipientOffline";
+            response->set_error(ErrorCodes::RecipientOffline);
+            return;
+        }
+
+        // 按目标会话协商的编码组装下发内容（protobuf 会话直接由 gRPC 请求编码，不经过 JSON）
+        std::string return_str = ClientCodec::EncodeTextChatMsg(session->GetCodec(), ErrorCodes::Success, request);
+        LOG_DEBUG << "[TextChat][gRPC] send TCP 1019 to uid=" << touid
+                  << " body_len=" << return_str.size();
+        session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
+    }
+}
+
 // 通知文本聊天消息（跨服投递至目标服，再向目标会话下发 1019）
+//
+// 实现逻辑：
+//   batch 非空时是 ChatGrpcClient 合并的批量请求，逐条下发，回包的 batch 按下标对应；
+//   否则按单条处理，回包回显请求内容
 Status ChatServiceImpl::NotifyTextChatMsg(ServerContext* context, const TextChatMsgReq* request, TextChatMsgRsp* response)
 {
+    if (request->batch_size() > 0) {
+        LOG_DEBUG << "[TextChat][gRPC] NotifyTextChatMsg recv batch size=" << request->batch_size();
+        response->set_error(ErrorCodes::Success);
+        for (const auto& item : request->batch()) {
+            DeliverTextChat(item, response->add_batch());
+        }
+        return Status::OK;
+    }
+
     // 诊断：打印收到的 gRPC 通知及目标在线情况（稍后再判断）
-    std::cout << "[TextChat][gRPC] NotifyTextChatMsg recv fromuid=" << request->fromuid()
+    LOG_DEBUG << "[TextChat][gRPC] NotifyTextChatMsg recv fromuid=" << request->fromuid()
               << " touid=" << request->touid()
-              << " msgs=" << request->textmsgs_size() << std::endl;
-    // 统一填充回包（回显请求内容）
-    response->set_error(ErrorCodes::Success);
-    response->set_fromuid(request->fromuid());
-    response->set_touid(request->touid());
+              << " msgs=" << request->textmsgs_size();
+    // 回显请求内容
     for (const auto& text_data : request->textmsgs()) {
         TextChatData* new_msg = response->add_textmsgs();
         new_msg->set_msgid(text_data.msgid());
         new_msg->set_msgcontent(text_data.msgcontent());
     }
+    DeliverTextChat(*request, response);
+    return Status::OK;
+}
 
-    // 目标用户是否在本服在线
-    auto touid = request->touid();
-    auto session = UserMgr::GetInstance()->GetSession(touid);
-    if (session == nullptr) {
-        std::cout << "[TextChat][gRPC] target uid=" << touid << " offline on this server, setting error to RecipientOffline" << std::endl;
-        response->set_error(ErrorCodes::RecipientOffline);
-        return Status::OK;
+std::shared_ptr<ChatServiceImpl::PeerCursor> ChatServiceImpl::GetPeerCursor(const std::string& from_server)
+{
+    std::lock_guard<std::mutex> lock(_peer_mutex);
+    auto& cursor = _peer_cursors[from_server];
+    if (!cursor) {
+        cursor = std::make_shared<PeerCursor>();
     }
+    return cursor;
+}
 
-    // 组装下发给客户端的 JSON
-    Json::Value rtvalue;
-    rtvalue["error"] = ErrorCodes::Success;
-    rtvalue["fromuid"] = request->fromuid();
-    rtvalue["touid"] = request->touid();
-    Json::Value text_array;
-    for (const auto& msg : request->textmsgs()) {
-        Json::Value element;
-        element["content"] = msg.msgcontent();
-        element["msgid"] = msg.msgid();
-        text_array.append(element);
+// 跨服长连接（接收方）
+//
+// 实现逻辑：
+//   1. 第一帧是握手：epoch 与记录的不同（发起方重启过）时续传位置清零，回复 ack = 已处理的最大 seq
+//   2. 之后每个投递帧：seq 不大于续传位置的是重连后重发的帧，只回确认不再下发；
+//      否则逐条下发（与 NotifyTextChatMsg 相同），确认帧带每条的结果
+//   3. 读失败（发起方断开或取消）时结束
+Status ChatServiceImpl::PeerStream(ServerContext* context, grpc::ServerReaderWriter<PeerFrame, PeerFrame>* stream)
+{
+    PeerFrame hello;
+    if (!stream->Read(&hello)) {
+        return Status::OK;
+    }
+    if (hello.from_server().empty()) {
+        LOG_WARN << "[TextChat][PeerStream] first frame is not a hello, peer=" << context->peer();
+        return Status(grpc::StatusCode::INVALID_ARGUMENT, "expect hello frame");
+    }
+    const std::string from = hello.from_server();
+    const long long epoch = hello.epoch();
+    std::shared_ptr<PeerCursor> cursor = GetPeerCursor(from);
+
+    PeerFrame reply;
+    {
+        std::lock_guard<std::mutex> lock(cursor->mutex);
+        if (cursor->epoch != epoch) {
+            cursor->epoch = epoch;
+            cursor->applied = 0;
+        }
+        reply.set_ack(cursor->applied);
+    }
+    LOG_INFO << "[TextChat][PeerStream] open from=" << from << " epoch=" << epoch << " resume_after=" << reply.ack();
+    if (!stream->Write(reply)) {
+        return Status::OK;
     }
-    rtvalue["text_array"] = text_array;
 
-    std::string return_str = rtvalue.toStyledString();
-    std::cout << "[TextChat][gRPC] send TCP 1019 to uid=" << touid
-              << " body_len=" << return_str.size() << std::endl;
-    session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
+    PeerFrame frame;
+    std::size_t frames = 0;
+    while (stream->Read(&frame)) {
+        PeerFrame ack;
+        ack.set_ack(frame.seq());
+        {
+            std::lock_guard<std::mutex> lock(cursor->mutex);
+            // 握手之后对方重启过（另一条流换了 epoch），这条旧流上的帧作废
+            if (cursor->epoch != epoch) {
+                break;
+            }
+            if (frame.seq() > cursor->applied) {
+                for (const auto& msg : frame.msgs()) {
+                    DeliverTextChat(msg, ack.add_results());
+                }
+                cursor->applied = frame.seq();
+            }
+        }
+        ++frames;
+        if (!stream->Write(ack)) {
+            break;
+        }
+    }
+    LOG_INFO << "[TextChat][PeerStream] closed from=" << from << " frames=" << frames;
     return Status::OK;
 }
 
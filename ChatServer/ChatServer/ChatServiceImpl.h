@@ -3,6 +3,9 @@
 #include"message.grpc.pb.h"
 #include"message.pb.h"
 #include<mutex>
+#include<memory>
+#include<string>
+#include<unordered_map>
 #include"const.h"
 #include"data.h"
 
@@ -26,6 +29,7 @@ using message::LoginRsp;         // 登录响应
 using message::TextChatMsgReq;    // 文本聊天消息请求
 using message::TextChatMsgRsp;    // 文本聊天消息响应
 using message::TextChatData;     // 文本聊天数据
+using message::PeerFrame;        // 跨服长连接的帧
 
 // ChatServiceImpl类：ChatServer的gRPC服务实现
 // 
@@ -36,6 +40,7 @@ using message::TextChatData;     // 文本聊天数据
 //   - NotifyAddFriend: 通知添加好友（跨ChatServer）
 //   - NotifyAuthFriend: 通知认证好友（跨ChatServer）
 //   - NotifyTextChatMsg: 通知文本聊天消息（跨ChatServer）
+//   - PeerStream: 跨ChatServer的文本消息长连接（接收方）
 //   - GetBaseInfo: 获取用户基础信息
 // 
 // 设计模式：
@@ -73,6 +78,16 @@ public:
     //   gRPC状态码
     Status NotifyTextChatMsg(ServerContext* context, const TextChatMsgReq* request, TextChatMsgRsp* response) override;
 
+    // 跨服长连接（gRPC双向流，接收方）
+    // 参数：
+    //   - context: gRPC服务上下文
+    //   - stream: 读入发起方的握手帧和投递帧，写回确认帧
+    // 返回值：
+    //   gRPC状态码（第一帧不是握手时返回 INVALID_ARGUMENT）
+    // 注意：
+    //   同步服务，每条流占用一个 gRPC 线程，直到发起方断开
+    Status PeerStream(ServerContext* context, grpc::ServerReaderWriter<PeerFrame, PeerFrame>* stream) override;
+
     // 获取用户基础信息
     // 参数：
     //   - base_key: 基础键名
@@ -83,7 +98,18 @@ public:
     bool GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo);
 
 private:
+    // 每个发起方的续传位置：同一 epoch 内处理过的帧不重复下发
+    struct PeerCursor {
+        std::mutex mutex;      // 处理一帧期间持有（重连时新旧两条流可能短暂并存）
+        long long epoch = 0;
+        long long applied = 0; // 已处理的最大 seq
+    };
+
+    std::shared_ptr<PeerCursor> GetPeerCursor(const std::string& from_server);
 
+    std::mutex _peer_mutex;
+    std::unordered_map<std::string, std::shared_ptr<PeerCursor>> _peer_cursors;  // from_server -> 续传位置
 };
 
 
+
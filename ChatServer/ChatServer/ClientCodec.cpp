@@ -0,0 +1,271 @@
+#include "ClientCodec.h"
+
+bool ClientCodec::ParseCodecName(const std::string& name, WireCodec& codec)
+{
+	if (name == "json") {
+		codec = WireCodec::Json;
+		return true;
+	}
+	if (name == "protobuf") {
+		codec = WireCodec::Protobuf;
+		return true;
+	}
+	return false;
+}
+
+const char* ClientCodec::CodecName(WireCodec codec)
+{
+	return codec == WireCodec::Protobuf ? "protobuf" : "json";
+}
+
+bool ClientCodec::ParseJson(std::string_view data, Json::Value& root)
+{
+	Json::Reader reader;
+	return reader.parse(data.data(), data.data() + data.size(), root) && root.isObject();
+}
+
+bool ClientCodec::DecodeLoginReq(WireCodec codec, std::string_view data, message::LoginReq& req)
+{
+	if (codec == WireCodec::Protobuf) {
+		return req.ParseFromArray(data.data(), static_cast<int>(data.size()));
+	}
+	Json::Value root;
+	if (!ParseJson(data, root)) {
+		return false;
+	}
+	req.set_uid(root["uid"].asInt());
+	req.set_token(root["token"].asString());
+	return true;
+}
+
+std::string ClientCodec::EncodeLoginRsp(WireCodec codec, int error, const UserInfo* userinfo)
+{
+	if (codec == WireCodec::Protobuf) {
+		message::ChatLoginRsp rsp;
+		rsp.set_error(error);
+		if (userinfo) {
+			message::UserInfo* user = rsp.mutable_user();
+			user->set_uid(userinfo->uid);
+			user->set_name(userinfo->name);
+			user->set_email(userinfo->email);
+			user->set_nick(userinfo->nick);
+			user->set_icon(userinfo->icon);
+			user->set_sex(userinfo->sex);
+			user->set_desc(userinfo->desc);
+		}
+		return rsp.SerializeAsString();
+	}
+
+	Json::Value rtvalue;
+	rtvalue["error"] = error;
+	if (userinfo) {
+		rtvalue["uid"] = userinfo->uid;
+		rtvalue["pwd"] = userinfo->pwd;
+		rtvalue["name"] = userinfo->name;
+		rtvalue["email"] = userinfo->email;
+		rtvalue["nick"] = userinfo->nick;
+		rtvalue["desc"] = userinfo->desc;
+		rtvalue["sex"] = userinfo->sex;
+		rtvalue["icon"] = userinfo->icon;
+	}
+	return ToCompactJson(rtvalue);
+}
+
+bool ClientCodec::DecodeTextChatMsg(WireCodec codec, std::string_view data, message::TextChatMsgReq& req)
+{
+	if (codec == WireCodec::Protobuf) {
+		return req.ParseFromArray(data.data(), static_cast<int>(data.size()));
+	}
+	Json::Value root;
+	if (!ParseJson(data, root)) {
+		return false;
+	}
+	TextChatFromJson(root, req);
+	return true;
+}
+
+void ClientCodec::TextChatFromJson(const Json::Value& root, message::TextChatMsgReq& req)
+{
+	req.set_fromuid(root["fromuid"].asInt());
+	req.set_touid(root["touid"].asInt());
+	req.set_msg_id(root["msg_id"].asInt64());
+	for (const auto& txt_obj : root["text_array"]) {
+		auto* text_msg = req.add_textmsgs();
+		text_msg->set_msgid(txt_obj["msgid"].asString());
+		text_msg->set_msgcontent(txt_obj["content"].asString());
+	}
+}
+
+std::string ClientCodec::EncodeTextChatMsg(WireCodec codec, int error, const message::TextChatMsgReq& req)
+{
+	if (codec == WireCodec::Protobuf) {
+		message::TextChatMsgRsp rsp;
+		rsp.set_error(error);
+		rsp.set_fromuid(req.fromuid());
+		rsp.set_touid(req.touid());
+		rsp.set_msg_id(req.msg_id());
+		rsp.mutable_textmsgs()->CopyFrom(req.textmsgs());
+		return rsp.SerializeAsString();
+	}
+
+	Json::Value rtvalue;
+	rtvalue["error"] = error;
+	rtvalue["fromuid"] = req.fromuid();
+	rtvalue["touid"] = req.touid();
+	// 服务端编号之前（如客户端请求的回显）没有 msg_id
+	if (req.msg_id() != 0) {
+		rtvalue["msg_id"] = static_cast<Json::Int64>(req.msg_id());
+	}
+	Json::Value text_array(Json::arrayValue);
+	for (const auto& msg : req.textmsgs()) {
+		Json::Value element;
+		element["content"] = msg.msgcontent();
+		element["msgid"] = msg.msgid();
+		text_array.append(element);
+	}
+	rtvalue["text_array"] = text_array;
+	return ToCompactJson(rtvalue);
+}
+
+std::string ClientCodec::SelectTextChatBody(WireCodec codec, const message::TextChatMsgReq& req, const std::string& json)
+{
+	if (codec == WireCodec::Json) {
+		return json;
+	}
+	return EncodeTextChatMsg(codec, ErrorCodes::Success, req);
+}
+
+// 入库的 JSON 转会话编码
+//
+// 实现逻辑：
+//   JSON 会话原样下发；protobuf 会话按文本消息的字段解析后，带上原错误码重新编码
+bool ClientCodec::ConvertStoredTextChat(WireCodec codec, const std::string& stored, std::string& out)
+{
+	if (codec == WireCodec::Json) {
+		out = stored;
+		return true;
+	}
+	Json::Value root;
+	if (!ParseJson(stored, root)) {
+		return false;
+	}
+	message::TextChatMsgReq req;
+	TextChatFromJson(root, req);
+	out = EncodeTextChatMsg(codec, root["error"].asInt(), req);
+	return true;
+}
+
+std::string ClientCodec::EncodeOfflineMsgBatch(WireCodec codec, const std::vector<std::string>& stored,
+	std::size_t begin, std::size_t end, long long last_id, bool more, const std::string& inbox_id)
+{
+	if (codec == WireCodec::Protobuf) {
+		message::OfflineMsgBatch batch;
+		batch.set_error(ErrorCodes::Success);
+		batch.set_last_id(last_id);
+		batch.set_more(more);
+		batch.set_inbox_id(inbox_id);
+		for (std::size_t i = begin; i < end; ++i) {
+			Json::Value root;
+			if (!ParseJson(stored[i], root)) {
+				continue;
+			}
+			message::TextChatMsgReq req;
+			TextChatFromJson(root, req);
+			message::TextChatMsgRsp* rsp = batch.add_msgs();
+			rsp->set_error(root["error"].asInt());
+			rsp->set_fromuid(req.fromuid());
+			rsp->set_touid(req.touid());
+			rsp->set_msg_id(req.msg_id());
+			rsp->mutable_textmsgs()->Swap(req.mutable_textmsgs());
+		}
+		return batch.SerializeAsString();
+	}
+
+	// 入库的本来就是服务端生成的紧凑 JSON 对象，直接拼成数组
+	std::size_t bytes = 64;
+	for (std::size_t i = begin; i < end; ++i) {
+		bytes += stored[i].size() + 1;
+	}
+	bytes += inbox_id.size();
+	std::string out;
+	out.reserve(bytes);
+	out += "{\"error\":";
+	out += std::to_string(ErrorCodes::Success);
+	out += ",\"last_id\":";
+	out += std::to_string(last_id);
+	out += ",\"more\":";
+	out += more ? "true" : "false";
+	// 条目 ID 只含数字和 '-'，不需要转义
+	if (!inbox_id.empty()) {
+		out += ",\"inbox_id\":\"";
+		out += inbox_id;
+		out += '"';
+	}
+	out += ",\"msgs\":[";
+	bool first = true;
+	for (std::size_t i = begin; i < end; ++i) {
+		if (stored[i].empty()) {
+			continue;
+		}
+		if (!first) {
+			out += ',';
+		}
+		out += stored[i];
+		first = false;
+	}
+	out += "]}";
+	return out;
+}
+
+std::string ClientCodec::EncodeOfflineMsgError(WireCodec codec, int error)
+{
+	if (codec == WireCodec::Protobuf) {
+		message::OfflineMsgBatch batch;
+		batch.set_error(error);
+		batch.set_last_id(0);
+		batch.set_more(false);
+		return batch.SerializeAsString();
+	}
+	return "{\"error\":" + std::to_string(error) + ",\"last_id\":0,\"more\":false,\"msgs\":[]}";
+}
+
+bool ClientCodec::DecodeGetOfflineMsgReq(WireCodec codec, std::string_view data, int& uid)
+{
+	if (codec == WireCodec::Protobuf) {
+		message::GetOfflineMsgReq req;
+		if (!req.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+			return false;
+		}
+		uid = req.uid();
+		return true;
+	}
+	Json::Value root;
+	if (!ParseJson(data, root)) {
+		return false;
+	}
+	uid = root["uid"].asInt();
+	return true;
+}
+
+bool ClientCodec::DecodeOfflineMsgAck(WireCodec codec, std::string_view data, int& uid, long long& max_msg_id,
+	std::string& inbox_id)
+{
+	if (codec == WireCodec::Protobuf) {
+		message::OfflineMsgAck ack;
+		if (!ack.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+			return false;
+		}
+		uid = ack.uid();
+		max_msg_id = ack.max_msg_id();
+		inbox_id = ack.inbox_id();
+		return true;
+	}
+	Json::Value root;
+	if (!ParseJson(data, root)) {
+		return false;
+	}
+	uid = root["uid"].asInt();
+	max_msg_id = root["max_msg_id"].asInt64();
+	inbox_id = root.get("inbox_id", "").asString();
+	return true;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include "const.h"
+#include "data.h"
+#include "message.pb.h"
+
+// ClientCodec：客户端 TCP 消息体的编解码
+//
+// 作用：
+//   同一条业务消息在 JSON 会话和 protobuf 会话上的表示互转，业务处理只面对 message.proto 中的结构，
+//   跨服时同一个 TextChatMsgReq 直接作为 gRPC 请求，不再经过 JSON
+//
+// 约定：
+//   1. 会话缺省为 JSON（老客户端不变），收到 ID_CODEC_NEGOTIATE_REQ {"codec":"protobuf"} 后切换，
+//      协商请求和响应本身始终是 JSON
+//   2. 文本消息入库（MySQL、Redis 离线队列）统一存 JSON，离线拉取时再按会话编码转换，
+//      两种客户端可以互相收发、拉取对方留下的离线消息
+//   3. JSON 的字段名与原协议保持一致（text_array / content / msgid 等）
+class ClientCodec
+{
+public:
+	// 协商：编码名 -> WireCodec（"json" / "protobuf"），未知名字返回false
+	static bool ParseCodecName(const std::string& name, WireCodec& codec);
+	static const char* CodecName(WireCodec codec);
+
+	// 登录请求 {uid, token}
+	static bool DecodeLoginReq(WireCodec codec, std::string_view data, message::LoginReq& req);
+
+	// 登录响应，userinfo 为空时只带错误码
+	// JSON 沿用原有字段（含 pwd，兼容老客户端）；protobuf 的 ChatLoginRsp 不下发密码
+	static std::string EncodeLoginRsp(WireCodec codec, int error, const UserInfo* userinfo);
+
+	// 文本消息请求 {fromuid, touid, text_array[{msgid, content}]}
+	static bool DecodeTextChatMsg(WireCodec codec, std::string_view data, message::TextChatMsgReq& req);
+
+	// 文本消息的回包 / 通知（两者内容相同：error + 原消息 + 服务端 msg_id）
+	static std::string EncodeTextChatMsg(WireCodec codec, int error, const message::TextChatMsgReq& req);
+
+	// 已经生成过 JSON 时直接复用，只有 protobuf 会话才再编码一次
+	static std::string SelectTextChatBody(WireCodec codec, const message::TextChatMsgReq& req, const std::string& json);
+
+	// 入库的 JSON 文本消息转成会话编码（离线拉取时使用）
+	static bool ConvertStoredTextChat(WireCodec codec, const std::string& stored, std::string& out);
+
+	// 离线消息批量帧 {error, last_id, more, msgs[...]}，msgs 为 stored[begin, end) 中入库的 JSON 文本消息
+	// JSON 会话直接拼接入库的 JSON，不逐条解析；protobuf 会话逐条转换，格式错误的跳过
+	// inbox_id 非空时（消息来自 Redis 离线收件箱）带上 inbox_id 字段
+	static std::string EncodeOfflineMsgBatch(WireCodec codec, const std::vector<std::string>& stored,
+		std::size_t begin, std::size_t end, long long last_id, bool more, const std::string& inbox_id = std::string());
+
+	// 离线消息同步出错时的结束帧 {error, last_id:0, more:false, msgs:[]}（客户端不确认带错误码的帧）
+	static std::string EncodeOfflineMsgError(WireCodec codec, int error);
+
+	// 拉取离线消息请求 {uid}
+	static bool DecodeGetOfflineMsgReq(WireCodec codec, std::string_view data, int& uid);
+
+	// 离线消息确认 {uid, max_msg_id, inbox_id}，inbox_id 可缺省
+	static bool DecodeOfflineMsgAck(WireCodec codec, std::string_view data, int& uid, long long& max_msg_id,
+		std::string& inbox_id);
+
+private:
+	static bool ParseJson(std::string_view data, Json::Value& root);
+	static void TextChatFromJson(const Json::Value& root, message::TextChatMsgReq& req);
+};
@@ -0,0 +1,113 @@
+#pragma once
+#include <string>
+#include <json/json.h>
+
+// 紧凑 JSON 序列化
+//
+// 作用：
+//   替代 Json::Value::toStyledString()。StyledWriter 带缩进和换行，每层都要拼接临时字符串，
+//   回包和 Redis 中的缓存因此多出三到五成空白；这里直接向一个 std::string 追加，没有空白，
+//   也不经过 ostream
+//
+// 说明：
+//   1. 键按 Json::Value 内部顺序（字典序）输出，与 toStyledString 一致
+//   2. 字符串只转义 JSON 要求的字符（引号、反斜杠、控制字符），UTF-8 原样输出
+//   3. 浮点数沿用 jsoncpp 的格式化（Json::valueToString），与原输出可互相解析
+
+inline void AppendJsonString(const char* begin, const char* end, std::string& out)
+{
+	static const char kHex[] = "0123456789abcdef";
+	out.push_back('"');
+	const char* run = begin;
+	for (const char* p = begin; p != end; ++p) {
+		unsigned char c = static_cast<unsigned char>(*p);
+		if (c >= 0x20 && c != '"' && c != '\\') {
+			continue;
+		}
+		out.append(run, p);
+		run = p + 1;
+		switch (c) {
+		case '"': out.append("\\\""); break;
+		case '\\': out.append("\\\\"); break;
+		case '\b': out.append("\\b"); break;
+		case '\f': out.append("\\f"); break;
+		case '\n': out.append("\\n"); break;
+		case '\r': out.append("\\r"); break;
+		case '\t': out.append("\\t"); break;
+		default:
+			out.append("\\u00");
+			out.push_back(kHex[c >> 4]);
+			out.push_back(kHex[c & 0x0f]);
+			break;
+		}
+	}
+	out.append(run, end);
+	out.push_back('"');
+}
+
+// 把 value 紧凑序列化后追加到 out
+inline void AppendCompactJson(const Json::Value& value, std::string& out)
+{
+	switch (value.type()) {
+	case Json::nullValue:
+		out.append("null");
+		break;
+	case Json::intValue:
+		out.append(std::to_string(value.asLargestInt()));
+		break;
+	case Json::uintValue:
+		out.append(std::to_string(value.asLargestUInt()));
+		break;
+	case Json::realValue:
+		out.append(Json::valueToString(value.asDouble()));
+		break;
+	case Json::booleanValue:
+		out.append(value.asBool() ? "true" : "false");
+		break;
+	case Json::stringValue: {
+		const char* begin = nullptr;
+		const char* end = nullptr;
+		value.getString(&begin, &end);
+		AppendJsonString(begin, end, out);
+		break;
+	}
+	case Json::arrayValue: {
+		out.push_back('[');
+		Json::ArrayIndex size = value.size();
+		for (Json::ArrayIndex i = 0; i < size; ++i) {
+			if (i != 0) {
+				out.push_back(',');
+			}
+			AppendCompactJson(value[i], out);
+		}
+		out.push_back(']');
+		break;
+	}
+	case Json::objectValue: {
+		out.push_back('{');
+		bool first = true;
+		for (auto it = value.begin(); it != value.end(); ++it) {
+			if (!first) {
+				out.push_back(',');
+			}
+			first = false;
+			char const* name_end = nullptr;
+			char const* name = it.memberName(&name_end);
+			AppendJsonString(name, name_end, out);
+			out.push_back(':');
+			AppendCompactJson(*it, out);
+		}
+		out.push_back('}');
+		break;
+	}
+	}
+}
+
+// 紧凑序列化（回包、写入 Redis 的缓存统一使用）
+inline std::string ToCompactJson(const Json::Value& value)
+{
+	std::string out;
+	out.reserve(256);
+	AppendCompactJson(value, out);
+	return out;
+}
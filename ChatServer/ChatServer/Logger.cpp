@@ -0,0 +1,367 @@
+#include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+namespace {
+
+// 环形缓冲区中每条日志的头部
+struct RecordHeader {
+	uint32_t len;        // 正文长度
+	uint32_t thread_id;  // 写日志线程的编号
+	int64_t time_us;     // 产生时间（微秒）
+	uint8_t level;
+};
+
+const char* LevelName(uint8_t level) {
+	switch (level) {
+	case CHAT_LOG_LEVEL_DEBUG: return "DEBUG";
+	case CHAT_LOG_LEVEL_INFO: return "INFO";
+	case CHAT_LOG_LEVEL_WARN: return "WARN";
+	default: return "ERROR";
+	}
+}
+
+// 格式化一行：时间 [级别] [线程编号] 文件:行号 正文
+// 只有写线程调用，日期时间部分按秒缓存，同一秒内的日志只格式化微秒
+void FormatLine(std::string& out, const RecordHeader& header, const char* body) {
+	static thread_local int64_t cached_second = -1;
+	static thread_local char cached_time[32];
+	int64_t second = header.time_us / 1000000;
+	if (second != cached_second) {
+		std::time_t seconds = static_cast<std::time_t>(second);
+		std::tm tm_time;
+#ifdef _WIN32
+		localtime_s(&tm_time, &seconds);
+#else
+		localtime_r(&seconds, &tm_time);
+#endif
+		std::strftime(cached_time, sizeof(cached_time), "%Y-%m-%d %H:%M:%S", &tm_time);
+		cached_second = second;
+	}
+
+	char prefix[64];
+	int n = std::snprintf(prefix, sizeof(prefix), "%s.%06d [%s] [T%u] ", cached_time,
+		static_cast<int>(header.time_us % 1000000), LevelName(header.level), header.thread_id);
+	out.append(prefix, n > 0 ? static_cast<std::size_t>(n) : 0);
+	out.append(body, header.len);
+	out.push_back('\n');
+}
+
+int64_t NowMicros() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+// LogThreadBuffer：单个线程的日志环形缓冲区
+//
+// 单生产者（所属线程）/ 单消费者（写线程）：
+//   生产者只写 _head，消费者只写 _tail，两者通过 acquire/release 同步，无需加锁
+class LogThreadBuffer
+{
+public:
+	explicit LogThreadBuffer(uint32_t thread_id)
+		: _thread_id(thread_id), _head(0), _tail(0), _retired(false) {
+		_data.reset(new char[CHAT_LOG_THREAD_BUFFER]);
+	}
+
+	// 写入一条日志，空间不足返回 false
+	// crossed_half 输出本次写入是否让已用空间越过一半（用于提示写线程尽快处理，每次越过只提示一次）
+	bool Push(uint8_t level, std::string_view body, bool& crossed_half) {
+		RecordHeader header;
+		header.len = static_cast<uint32_t>(body.size());
+		header.thread_id = _thread_id;
+		header.time_us = NowMicros();
+		header.level = level;
+
+		const uint64_t need = sizeof(RecordHeader) + body.size();
+		const uint64_t head = _head.load(std::memory_order_relaxed);
+		const uint64_t tail = _tail.load(std::memory_order_acquire);
+		if (CHAT_LOG_THREAD_BUFFER - (head - tail) < need) {
+			return false;
+		}
+		CopyIn(head, &header, sizeof(header));
+		CopyIn(head + sizeof(header), body.data(), body.size());
+		_head.store(head + need, std::memory_order_release);
+		crossed_half = (head - tail) <= CHAT_LOG_THREAD_BUFFER / 2 &&
+			(head + need - tail) > CHAT_LOG_THREAD_BUFFER / 2;
+		return true;
+	}
+
+
+	// 取出所有日志并格式化追加到 out / err_out，返回条数
+	std::size_t Drain(std::string& out, std::string& err_out, std::string& scratch) {
+		uint64_t tail = _tail.load(std::memory_order_relaxed);
+		const uint64_t head = _head.load(std::memory_order_acquire);
+		std::size_t count = 0;
+		while (tail < head) {
+			RecordHeader header;
+			CopyOut(tail, &header, sizeof(header));
+			scratch.resize(header.len);
+			CopyOut(tail + sizeof(header), &scratch[0], header.len);
+			FormatLine(header.level >= CHAT_LOG_LEVEL_WARN ? err_out : out, header, scratch.data());
+			tail += sizeof(header) + header.len;
+			++count;
+		}
+		_tail.store(tail, std::memory_order_release);
+		return count;
+	}
+
+	bool Empty() const {
+		return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_relaxed);
+	}
+
+	void Retire() { _retired.store(true, std::memory_order_release); }
+	bool Retired() const { return _retired.load(std::memory_order_acquire); }
+
+private:
+	void CopyIn(uint64_t pos, const void* src, std::size_t len) {
+		std::size_t offset = static_cast<std::size_t>(pos & (CHAT_LOG_THREAD_BUFFER - 1));
+		std::size_t first = std::min<std::size_t>(len, CHAT_LOG_THREAD_BUFFER - offset);
+		std::memcpy(_data.get() + offset, src, first);
+		std::memcpy(_data.get(), static_cast<const char*>(src) + first, len - first);
+	}
+
+	void CopyOut(uint64_t pos, void* dst, std::size_t len) const {
+		std::size_t offset = static_cast<std::size_t>(pos & (CHAT_LOG_THREAD_BUFFER - 1));
+		std::size_t first = std::min<std::size_t>(len, CHAT_LOG_THREAD_BUFFER - offset);
+		std::memcpy(dst, _data.get() + offset, first);
+		std::memcpy(static_cast<char*>(dst) + first, _data.get(), len - first);
+	}
+
+	uint32_t _thread_id;
+	std::unique_ptr<char[]> _data;
+	std::atomic<uint64_t> _head;
+	std::atomic<uint64_t> _tail;
+	std::atomic<bool> _retired;
+};
+
+namespace {
+
+// LogStream 的线程本地格式化缓冲
+thread_local std::string tls_line;
+thread_local bool tls_in_use = false;
+
+// 线程退出时标记缓冲区可回收，剩余日志仍由写线程写出
+struct LocalBufferHolder {
+	std::shared_ptr<LogThreadBuffer> buffer;
+	~LocalBufferHolder() {
+		if (buffer) {
+			buffer->Retire();
+		}
+	}
+};
+
+}  // namespace
+
+// 实例在进程退出时不析构：其他单例的析构函数里仍可能写日志
+Logger& Logger::Inst() {
+	static Logger* logger = []() {
+		Logger* instance = new Logger();
+		std::atexit([]() { Logger::Inst().Shutdown(); });
+		return instance;
+	}();
+	return *logger;
+}
+
+Logger::Logger()
+	: _level(CHAT_LOG_LEVEL_INFO), _dropped(0), _next_thread_id(1), _b_stop(false) {
+	_writer = std::thread(&Logger::WriterLoop, this);
+}
+
+LogLevel Logger::ParseLevel(const std::string& name, LogLevel fallback) {
+	std::string lower(name);
+	std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+	if (lower == "debug") return LogLevel::Debug;
+	if (lower == "info") return LogLevel::Info;
+	if (lower == "warn" || lower == "warning") return LogLevel::Warn;
+	if (lower == "error") return LogLevel::Error;
+	return fallback;
+}
+
+LogThreadBuffer* Logger::LocalBuffer() {
+	thread_local LocalBufferHolder holder;
+	if (!holder.buffer) {
+		holder.buffer = std::make_shared<LogThreadBuffer>(_next_thread_id.fetch_add(1, std::memory_order_relaxed));
+		std::lock_guard<std::mutex> lock(_buffers_mutex);
+		_buffers.push_back(holder.buffer);
+	}
+	return holder.buffer.get();
+}
+
+void Logger::Submit(LogLevel level, std::string_view line) {
+	if (line.size() > CHAT_LOG_MAX_LINE) {
+		line = line.substr(0, CHAT_LOG_MAX_LINE);
+	}
+
+	// 写线程已停止（进程退出阶段）：直接同步输出
+	if (_b_stop.load(std::memory_order_acquire)) {
+		RecordHeader header;
+		header.len = static_cast<uint32_t>(line.size());
+		header.thread_id = 0;
+		header.time_us = NowMicros();
+		header.level = static_cast<uint8_t>(level);
+		std::string out;
+		FormatLine(out, header, line.data());
+		std::fwrite(out.data(), 1, out.size(), level >= LogLevel::Warn ? stderr : stdout);
+		return;
+	}
+
+	LogThreadBuffer* buffer = LocalBuffer();
+	bool crossed_half = false;
+	if (!buffer->Push(static_cast<uint8_t>(level), line, crossed_half)) {
+		_dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	if (crossed_half) {
+		_wake.notify_one();
+	}
+}
+
+std::size_t Logger::Drain(std::string& out, std::string& err_out) {
+	std::vector<std::shared_ptr<LogThreadBuffer>> buffers;
+	{
+		std::lock_guard<std::mutex> lock(_buffers_mutex);
+		buffers = _buffers;
+	}
+
+	std::string scratch;
+	std::size_t count = 0;
+	for (auto& buffer : buffers) {
+		count += buffer->Drain(out, err_out, scratch);
+	}
+
+	// 回收已退出线程的空缓冲区
+	{
+		std::lock_guard<std::mutex> lock(_buffers_mutex);
+		_buffers.erase(std::remove_if(_buffers.begin(), _buffers.end(),
+			[](const std::shared_ptr<LogThreadBuffer>& buffer) {
+				return buffer->Retired() && buffer->Empty();
+			}), _buffers.end());
+	}
+	return count;
+}
+
+// 写线程：每 10ms 或缓冲区过半时写出一批日志
+void Logger::WriterLoop() {
+	std::string out;
+	std::string err_out;
+	uint64_t reported_dropped = 0;
+	for (;;) {
+		bool stopping = _b_stop.load(std::memory_order_acquire);
+		out.clear();
+		err_out.clear();
+		Drain(out, err_out);
+
+		uint64_t dropped = _dropped.load(std::memory_order_relaxed);
+		if (dropped != reported_dropped) {
+			err_out += "[Logger] dropped " + std::to_string(dropped - reported_dropped) + " log lines (buffer full)\n";
+			reported_dropped = dropped;
+		}
+
+		if (!out.empty()) {
+			std::fwrite(out.data(), 1, out.size(), stdout);
+			std::fflush(stdout);
+		}
+		if (!err_out.empty()) {
+			std::fwrite(err_out.data(), 1, err_out.size(), stderr);
+			std::fflush(stderr);
+		}
+
+		if (stopping) {
+			break;
+		}
+		std::unique_lock<std::mutex> lock(_wake_mutex);
+		_wake.wait_for(lock, std::chrono::milliseconds(10));
+	}
+}
+
+void Logger::Shutdown() {
+	bool expected = false;
+	if (!_b_stop.compare_exchange_strong(expected, true)) {
+		return;
+	}
+	_wake.notify_one();
+	if (_writer.joinable()) {
+		_writer.join();
+	}
+}
+
+LogStream::LogStream(LogLevel level, const char* file, int line)
+	: _level(level), _fixed(false), _precision(-1), _line(&_own) {
+	// 同一线程上没有正在格式化的日志时复用线程本地缓冲
+	if (!tls_in_use) {
+		tls_in_use = true;
+		_line = &tls_line;
+		_line->clear();
+	}
+
+	const char* base = std::strrchr(file, '/');
+#ifdef _WIN32
+	const char* win_base = std::strrchr(file, '\\');
+	if (win_base != nullptr && (base == nullptr || win_base > base)) {
+		base = win_base;
+	}
+#endif
+	*this << (base != nullptr ? base + 1 : file) << ':' << line << ' ';
+}
+
+LogStream::~LogStream() {
+	Logger::Inst().Submit(_level, *_line);
+	if (_line != &_own) {
+		_line->clear();
+		tls_in_use = false;
+	}
+}
+
+void LogStream::Append(const char* data, std::size_t len) {
+	if (_line->size() < CHAT_LOG_MAX_LINE) {
+		_line->append(data, std::min(len, CHAT_LOG_MAX_LINE - _line->size()));
+	}
+}
+
+LogStream& LogStream::operator<<(const void* value) {
+	char buf[32];
+	int n = std::snprintf(buf, sizeof(buf), "%p", value);
+	Append(buf, n > 0 ? static_cast<std::size_t>(n) : 0);
+	return *this;
+}
+
+LogStream& LogStream::operator<<(double value) {
+	char buf[64];
+	int n = 0;
+	if (_fixed) {
+		n = std::snprintf(buf, sizeof(buf), "%.*f", _precision >= 0 ? _precision : 6, value);
+	}
+	else if (_precision >= 0) {
+		n = std::snprintf(buf, sizeof(buf), "%.*g", _precision, value);
+	}
+	else {
+		n = std::snprintf(buf, sizeof(buf), "%g", value);
+	}
+	Append(buf, n > 0 ? static_cast<std::size_t>(n) : 0);
+	return *this;
+}
+
+LogStream& LogStream::operator<<(std::ios_base& (*manip)(std::ios_base&)) {
+	if (manip == static_cast<std::ios_base& (*)(std::ios_base&)>(std::fixed)) {
+		_fixed = true;
+	}
+	else if (manip == static_cast<std::ios_base& (*)(std::ios_base&)>(std::defaultfloat)) {
+		_fixed = false;
+	}
+	return *this;
+}
+
+LogStream& LogStream::operator<<(decltype(std::setprecision(0)) precision) {
+	// setprecision 的返回类型由实现定义，借助一个临时流取出精度值
+	std::ostringstream oss;
+	oss << precision;
+	_precision = static_cast<int>(oss.precision());
+	return *this;
+}
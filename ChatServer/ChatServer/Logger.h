@@ -0,0 +1,175 @@
+#pragma once
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <cstdint>
+#include <iomanip>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// 日志级别
+#define CHAT_LOG_LEVEL_DEBUG 0
+#define CHAT_LOG_LEVEL_INFO  1
+#define CHAT_LOG_LEVEL_WARN  2
+#define CHAT_LOG_LEVEL_ERROR 3
+
+// 编译期最低日志级别：低于该级别的 LOG_xxx 语句整体被编译器删除（参数也不会求值）
+// Release 构建（定义了 NDEBUG）默认去掉 DEBUG，可通过 -DCHAT_LOG_MIN_LEVEL=n 覆盖
+#ifndef CHAT_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define CHAT_LOG_MIN_LEVEL CHAT_LOG_LEVEL_INFO
+#else
+#define CHAT_LOG_MIN_LEVEL CHAT_LOG_LEVEL_DEBUG
+#endif
+#endif
+
+// 每个线程日志环形缓冲区大小（字节，必须是 2 的幂），写满时新日志被丢弃并计数
+#define CHAT_LOG_THREAD_BUFFER (256 * 1024)
+// 单条日志最大长度，超出部分截断
+#define CHAT_LOG_MAX_LINE 4096
+
+enum class LogLevel : uint8_t {
+	Debug = CHAT_LOG_LEVEL_DEBUG,
+	Info = CHAT_LOG_LEVEL_INFO,
+	Warn = CHAT_LOG_LEVEL_WARN,
+	Error = CHAT_LOG_LEVEL_ERROR,
+};
+
+class LogThreadBuffer;
+
+// Logger：异步日志
+//
+// 作用：
+//   替代热路径上的 std::cout << ... << std::endl（每行一次加锁 + flush）
+//
+// 实现逻辑：
+//   1. 每个线程第一次写日志时注册一个单生产者/单消费者环形缓冲区，写日志只做 memcpy
+//      和一次 release store，不加锁
+//   2. 后台写线程轮询所有缓冲区，格式化时间戳后批量写到 stdout/stderr（WARN 以上），
+//      每批只 flush 一次
+//   3. 缓冲区写满时丢弃新日志并计入 Dropped()，不阻塞业务线程
+//   4. 进程退出时（atexit）停止写线程并写出剩余日志，之后的日志直接同步输出
+class Logger
+{
+public:
+	static Logger& Inst();
+
+	// 运行期级别过滤（编译期过滤之外的第二道），默认 INFO
+	void SetLevel(LogLevel level) { _level.store(static_cast<int>(level), std::memory_order_relaxed); }
+	bool Enabled(LogLevel level) const {
+		return static_cast<int>(level) >= _level.load(std::memory_order_relaxed);
+	}
+
+	// 提交一行日志（不含换行）
+	void Submit(LogLevel level, std::string_view line);
+
+	// 因缓冲区满被丢弃的日志条数
+	uint64_t Dropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+	// 停止写线程并写出所有剩余日志（幂等）
+	void Shutdown();
+
+	// 从字符串解析级别（debug/info/warn/error），无法识别时返回 fallback
+	static LogLevel ParseLevel(const std::string& name, LogLevel fallback);
+
+private:
+	Logger();
+
+	LogThreadBuffer* LocalBuffer();
+	void WriterLoop();
+	// 写出所有缓冲区中的日志，返回写出的条数
+	std::size_t Drain(std::string& out, std::string& err_out);
+
+	std::atomic<int> _level;
+	std::atomic<uint64_t> _dropped;
+
+	std::mutex _buffers_mutex;
+	std::vector<std::shared_ptr<LogThreadBuffer>> _buffers;
+	std::atomic<uint32_t> _next_thread_id;
+
+	std::mutex _wake_mutex;
+	std::condition_variable _wake;
+	std::atomic<bool> _b_stop;
+	std::thread _writer;
+};
+
+// LogStream：单条日志的格式化器
+//
+// 在线程本地的 std::string 上追加内容（容量复用，不逐条分配），析构时提交给 Logger。
+// 常见类型直接格式化，其余类型经 operator<<(std::ostream&) 兜底。
+class LogStream
+{
+public:
+	LogStream(LogLevel level, const char* file, int line);
+	~LogStream();
+
+	LogStream(const LogStream&) = delete;
+	LogStream& operator=(const LogStream&) = delete;
+
+	LogStream& operator<<(std::string_view value) { Append(value.data(), value.size()); return *this; }
+	LogStream& operator<<(const std::string& value) { Append(value.data(), value.size()); return *this; }
+	LogStream& operator<<(const char* value) {
+		if (value != nullptr) {
+			Append(value, std::char_traits<char>::length(value));
+		}
+		return *this;
+	}
+	LogStream& operator<<(char* value) { return *this << static_cast<const char*>(value); }
+	LogStream& operator<<(char value) { Append(&value, 1); return *this; }
+	LogStream& operator<<(bool value) { return *this << (value ? "true" : "false"); }
+	LogStream& operator<<(const void* value);
+
+	template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+	LogStream& operator<<(T value) {
+		char buf[24];
+		auto result = std::to_chars(buf, buf + sizeof(buf), value);
+		Append(buf, result.ptr - buf);
+		return *this;
+	}
+
+	LogStream& operator<<(double value);
+	LogStream& operator<<(float value) { return *this << static_cast<double>(value); }
+
+	// 支持 std::fixed / std::setprecision 控制浮点格式；std::endl 等流操纵符被忽略（每条日志自动换行）
+	LogStream& operator<<(std::ios_base& (*manip)(std::ios_base&));
+	LogStream& operator<<(std::ostream& (*)(std::ostream&)) { return *this; }
+	LogStream& operator<<(decltype(std::setprecision(0)) precision);
+
+	template <typename T, typename std::enable_if<!std::is_integral<T>::value && !std::is_floating_point<T>::value &&
+		!std::is_pointer<T>::value && !std::is_function<T>::value &&
+		!std::is_same<T, decltype(std::setprecision(0))>::value &&
+		!std::is_convertible<const T&, std::string_view>::value, int>::type = 0>
+	LogStream& operator<<(const T& value) {
+		std::ostringstream oss;
+		oss << value;
+		std::string text = oss.str();
+		Append(text.data(), text.size());
+		return *this;
+	}
+
+private:
+	void Append(const char* data, std::size_t len);
+
+	LogLevel _level;
+	bool _fixed;         // 是否使用定点格式
+	int _precision;      // 浮点精度，-1 表示默认
+	std::string _own;    // 嵌套日志（格式化参数时又写日志）时使用的独立缓冲
+	std::string* _line;
+};
+
+// 日志宏：if 条件在编译期为常量时整条语句（包括 << 右侧的表达式）被删除
+#define CHAT_LOG_IF(level_value, level_enum) \
+	if ((level_value) < CHAT_LOG_MIN_LEVEL || !Logger::Inst().Enabled(level_enum)) {} \
+	else LogStream(level_enum, __FILE__, __LINE__)
+
+#define LOG_DEBUG CHAT_LOG_IF(CHAT_LOG_LEVEL_DEBUG, LogLevel::Debug)
+#define LOG_INFO  CHAT_LOG_IF(CHAT_LOG_LEVEL_INFO, LogLevel::Info)
+#define LOG_WARN  CHAT_LOG_IF(CHAT_LOG_LEVEL_WARN, LogLevel::Warn)
+#define LOG_ERROR CHAT_LOG_IF(CHAT_LOG_LEVEL_ERROR, LogLevel::Error)
@@ -1,52 +1,132 @@
 #include "LogicSystem.h"
 #include "RedisMgr.h"
+#include "AsyncRedisMgr.h"
+#include "RouteCache.h"
+#include "ClientCodec.h"
 #include "MysqlMgr.h"
 #include "UserMgr.h"
 #include "AsyncDBPool.h"
+#include "OfflineInbox.h"
+#include "OfflineSync.h"
 
 #include "ChatGrpcClient.h"
+#include "ConfigMgr.h"
+
+namespace {
+
+// 读取数值配置项，未配置或格式错误时返回缺省值
+std::size_t ReadConfigNumber(const std::string& value, std::size_t fallback)
+{
+	if (value.empty()) {
+		return fallback;
+	}
+	try {
+		return std::stoul(value);
+	}
+	catch (const std::exception&) {
+		LOG_WARN << "[LogicSystem] invalid number in config: " << value;
+		return fallback;
+	}
+}
+
+}
 
 // 析构函数：清理资源
 // 
 // 实现逻辑：
-//   1. 设置停止标志
-//   2. 通知工作线程退出
-//   3. 等待工作线程结束
+//   依次停止各工作线程，每个线程会先处理完队列中剩余的消息再退出；
+//   工作线程全部退出后不会再有新消息提交，最后把攒批中的消息写完
 LogicSystem::~LogicSystem()
 {
-	_b_stop = true;
-	_consume.notify_one();
-	_worker_thread.join();
+	for (auto& worker : _workers) {
+		worker->Stop();
+	}
+	_msg_writer->Stop();
 }
 
 // 投递消息到队列
 // 
 // 参数：
-//   - msg: 消息节点指针
+//   - msg: 消息节点
 // 
 // 实现逻辑：
-//   1. 加锁保证线程安全
-//   2. 将消息加入到队列
-//   3. 如果队列只有一条消息，通知工作线程处理
-void LogicSystem::PostMsgToQue(std::shared_ptr<LogicNode> msg)
+//   1. 按会话句柄取模选出工作线程，同一会话的消息总是进入同一队列，保证顺序
+//   2. 投递到该线程的队列（队列由空变非空时才唤醒线程）
+void LogicSystem::PostMsgToQue(LogicNode msg)
 {
-	std::unique_lock<std::mutex> unique_lk(_mutex);
-	_msg_que.push(msg);
+	std::size_t idx = static_cast<std::size_t>(msg._session->GetHandle() % _workers.size());
+	_workers[idx]->Post(std::move(msg));
+}
 
-	// 如果队列只有一条消息，通知工作线程
-	if (_msg_que.size() == 1) {
-		_consume.notify_one();
-	}
+// 投递任务到会话所属的工作线程
+// 
+// 实现逻辑：
+//   包装成只带任务的 LogicNode，按同样的会话句柄入队，DealMsg 识别后直接执行
+void LogicSystem::PostTask(std::shared_ptr<CSession> session, std::function<void()> task)
+{
+	PostMsgToQue(LogicNode(std::move(session), std::move(task)));
 }
 
 // 构造函数：初始化逻辑系统
 // 
 // 实现逻辑：
 //   1. 注册回调函数
-//   2. 启动工作线程
-LogicSystem::LogicSystem() :_b_stop(false) {
+//   2. 读取 [LogicSystem] WorkerCount（缺省为 CPU 核数），启动对应数量的工作线程
+//   3. 按 [MsgWriter] 配置启动聊天消息的攒批写入线程
+//   4. 按 [SelfServer] MsgWorkerId 创建消息 ID 生成器
+LogicSystem::LogicSystem() {
 	RegisterCallBacks();
-	_worker_thread = std::thread(&LogicSystem::DealMsg, this);
+
+	auto& cfg = ConfigMgr::Inst();
+	// 各 ChatServer 的编号必须不同；未配置时由服务器名散列得到，可能与其他服务器冲突
+	std::string worker_str = cfg["SelfServer"]["MsgWorkerId"];
+	uint32_t worker_id = 0;
+	if (worker_str.empty()) {
+		worker_id = static_cast<uint32_t>(std::hash<std::string>()(cfg["SelfServer"]["Name"]) & MsgIdGenerator::kWorkerMask);
+		LOG_WARN << "[LogicSystem] [SelfServer] MsgWorkerId not set, use " << worker_id << " hashed from server name";
+	}
+	else {
+		worker_id = static_cast<uint32_t>(ReadConfigNumber(worker_str, 0));
+		if (worker_id > MsgIdGenerator::kWorkerMask) {
+			LOG_WARN << "[LogicSystem] MsgWorkerId " << worker_id << " exceeds " << MsgIdGenerator::kWorkerMask << ", truncated";
+		}
+	}
+	_msg_ids.reset(new MsgIdGenerator(worker_id));
+	LOG_INFO << "[LogicSystem] msg id worker=" << _msg_ids->WorkerId();
+
+	ChatMsgWriter::Options writer_options;
+	writer_options.batch_rows = ReadConfigNumber(cfg["MsgWriter"]["BatchRows"], writer_options.batch_rows);
+	writer_options.flush_ms = static_cast<int>(ReadConfigNumber(cfg["MsgWriter"]["FlushIntervalMs"], writer_options.flush_ms));
+	writer_options.batch_bytes = ReadConfigNumber(cfg["MsgWriter"]["BatchBytes"], writer_options.batch_bytes);
+	writer_options.capacity = ReadConfigNumber(cfg["MsgWriter"]["QueueCapacity"], writer_options.capacity);
+	_msg_writer.reset(new ChatMsgWriter(writer_options,
+		[](const std::vector<ChatMsgRow>& rows) { return MysqlMgr::GetInstance()->SaveChatMessages(rows); },
+		[](const ChatMsgRow& row) {
+			return MysqlMgr::GetInstance()->SaveChatMessage(row.from_uid, row.to_uid, row.payload, row.msg_id);
+		}));
+	LOG_INFO << "[LogicSystem] msg writer batch_rows=" << writer_options.batch_rows
+		<< " flush_ms=" << writer_options.flush_ms << " capacity=" << writer_options.capacity;
+
+	std::size_t worker_count = std::thread::hardware_concurrency();
+	std::string count_str = ConfigMgr::Inst()["LogicSystem"]["WorkerCount"];
+	if (!count_str.empty()) {
+		try {
+			worker_count = std::stoul(count_str);
+		}
+		catch (const std::exception&) {
+			LOG_WARN << "[LogicSystem] invalid WorkerCount: " << count_str;
+		}
+	}
+	if (worker_count == 0) {
+		worker_count = 1;
+	}
+
+	for (std::size_t i = 0; i < worker_count; ++i) {
+		_workers.emplace_back(new LogicWorker<LogicNode>(
+			[this](LogicNode& node) { DealMsg(node); }));
+	}
+	LOG_INFO << "[LogicSystem] started " << worker_count << " workers";
+
 	AsyncDBPool::GetInstance()->Init();
 }
 
@@ -69,6 +149,37 @@ void LogicSystem::RegisterCallBacks() {
 
 	_fun_callbacks[ID_NOTIFY_TEXT_CHAT_MSG_RSP] = std::bind(&LogicSystem::OfflineMsgAckHandler, this,
 		std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+
+	_fun_callbacks[ID_CODEC_NEGOTIATE_REQ] = std::bind(&LogicSystem::CodecNegotiateHandler, this,
+		std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+}
+
+// 消息体编码协商
+// 
+// 实现逻辑：
+//   1. 请求和响应始终是 JSON：{"codec":"protobuf"} -> {"error":0,"codec":"protobuf"}
+//   2. 先用 JSON 回复，再切换会话编码；同一会话的消息在同一工作线程上按序处理，
+//      客户端收到响应后发出的消息一定按新编码解析
+//   3. 不支持的编码回复 Error_Json，会话保持原编码
+void LogicSystem::CodecNegotiateHandler(std::shared_ptr<CSession> session, const short& msg_id, std::string_view msg_data)
+{
+	Json::Reader reader;
+	Json::Value root;
+	Json::Value rtvalue;
+	WireCodec codec = session->GetCodec();
+	if (!reader.parse(msg_data.data(), msg_data.data() + msg_data.size(), root)
+		|| !ClientCodec::ParseCodecName(root["codec"].asString(), codec)) {
+		rtvalue["error"] = ErrorCodes::Error_Json;
+		rtvalue["codec"] = ClientCodec::CodecName(session->GetCodec());
+		session->Send(ToCompactJson(rtvalue), ID_CODEC_NEGOTIATE_RSP);
+		return;
+	}
+
+	rtvalue["error"] = ErrorCodes::Success;
+	rtvalue["codec"] = ClientCodec::CodecName(codec);
+	session->Send(ToCompactJson(rtvalue), ID_CODEC_NEGOTIATE_RSP);
+	session->SetCodec(codec);
+	LOG_DEBUG << "[Codec] session " << session->GetHandle() << " switched to " << ClientCodec::CodecName(codec);
 }
 
 // 登录处理函数
@@ -76,244 +187,254 @@ void LogicSystem::RegisterCallBacks() {
 // 功能：
 //   验证用户token，获取用户信息，建立会话
 // 
-// 实现逻辑：
-//   1. 解析JSON消息，获取uid和token
-//   2. 从Redis验证token
-//   3. 获取用户基础信息（优先从Redis获取，没有则从MySQL获取）
-//   4. 更新登录计数（Redis中的LOGIN_COUNT）
-//   5. 建立用户会话映射（UserMgr、CSession、Redis）
-//   6. 发送登录成功响应
-void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const short& msg_id, const std::string& msg_data) {
-	Json::Reader reader;
-	Json::Value root;
-	reader.parse(msg_data, root);
-	int uid = root["uid"].asInt();
-	std::string token = root["token"].asString();
-	std::cout << "[LoginHandler] recv uid=" << uid << " token=" << token << std::endl;
+// 实现逻辑（异步续接，Redis 往返期间不占用工作线程）：
+//   1. 按会话编码解析消息，获取uid和token
+//   2. GET utoken_ 和 GET ubaseinfo_ 合并成一个 pipeline（一次往返），回复到达后投递回
+//      本会话的工作线程，由 LoginTokenChecked 继续
+//   3. 登录结束前本会话的其他消息由 DealMsg 暂存，结束后（FinishLogin）再按顺序处理
+void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const short& msg_id, std::string_view msg_data) {
+	LoginReq req;
+	if (!ClientCodec::DecodeLoginReq(session->GetCodec(), msg_data, req)) {
+		LOG_WARN << "[LoginHandler] bad login request, session=" << session->GetHandle();
+		session->Send(ClientCodec::EncodeLoginRsp(session->GetCodec(), ErrorCodes::Error_Json, nullptr), MSG_CHAT_LOGIN_RSP);
+		return;
+	}
+	int uid = req.uid();
+	std::string token = req.token();
+	LOG_DEBUG << "[LoginHandler] recv uid=" << uid << " token=" << token;
 
-	Json::Value rtvalue;
-	// 校验 token 是否存在于 redis
+	// 校验 token 是否存在于 redis，同时预取用户基础信息缓存
 	std::string uid_str = std::to_string(uid);
-	std::string token_key = USERTOKENPREFIX + uid_str;
-	std::string token_value;
-	bool success = RedisMgr::GetInstance()->Get(token_key, token_value);
-	if (!success) {
-		rtvalue["error"] = ErrorCodes::UidInvalid;
-		std::string return_str = rtvalue.toStyledString();
-		std::cout << "[LoginHandler TEST] send before return, body=" << return_str
-			<< " msgid=" << MSG_CHAT_LOGIN_RSP << std::endl;
+	session->BeginLogin();
+	AsyncRedisMgr::GetInstance()->Pipeline({
+		{ "GET", USERTOKENPREFIX + uid_str },
+		{ "GET", USER_BASE_INFO + uid_str } },
+		[this, session, uid, token](std::vector<RedisValue> replies) {
+			PostTask(session, [this, session, uid, token, replies]() {
+				if (!LoginTokenChecked(session, uid, token, replies[0], replies[1])) {
+					FinishLogin(session);
+				}
+				});
+		});
+}
+
+// 登录第二步（工作线程）
+// 
+// 实现逻辑：
+//   1. 校验 token 是否存在且匹配
+//   2. 获取用户基础信息（优先使用预取的Redis缓存，没有则从MySQL获取）
+//   3. HINCRBY 登录计数 + SET uip_ + 路由失效广播合并成一个 pipeline 发出（一次往返，计数由 Redis 原子累加）
+//   4. pipeline 完成后回到工作线程建立会话映射（UserMgr、CSession）并发送登录成功响应
+bool LogicSystem::LoginTokenChecked(std::shared_ptr<CSession> session, int uid, const std::string& token,
+	const RedisValue& token_reply, const RedisValue& base_reply) {
+	WireCodec codec = session->GetCodec();
+	if (!token_reply.IsString()) {
+		std::string return_str = ClientCodec::EncodeLoginRsp(codec, ErrorCodes::UidInvalid, nullptr);
+		LOG_DEBUG << "[LoginHandler TEST] send before return, body=" << return_str
+			<< " msgid=" << MSG_CHAT_LOGIN_RSP;
 		session->Send(return_str, MSG_CHAT_LOGIN_RSP);
-		return;
+		return false;
 	}
 	// 验证token是否匹配
-	if (token_value != token) {
-		rtvalue["error"] = ErrorCodes::TokenInvalid;
-		std::string return_str = rtvalue.toStyledString();
-		std::cout << "[LoginHandler TEST] send before return, body=" << return_str
-			<< " msgid=" << MSG_CHAT_LOGIN_RSP << std::endl;
+	if (token_reply.str != token) {
+		std::string return_str = ClientCodec::EncodeLoginRsp(codec, ErrorCodes::TokenInvalid, nullptr);
+		LOG_DEBUG << "[LoginHandler TEST] send before return, body=" << return_str
+			<< " msgid=" << MSG_CHAT_LOGIN_RSP;
 		session->Send(return_str, MSG_CHAT_LOGIN_RSP);
-		return;
+		return false;
 	}
 
 	// token 验证成功，获取用户信息
-	rtvalue["error"] = ErrorCodes::Success;
-
+	std::string uid_str = std::to_string(uid);
 	std::string base_key = USER_BASE_INFO + uid_str;
 	auto user_info = std::make_shared<UserInfo>();
-	bool b_base = GetBaseInfo(base_key, uid, user_info);
+	bool b_base = GetBaseInfo(base_key, uid, base_reply, user_info);
 	if (!b_base) {
-		rtvalue["error"] = ErrorCodes::UidInvalid;
-		std::string return_str = rtvalue.toStyledString();
-		std::cout << "[LoginHandler TEST] send before return, body=" << return_str
-			<< " msgid=" << MSG_CHAT_LOGIN_RSP << std::endl;
+		std::string return_str = ClientCodec::EncodeLoginRsp(codec, ErrorCodes::UidInvalid, nullptr);
+		LOG_DEBUG << "[LoginHandler TEST] send before return, body=" << return_str
+			<< " msgid=" << MSG_CHAT_LOGIN_RSP;
 		session->Send(return_str, MSG_CHAT_LOGIN_RSP);
-		return;
+		return false;
 	}
 
 	// 设置返回的用户信息
-	rtvalue["uid"] = uid;
-	rtvalue["pwd"] = user_info->pwd;
-	rtvalue["name"] = user_info->name;
-	rtvalue["email"] = user_info->email;
-	rtvalue["nick"] = user_info->nick;
-	rtvalue["desc"] = user_info->desc;
-	rtvalue["sex"] = user_info->sex;
-	rtvalue["icon"] = user_info->icon;
+	user_info->uid = uid;
+	std::string return_str = ClientCodec::EncodeLoginRsp(codec, ErrorCodes::Success, user_info.get());
 
 	// 更新登录计数和状态
 	auto server_name = ConfigMgr::Inst().GetValue("SelfServer", "Name");
 	std::transform(server_name.begin(), server_name.end(), server_name.begin(), ::tolower);
 
-	// 从Redis读取当前登录计数并加1
-	auto rd_res = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, server_name);
-	int count = 0;
-	if (!rd_res.empty()) {
-		try { count = std::stoi(rd_res); }
-		catch (...) { count = 0; }
-	}
-	++count;
-	RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name, std::to_string(count));
-
-	// 在 session中写入 ipkey，同时在 session 和 UserMgr 建立映射
-	session->SetUserId(uid);
+	// 路由变更：SET uip_ 之后在同一 pipeline 里广播路由失效，其他服务器删除缓存的旧路由
 	std::string ipkey = USERIPPREFIX + uid_str;
-	RedisMgr::GetInstance()->Set(ipkey, server_name);
-	UserMgr::GetInstance()->SetUserSession(uid, session);
-
-	// 统一返回统一发送成功包
-	std::string return_str = rtvalue.toStyledString();
-	std::cout << "[LoginHandler TEST] send success, uid=" << uid
-		<< " body=" << return_str << " msgid=" << MSG_CHAT_LOGIN_RSP << std::endl;
-	session->Send(return_str, MSG_CHAT_LOGIN_RSP);
-
-	return;
+	RouteCache::GetInstance()->Invalidate(uid);
+	AsyncRedisMgr::GetInstance()->Pipeline({
+		{ "HINCRBY", LOGIN_COUNT, server_name, "1" },
+		{ "SET", ipkey, server_name },
+		{ "PUBLISH", ROUTE_INVALIDATION_CHANNEL, CacheInvalidationSync::InvalidationMessage(uid) } },
+		[this, session, uid, return_str](std::vector<RedisValue> replies) {
+			if (replies[1].IsError()) {
+				LOG_WARN << "[LoginHandler] SET uip failed uid=" << uid << " err=" << replies[1].str;
+			}
+			// 在 session 和 UserMgr 建立映射，统一发送成功包
+			PostTask(session, [this, session, uid, return_str]() {
+				session->SetUserId(uid);
+				UserMgr::GetInstance()->SetUserSession(uid, session);
+				LOG_DEBUG << "[LoginHandler TEST] send success, uid=" << uid
+					<< " body=" << return_str << " msgid=" << MSG_CHAT_LOGIN_RSP;
+				session->Send(return_str, MSG_CHAT_LOGIN_RSP);
+				FinishLogin(session);
+				});
+		});
+	return true;
 }
 
 
 
-void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, const std::string& msg_data)
+void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, std::string_view msg_data)
 {
-	Json::Reader reader;
-	Json::Value root;
-	reader.parse(msg_data, root);
-
-	int uid = root["fromuid"].asInt();
-	int touid = root["touid"].asInt();
-	const Json::Value arrays = root["text_array"];
-
-	Json::Value rtvalue;
-	rtvalue["error"] = ErrorCodes::Success;
-	rtvalue["text_array"] = arrays;
-	rtvalue["fromuid"] = uid;
-	rtvalue["touid"] = touid;
-
-	// 统一构造用于下发和持久化的 JSON 文本
-	std::string notify_str_cache = rtvalue.toStyledString();
-
-	Defer defer([this, &rtvalue, session]() {
-		std::string return_str = rtvalue.toStyledString();
-		session->Send(return_str, ID_TEXT_CHAT_MSG_RSP);
+	// 两种编码都解析成 TextChatMsgReq，跨服时直接作为 gRPC 请求
+	TextChatMsgReq text_msg_req;
+	if (!ClientCodec::DecodeTextChatMsg(session->GetCodec(), msg_data, text_msg_req)) {
+		LOG_WARN << "[TextChat] bad text chat request, session=" << session->GetHandle();
+		return;
+	}
+	int uid = text_msg_req.fromuid();
+	int touid = text_msg_req.touid();
+	// 在入库和转发之前编号：库、收件箱、在线通知、跨服请求和发送方的回包都带同一个 msg_id
+	text_msg_req.set_msg_id(_msg_ids->Next());
+
+	// 持久化和离线队列统一存 JSON（与收发双方的编码无关），JSON 会话的回包和通知也直接复用
+	std::string notify_str_cache = ClientCodec::EncodeTextChatMsg(WireCodec::Json, ErrorCodes::Success, text_msg_req);
+
+	int error = ErrorCodes::Success;
+	Defer defer([&text_msg_req, &notify_str_cache, &error, session]() {
+		if (error != ErrorCodes::Success) {
+			session->Send(ClientCodec::EncodeTextChatMsg(session->GetCodec(), error, text_msg_req), ID_TEXT_CHAT_MSG_RSP);
+			return;
+		}
+		session->Send(ClientCodec::SelectTextChatBody(session->GetCodec(), text_msg_req, notify_str_cache),
+			ID_TEXT_CHAT_MSG_RSP);
 		});
 
+	// 入库的 JSON 放不进一帧离线消息时对方离线后收不到（中文内容入库时会被转义，比原文长得多），直接拒绝；
+	// 回包不带消息内容，否则回包本身也可能超过客户端的缓冲区
+	if (!OfflinePayloadFits(notify_str_cache)) {
+		LOG_WARN << "[TextChat] msg too large (" << notify_str_cache.size() << " bytes), reject msg from uid="
+			<< uid << " to uid=" << touid;
+		text_msg_req.clear_textmsgs();
+		error = ErrorCodes::MsgTooLarge;
+		return;
+	}
+
 	// 先持久化，再投递。
 	// 无论对方是在线、离线还是跨服，先将消息入库 (Status=0)。
 	// 这样保证了消息不丢失。当对方收到消息回 ACK 时，再将其删除。
-	AsyncDBPool::GetInstance()->PostTask([uid, touid, notify_str_cache]() {
-		MysqlMgr::GetInstance()->SaveChatMessage(uid, touid, notify_str_cache);
-		});
+	// 入库由 ChatMsgWriter 攒批完成（最多等 [MsgWriter] FlushIntervalMs），多条消息合成一次 INSERT
+	bool accepted = _msg_writer->Submit(ChatMsgRow{ uid, touid, notify_str_cache, text_msg_req.msg_id() });
+	// 写入队列已满：不投递，回 ServerBusy 让发送方重试，避免对方收到一条没有落库的消息
+	if (!accepted) {
+		LOG_WARN << "[TextChat] db queue full, reject msg from uid=" << uid << " to uid=" << touid;
+		error = ErrorCodes::ServerBusy;
+		return;
+	}
 
-	std::string to_ip_key = USERIPPREFIX + std::to_string(touid);
+	// 路由查询走本地缓存，稳态下不访问 Redis
 	std::string to_ip_value;
-	bool b_ip = RedisMgr::GetInstance()->Get(to_ip_key, to_ip_value);
+	bool b_ip = RouteCache::GetInstance()->GetRoute(touid, to_ip_value);
 	if (!b_ip) {
-		std::cout << "[TextChat][Route] redis miss key=" << to_ip_key << " -> no route (msg saved)" << std::endl;
+		LOG_DEBUG << "[TextChat][Route] no route for uid=" << touid << " (msg saved)";
 		return;
 	}
 
 	auto server_name = ConfigMgr::Inst().GetValue("SelfServer", "Name");
 	std::transform(server_name.begin(), server_name.end(), server_name.begin(), ::tolower);
-	std::cout << "[TextChat][Route] to_ip=" << to_ip_value << " self=" << server_name
-		<< " same_server=" << std::boolalpha << (to_ip_value == server_name) << std::endl;
+	LOG_DEBUG << "[TextChat][Route] to_ip=" << to_ip_value << " self=" << server_name
+		<< " same_server=" << std::boolalpha << (to_ip_value == server_name);
 
 	if (to_ip_value == server_name) {
 		auto to_sess = UserMgr::GetInstance()->GetSession(touid);
 		if (to_sess) {
-			std::cout << "[TextChat][Route] local deliver TCP 1019 to uid=" << touid
-				<< " body_len=" << notify_str_cache.size() << std::endl;
-			to_sess->Send(notify_str_cache, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
+			std::string notify_body = ClientCodec::SelectTextChatBody(to_sess->GetCodec(), text_msg_req, notify_str_cache);
+			LOG_DEBUG << "[TextChat][Route] local deliver TCP 1019 to uid=" << touid
+				<< " body_len=" << notify_body.size();
+			to_sess->Send(notify_body, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
 		}
 		else {
-			// 用户在本机，但离线，存入Redis离线消息（加速拉取）
-			std::string offline_key = OFFLINE_MSG_PREFIX + std::to_string(touid);
-			RedisMgr::GetInstance()->LPush(offline_key, notify_str_cache);
-			std::cout << "[OfflineMsg] user " << touid << " is offline, saved message to redis key=" << offline_key << std::endl;
+			// 用户在本机，但离线，存入 Redis 离线收件箱（加速拉取）
+			OfflineInbox::GetInstance()->Append(touid, notify_str_cache);
+			LOG_DEBUG << "[OfflineMsg] user " << touid << " is offline, saved message to inbox " << OfflineInbox::Key(touid);
 		}
 		return;
 	}
 
-	TextChatMsgReq text_msg_req;
-	text_msg_req.set_fromuid(uid);
-	text_msg_req.set_touid(touid);
-	for (const auto& txt_obj : arrays) {
-		auto content = txt_obj["content"].asString();
-		auto msgid = txt_obj["msgid"].asString();
-		auto* text_msg = text_msg_req.add_textmsgs();
-		text_msg->set_msgid(msgid);
-		text_msg->set_msgcontent(content);
-	}
-
-	std::cout << "[TextChat][Route] cross-server deliver via gRPC target=" << to_ip_value
+	LOG_DEBUG << "[TextChat][Route] cross-server deliver via gRPC target=" << to_ip_value
 		<< " fromuid=" << uid << " touid=" << touid
-		<< " msgs=" << arrays.size() << std::endl;
-	auto rsp = ChatGrpcClient::GetInstance()->NotifyTextChatMsg(to_ip_value, text_msg_req);
-
-	// 如果RPC调用成功，但业务逻辑返回对方离线
-	if (rsp.error() == ErrorCodes::RecipientOffline) {
-		std::cout << "[TextChat][Route] gRPC target offline, saving to local redis" << std::endl;
-		// 将消息存入本地Redis的离线消息队列（加速拉取）
-		std::string offline_key = OFFLINE_MSG_PREFIX + std::to_string(touid);
-		RedisMgr::GetInstance()->LPush(offline_key, notify_str_cache);
-	}
+		<< " msgs=" << text_msg_req.textmsgs_size();
+	// 异步转发，不在逻辑线程上等待 RTT；同一目标服务器的消息由 ChatPeerLink 合批发送
+	// 回调在 gRPC 完成队列线程中执行，只做不阻塞的操作
+	ChatGrpcClient::GetInstance()->NotifyTextChatMsgAsync(to_ip_value, text_msg_req,
+		[touid, notify_str_cache](const TextChatMsgRsp& rsp) {
+			// 对方离线，或者投递失败 / 结果未知（RPCFailed）：存入 Redis 离线收件箱（加速拉取）
+			// 已经送达的消息再进收件箱也没关系，拉取时与库里同一条消息去重
+			if (rsp.error() == ErrorCodes::RecipientOffline || rsp.error() == ErrorCodes::RPCFailed) {
+				LOG_DEBUG << "[TextChat][Route] gRPC target offline or unreachable (error=" << rsp.error()
+					<< "), saving to local redis";
+				OfflineInbox::GetInstance()->Append(touid, notify_str_cache);
+			}
+		});
 }
 
-void LogicSystem::GetOfflineMsgHandler(std::shared_ptr<CSession> session, const short& msg_id, const std::string& msg_data)
+void LogicSystem::GetOfflineMsgHandler(std::shared_ptr<CSession> session, const short& msg_id, std::string_view msg_data)
 {
-	Json::Reader reader;
-	Json::Value root;
-	reader.parse(msg_data, root);
-	int uid = root["uid"].asInt();
-
-	std::cout << "[OfflineMsg] recv get offline msg req, uid=" << uid << std::endl;
-
-	std::string offline_key = OFFLINE_MSG_PREFIX + std::to_string(uid);
-	std::vector<std::string> messages;
-	RedisMgr::GetInstance()->GetAllList(offline_key, messages);
-
-	std::cout << "[OfflineMsg] get " << messages.size() << " offline messages for uid=" << uid << std::endl;
+	int uid = 0;
+	if (!ClientCodec::DecodeGetOfflineMsgReq(session->GetCodec(), msg_data, uid)) {
+		LOG_WARN << "[OfflineMsg] bad get offline msg request, session=" << session->GetHandle();
+		return;
+	}
 
-	// 使用 weak_ptr 防止回调时 session 已销毁
-	std::weak_ptr<CSession> weak_sess = session;
+	LOG_DEBUG << "[OfflineMsg] recv get offline msg req, uid=" << uid;
 
-	// 投递异步任务到 DB 线程池
-	AsyncDBPool::GetInstance()->PostTask([uid, weak_sess]() {
-		// 在 DB 线程中执行
-		std::shared_ptr<CSession> shared_sess = weak_sess.lock();
-		if (!shared_sess) {
-			std::cout << "[OfflineMsg][Async] session expired, abort db query for uid=" << uid << std::endl;
-			return;
-		}
+	// 旧版本的 offline_msg_ 列表已由收件箱代替，里面的消息 MySQL 中都有，拉取时顺手删掉
+	AsyncRedisMgr::GetInstance()->Command({ "DEL", OFFLINE_MSG_PREFIX + std::to_string(uid) }, nullptr);
 
-		std::vector<long long> ids;
-		std::vector<std::string> db_payloads;
-		
-		// 当前逻辑只在返回 true 时下发离线消息；如果 DB 出现异常导致返回 false，
-		// 不会向客户端返回任何错误信息，也没有做重试控制（例如指数退避重试）。
-		// 阻塞式查询，但现在是在 Worker 线程中，不会阻塞主 Logic 线程
-		if (MysqlMgr::GetInstance()->GetUnreadChatMessages(uid, ids, db_payloads)) {
-			std::cout << "[OfflineMsg][Async] get " << db_payloads.size() << " unread messages for uid=" << uid << std::endl;
-			
-			for (const auto& payload : db_payloads) {
-				shared_sess->Send(payload, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
-			}
-		}
-	});
+	// 收件箱与数据库合并去重后分页下发，见 OfflineSync
+	// 本会话已有同步在运行时拒绝（它会下发同样的消息），回一个错误帧
+	if (!OfflineSync::Start(session, uid)) {
+		LOG_WARN << "[OfflineMsg] offline sync already running, uid=" << uid << " session=" << session->GetHandle();
+		session->Send(ClientCodec::EncodeOfflineMsgError(session->GetCodec(), ErrorCodes::ServerBusy),
+			ID_NOTIFY_OFFLINE_MSG_BATCH);
+	}
 }
 
-void LogicSystem::OfflineMsgAckHandler(std::shared_ptr<CSession> session, const short& msg_id, const std::string& msg_data)
+void LogicSystem::OfflineMsgAckHandler(std::shared_ptr<CSession> session, const short& msg_id, std::string_view msg_data)
 {
-	Json::Reader reader;
-	Json::Value root;
-	reader.parse(msg_data, root);
-	// 客户端回包格式: { "uid": 1001, "max_msg_id": 10005 }
-	int uid = root["uid"].asInt();
-	long long max_msg_id = root["max_msg_id"].asInt64();
+	// 客户端回包格式: { "uid": 1001, "max_msg_id": 10005 }（protobuf 会话为 OfflineMsgAck）
+	int uid = 0;
+	long long max_msg_id = 0;
+	std::string inbox_id;
+	if (!ClientCodec::DecodeOfflineMsgAck(session->GetCodec(), msg_data, uid, max_msg_id, inbox_id)) {
+		LOG_WARN << "[OfflineMsg][Ack] bad ack, session=" << session->GetHandle();
+		return;
+	}
 	
-	std::cout << "[OfflineMsg][Ack] recv ack for uid=" << uid << " max_msg_id=" << max_msg_id << std::endl;
+	LOG_DEBUG << "[OfflineMsg][Ack] recv ack for uid=" << uid << " max_msg_id=" << max_msg_id << " inbox_id=" << inbox_id;
+
+	// 收件箱帧的确认：删掉已确认的条目
+	if (!inbox_id.empty()) {
+		OfflineInbox::GetInstance()->Ack(uid, inbox_id);
+	}
+	if (max_msg_id <= 0) {
+		return;
+	}
 
-	// 异步更新 DB 状态
-	AsyncDBPool::GetInstance()->PostTask([uid, max_msg_id]() {
+	// 异步更新 DB 状态（High 车道）。被拒绝时消息保持未读，下次拉取会重复下发，由客户端按 msgid 去重
+	bool accepted = AsyncDBPool::GetInstance()->PostTask([uid, max_msg_id]() {
 		MysqlMgr::GetInstance()->AckOfflineMessages(uid, max_msg_id);
-		});
+		}, TaskPriority::High);
+	if (!accepted) {
+		LOG_WARN << "[OfflineMsg][Ack] db queue full, drop ack for uid=" << uid << " max_msg_id=" << max_msg_id;
+	}
 }
 
 // 获取用户基础信息
@@ -321,25 +442,23 @@ void LogicSystem::OfflineMsgAckHandler(std::shared_ptr<CSession> session, const
 // 参数：
 //   - base_key: Redis键名（USER_BASE_INFO + uid）
 //   - uid: 用户ID
+//   - cached: 已在登录 pipeline 中取回的 GET base_key 结果
 //   - userinfo: 输出参数，用户信息
 // 
 // 返回值：
 //   成功返回true，否则返回false
 // 
 // 实现逻辑：
-//   1. 先从Redis获取用户信息（提高性能）
+//   1. 先使用Redis缓存的用户信息（提高性能）
 //   2. 如果Redis没有，从MySQL查询
-//   3. 将从MySQL查询到的用户信息写入Redis（缓存）
-bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo)
+//   3. 将从MySQL查询到的用户信息写入Redis（缓存，异步发出不等待回复）
+bool LogicSystem::GetBaseInfo(std::string base_key, int uid, const RedisValue& cached, std::shared_ptr<UserInfo>& userinfo)
 {
-	// 先查 Redis
-	std::string info_str = "";
-	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
-	if (b_base) {
+	if (cached.IsString()) {
 		// Redis中有数据，解析JSON
 		Json::Reader reader;
 		Json::Value root;
-		reader.parse(info_str, root);
+		reader.parse(cached.str, root);
 		userinfo = std::make_shared<UserInfo>();
 		userinfo->uid = root["uid"].asInt();
 		userinfo->name = root["name"].asString();
@@ -350,8 +469,8 @@ bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<Use
 		userinfo->desc = root.isMember("desc") ? root["desc"].asString() : "";
 		userinfo->sex = root.isMember("sex") ? root["sex"].asInt() : 0;
 		userinfo->icon = root.isMember("icon") ? root["icon"].asString() : "";
-		std::cout << "user login uid is " << userinfo->uid << " user name is " << userinfo->name
-			<< " user email is " << userinfo->email << " pwd is " << userinfo->pwd << std::endl;
+		LOG_DEBUG << "user login uid is " << userinfo->uid << " user name is " << userinfo->name
+			<< " user email is " << userinfo->email << " pwd is " << userinfo->pwd;
 	}
 	else {
 		// Redis 没有数据，从 MySQL 查询
@@ -370,59 +489,59 @@ bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<Use
 		redis_root["desc"] = userinfo->desc; // 空值
 		redis_root["sex"] = userinfo->sex;   // 0
 		redis_root["icon"] = userinfo->icon; // 空值
-		RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
+		AsyncRedisMgr::GetInstance()->Command({ "SET", base_key, ToCompactJson(redis_root) }, nullptr);
 	}
 	return true;
 }
 
-// 处理消息（在工作线程中运行）
+// 处理一条消息（由 LogicWorker 在锁外调用）
 // 
 // 实现逻辑：
-//   1. 无限循环，等待消息
-//   2. 队列为空且未停止时，等待条件变量
-//   3. 如果已停止，处理完剩余消息后退出
-//   4. 从队列中取出消息，根据消息ID查找回调函数
-//   5. 调用回调函数处理消息
-void LogicSystem::DealMsg()
+//   1. 带任务的节点（PostTask 投递的异步续接）直接执行任务
+//   2. 会话正在登录时暂存消息，登录结束后由 FinishLogin 处理；暂存过多时关闭连接
+//   3. 否则根据消息ID查找回调函数并调用，未注册的消息直接丢弃
+void LogicSystem::DealMsg(LogicNode& msg_node)
 {
-	for (;;) {
-		std::unique_lock<std::mutex> unique_lk(_mutex);
+	if (msg_node._task) {
+		msg_node._task();
+		return;
+	}
 
-		// 判断队列为空，等待条件变量唤醒
-		while (_msg_que.empty() && !_b_stop) {
-			_consume.wait(unique_lk);
+	if (msg_node._session->LoginPending()) {
+		if (!msg_node._session->HoldMsg(std::move(msg_node._recvnode))) {
+			LOG_WARN << "[LoginHandler] too many messages before login finished, close session="
+				<< msg_node._session->GetHandle();
+			msg_node._session->Close();
 		}
+		return;
+	}
+	Dispatch(msg_node._session, msg_node._recvnode);
+}
 
-		// 判断系统为关闭状态，取出消息队列中的所有剩余数据，处理完再退出循环
-		if (_b_stop) {
-			while (!_msg_que.empty()) {
-				auto msg_node = _msg_que.front();
-				std::cout << "recv msg id is" << msg_node->_recvnode->_msg_id << std::endl;
-				auto call_back_iter = _fun_callbacks.find(msg_node->_recvnode->_msg_id);
-				if (call_back_iter == _fun_callbacks.end()) {
-					_msg_que.pop();
-					continue;
-				}
-				call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id,
-					std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
-				_msg_que.pop();
-			}
+void LogicSystem::Dispatch(const std::shared_ptr<CSession>& session, const RecvNode& node)
+{
+	LOG_DEBUG << "recv msg id is" << node._msg_id;
 
-			break;
-		}
+	auto call_back_iter = _fun_callbacks.find(node._msg_id);
+	if (call_back_iter == _fun_callbacks.end()) {
+		return;
+	}
 
-		// 如果没有停止，且消息队列不空，取出一条处理
-		auto msg_node = _msg_que.front();
-		std::cout << "recv msg id is" << msg_node->_recvnode->_msg_id << std::endl;
+	call_back_iter->second(session, node._msg_id, node.Body());
+}
 
-		auto call_back_iter = _fun_callbacks.find(msg_node->_recvnode->_msg_id);
-		if (call_back_iter == _fun_callbacks.end()) {
-			_msg_que.pop();
+// 登录结束
+//
+// 注意：
+//   暂存的消息里可能还有登录请求，处理后会话又进入登录状态，剩下的消息重新暂存
+void LogicSystem::FinishLogin(const std::shared_ptr<CSession>& session)
+{
+	std::vector<RecvNode> held = session->EndLogin();
+	for (auto& node : held) {
+		if (session->LoginPending()) {
+			session->HoldMsg(std::move(node));
 			continue;
 		}
-
-		call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id,
-			std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
-		_msg_que.pop();
+		Dispatch(session, node);
 	}
 }
@@ -8,25 +8,32 @@
 #include"data.h"
 #include<memory>
 #include<string>
+#include<string_view>
 #include"StatusGrpcClient.h"
 #include "CSession.h"
+#include "LogicWorker.h"
+#include "RespCodec.h"
+#include "ChatMsgWriter.h"
+#include "MsgIdGenerator.h"
+#include <vector>
 
 // 前向声明
 class CSession;
 class LogicNode;
+class RecvNode;
 
 // 消息节点类型定义：用于处理消息的回调函数
 // 参数：
 //   - session: CSession对象
 //   - msg_id: 消息ID
 //   - msg_data: 消息数据
-typedef std::function<void(std::shared_ptr<CSession>, const short& msg_id, const std::string& msg_data)> FunCallBack;
+typedef std::function<void(std::shared_ptr<CSession>, const short& msg_id, std::string_view msg_data)> FunCallBack;
 
 // LogicSystem类：逻辑系统，处理业务逻辑
 // 
 // 作用：
 //   1. 接收网络层投递的消息
-//   2. 在独立的工作线程中处理消息
+//   2. 按会话哈希分发到 N 个工作线程中处理消息（同一会话固定落在同一线程，保证消息顺序）
 //   3. 根据消息ID调用对应的处理函数
 // 
 // 设计模式：
@@ -35,7 +42,8 @@ typedef std::function<void(std::shared_ptr<CSession>, const short& msg_id, const
 // 
 // 主要功能：
 //   - 注册和调用消息处理回调函数
-//   - 异步处理消息（使用队列和条件变量）
+//   - 异步处理消息（每个工作线程独立的队列和条件变量，见 LogicWorker）
+//   - 工作线程数由配置 [LogicSystem] WorkerCount 指定，缺省为 CPU 核数
 //   - 用户登录验证
 class LogicSystem : public Singleton<LogicSystem>
 {
@@ -46,10 +54,28 @@ public:
 
     // 投递消息到队列
     // 参数：
-    //   - msg: 消息节点指针
+    //   - msg: 消息节点（按值传递，消息体是接收缓冲块内的视图）
     // 作用：
-    //   将消息加入到处理队列，通知工作线程处理
-    void PostMsgToQue(std::shared_ptr<LogicNode> msg);
+    //   按会话句柄选出工作线程，将消息加入其处理队列
+    void PostMsgToQue(LogicNode msg);
+
+    // 投递任务到会话所属的工作线程
+    // 参数：
+    //   - session: 会话对象（决定落在哪个工作线程，与该会话的消息同一队列）
+    //   - task: 任务
+    // 作用：
+    //   异步回调（如 AsyncRedisMgr 的回复，运行在 IO 线程）借此回到逻辑线程继续处理
+    void PostTask(std::shared_ptr<CSession> session, std::function<void()> task);
+
+    // 工作线程数量
+    std::size_t WorkerCount() const { return _workers.size(); }
+
+    // 输出消息攒批写入的统计和消息 ID 逻辑时钟的超前量（由 CServer 的统计定时器调用）
+    void LogStats() const
+    {
+        _msg_writer->LogStats();
+        LOG_INFO << "[MsgId] worker=" << _msg_ids->WorkerId() << " ahead_ms=" << _msg_ids->AheadMs();
+    }
 
 private:
     // 私有构造函数：初始化逻辑系统
@@ -58,37 +84,50 @@ private:
     // 注册回调函数
     void RegisterCallBacks();
 
-    // 处理消息（在工作线程中运行）
-    void DealMsg();
+    // 处理一条消息（在工作线程中运行）
+    void DealMsg(LogicNode& msg_node);
+
+    // 按消息ID调用处理函数
+    void Dispatch(const std::shared_ptr<CSession>& session, const RecvNode& node);
+
+    // 登录结束（成功或失败）：按顺序处理登录期间暂存的消息
+    void FinishLogin(const std::shared_ptr<CSession>& session);
+
+    // 消息体编码协商（JSON / protobuf），见 ClientCodec
+    void CodecNegotiateHandler(std::shared_ptr<CSession> session, const short& msg_id, std::string_view msg_data);
 
     // 登录处理函数
     // 参数：
     //   - session: 会话对象
     //   - msg_id: 消息ID
-    //   - msg_data: 消息数据（JSON格式）
-    void LoginHandler(std::shared_ptr<CSession> session, const short& msg_id, const std::string& msg_data);
+    //   - msg_data: 消息数据（JSON 或 protobuf，取决于会话编码；指向接收缓冲块，仅在回调期间有效）
+    void LoginHandler(std::shared_ptr<CSession> session, const short& msg_id, std::string_view msg_data);
+
+    // 登录第二步：token 和用户信息缓存取回后在工作线程上继续（校验 token、加载用户信息、更新登录状态）
+    // 返回值：校验失败、登录已结束时返回 false；通过后继续异步写登录状态时返回 true
+    bool LoginTokenChecked(std::shared_ptr<CSession> session, int uid, const std::string& token,
+        const RedisValue& token_reply, const RedisValue& base_reply);
 
 
-    void DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, const std::string& msg_data);
+    void DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, std::string_view msg_data);
 
-    void GetOfflineMsgHandler(std::shared_ptr<CSession> session, const short& msg_id, const std::string& msg_data);
-    void OfflineMsgAckHandler(std::shared_ptr<CSession> session, const short& msg_id, const std::string& msg_data);
+    void GetOfflineMsgHandler(std::shared_ptr<CSession> session, const short& msg_id, std::string_view msg_data);
+    void OfflineMsgAckHandler(std::shared_ptr<CSession> session, const short& msg_id, std::string_view msg_data);
 
     // 获取用户基础信息
     // 参数：
     //   - base_key: 基础键名
     //   - uid: 用户ID
+    //   - cached: Redis 中缓存的用户信息（GET base_key 的回复）
     //   - userinfo: 输出参数，用户信息
     // 返回值：
     //   成功返回true，否则返回false
-    bool GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo);
+    bool GetBaseInfo(std::string base_key, int uid, const RedisValue& cached, std::shared_ptr<UserInfo>& userinfo);
 
-    std::queue<std::shared_ptr<LogicNode>> _msg_que;  // 消息队列
-    std::mutex _mutex;                                 // 互斥锁
-    std::condition_variable _consume;                 // 条件变量（用于唤醒工作线程）
-    std::thread _worker_thread;                       // 工作线程
-    bool _b_stop;                                     // 停止标志
+    std::vector<std::unique_ptr<LogicWorker<LogicNode>>> _workers;  // 工作线程（分片）
     std::map<short, FunCallBack> _fun_callbacks;     // 回调函数映射表（消息ID -> 处理函数）
+    std::unique_ptr<ChatMsgWriter> _msg_writer;      // 聊天消息攒批入库（[MsgWriter]）
+    std::unique_ptr<MsgIdGenerator> _msg_ids;        // 服务端消息 ID（[SelfServer] MsgWorkerId）
 };
 
 
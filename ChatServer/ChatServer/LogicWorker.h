@@ -0,0 +1,120 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Logger.h"
+
+// LogicWorker：逻辑层的单个工作线程（一个分片）
+//
+// 作用：
+//   持有独立的消息队列和线程，按入队顺序串行执行投递给它的任务。
+//   LogicSystem 把同一会话的消息固定哈希到同一个 LogicWorker，
+//   从而在多核并行的同时保证单个用户的消息顺序。
+//
+// 实现逻辑：
+//   1. Post 只在锁内入队，队列由空变非空时才唤醒线程
+//   2. 工作线程一次把整个队列 swap 出来，解锁后再逐条调用处理函数，
+//      慢处理（Redis/gRPC 阻塞）不会挡住生产者入队
+//   3. 两个 vector 交替使用（双缓冲），容量在稳态下保留，入队不再分配内存
+//   4. Stop 后会把剩余消息处理完再退出
+//
+// 模板参数：
+//   - Node: 队列元素类型（LogicSystem 中为按值传递的 LogicNode）
+template <typename Node>
+class LogicWorker
+{
+public:
+	using Handler = std::function<void(Node&)>;
+
+	explicit LogicWorker(Handler handler)
+		: _handler(std::move(handler)), _b_stop(false), _processed(0) {
+		_thread = std::thread(&LogicWorker::Run, this);
+	}
+
+	~LogicWorker() {
+		Stop();
+	}
+
+	LogicWorker(const LogicWorker&) = delete;
+	LogicWorker& operator=(const LogicWorker&) = delete;
+
+	void Post(Node node) {
+		bool need_notify = false;
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			need_notify = _queue.empty();
+			_queue.push_back(std::move(node));
+		}
+		if (need_notify) {
+			_consume.notify_one();
+		}
+	}
+
+	// 停止工作线程（幂等），剩余消息会先被处理完
+	void Stop() {
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_b_stop) {
+				return;
+			}
+			_b_stop = true;
+		}
+		_consume.notify_one();
+		if (_thread.joinable()) {
+			_thread.join();
+		}
+	}
+
+	// 当前排队中的消息数
+	std::size_t Pending() {
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _queue.size();
+	}
+
+	// 已处理的消息总数
+	uint64_t Processed() const {
+		return _processed.load(std::memory_order_relaxed);
+	}
+
+private:
+	void Run() {
+		std::vector<Node> local;
+		for (;;) {
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_consume.wait(lock, [this] { return _b_stop || !_queue.empty(); });
+				if (_queue.empty() && _b_stop) {
+					break;
+				}
+				local.swap(_queue);
+			}
+
+			// 锁外执行回调
+			for (auto& node : local) {
+				try {
+					_handler(node);
+				}
+				catch (const std::exception& e) {
+					LOG_ERROR << "[LogicWorker] handler exception: " << e.what();
+				}
+			}
+			_processed.fetch_add(local.size(), std::memory_order_relaxed);
+			local.clear();
+		}
+	}
+
+	Handler _handler;
+	std::vector<Node> _queue;
+	std::mutex _mutex;
+	std::condition_variable _consume;
+	bool _b_stop;
+	std::atomic<uint64_t> _processed;
+	std::thread _thread;
+};
@@ -0,0 +1,76 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// 消息 ID 的时间起点：2024-01-01 00:00:00 UTC（毫秒）
+#define MSG_ID_EPOCH_MS 1704067200000LL
+// 服务器编号位数（最多 32 台 ChatServer）
+#define MSG_ID_WORKER_BITS 5
+// 每毫秒序号位数（每台每毫秒 128 个，用完后借用下一毫秒）
+#define MSG_ID_SEQ_BITS 7
+
+// MsgIdGenerator：服务端消息 ID（Snowflake 结构）
+//
+// 作用：
+//   每条消息在落库和转发之前由发送方所在的 ChatServer 编号，入库、离线收件箱、在线通知、跨服转发都带同一个 ID；
+//   入库时写唯一列 messages.msg_id（重复写入可识别），主键 id 仍是自增列，离线分页和确认按自增 id
+//
+// 实现逻辑：
+//   1. ID = 毫秒时间戳(41 位) | 服务器编号(5 位) | 序号(7 位)，共 53 位：
+//      客户端（Qt）把 JSON 数字当 double 解析，53 位以内才不丢精度
+//   2. (毫秒, 序号) 打包在一个 64 位原子量里，CAS 推进，多个逻辑线程并发取号不加锁
+//   3. 同一毫秒内序号递增，序号用完时进位到下一毫秒（借用未来时间）；时钟回拨时继续沿用上次的毫秒递增，
+//      同一台服务器上 ID 严格递增
+class MsgIdGenerator
+{
+public:
+	static constexpr uint64_t kSeqMask = (1ULL << MSG_ID_SEQ_BITS) - 1;
+	static constexpr uint64_t kWorkerMask = (1ULL << MSG_ID_WORKER_BITS) - 1;
+
+	explicit MsgIdGenerator(uint32_t worker_id) : _worker(worker_id & kWorkerMask), _last(0) {}
+
+	MsgIdGenerator(const MsgIdGenerator&) = delete;
+	MsgIdGenerator& operator=(const MsgIdGenerator&) = delete;
+
+	int64_t Next()
+	{
+		uint64_t now = NowMs();
+		uint64_t cur = _last.load(std::memory_order_relaxed);
+		uint64_t next;
+		do {
+			// 新的一毫秒从序号 0 开始；同一毫秒或时钟回拨时在上次的基础上加一（序号溢出自然进位到毫秒）
+			next = now > (cur >> MSG_ID_SEQ_BITS) ? now << MSG_ID_SEQ_BITS : cur + 1;
+		} while (!_last.compare_exchange_weak(cur, next, std::memory_order_relaxed, std::memory_order_relaxed));
+
+		uint64_t ms = next >> MSG_ID_SEQ_BITS;
+		return static_cast<int64_t>((ms << (MSG_ID_WORKER_BITS + MSG_ID_SEQ_BITS))
+			| (static_cast<uint64_t>(_worker) << MSG_ID_SEQ_BITS) | (next & kSeqMask));
+	}
+
+	uint32_t WorkerId() const { return _worker; }
+
+	// 逻辑时钟超前墙上时钟的毫秒数（持续超过每毫秒 128 条或时钟回拨时大于 0，否则为 0）
+	int64_t AheadMs() const
+	{
+		int64_t ahead = static_cast<int64_t>(_last.load(std::memory_order_relaxed) >> MSG_ID_SEQ_BITS)
+			- static_cast<int64_t>(NowMs());
+		return ahead > 0 ? ahead : 0;
+	}
+
+	// ========== 拆解 ID（日志和测试用） ==========
+	static int64_t UnixMs(int64_t id) { return (id >> (MSG_ID_WORKER_BITS + MSG_ID_SEQ_BITS)) + MSG_ID_EPOCH_MS; }
+	static uint32_t Worker(int64_t id) { return static_cast<uint32_t>((id >> MSG_ID_SEQ_BITS) & kWorkerMask); }
+	static uint32_t Sequence(int64_t id) { return static_cast<uint32_t>(id & kSeqMask); }
+
+private:
+	static uint64_t NowMs()
+	{
+		int64_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count() - MSG_ID_EPOCH_MS;
+		return ms > 0 ? static_cast<uint64_t>(ms) : 0;
+	}
+
+	uint32_t _worker;
+	std::atomic<uint64_t> _last;  // 上次发出的 (毫秒 << MSG_ID_SEQ_BITS) | 序号
+};
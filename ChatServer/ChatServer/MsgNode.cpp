@@ -1,12 +1,51 @@
 #include "MsgNode.h"
 #include"LogicSystem.h"
 
+RecvBlockPool& RecvBlockPool::Inst() {
+    static RecvBlockPool* pool = new RecvBlockPool();
+    return *pool;
+}
+
+// 取出一个空闲块
+// 
+// 实现逻辑：
+//   1. 空闲链表非空时直接复用
+//   2. 否则新建一个块（只在连接数或积压增长时发生）
+RecvBlockPtr RecvBlockPool::Acquire() {
+    RecvBlock* block = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_free_blocks.empty()) {
+            block = _free_blocks.back();
+            _free_blocks.pop_back();
+        }
+    }
+    if (block == nullptr) {
+        block = new RecvBlock();
+    }
+    return RecvBlockPtr(block);
+}
+
+// 归还块：缓存数量超过 RECV_BLOCK_POOL_MAX 时直接释放，避免峰值过后长期占用内存
+void RecvBlockPool::Release(RecvBlock* block) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_free_blocks.size() < RECV_BLOCK_POOL_MAX) {
+            _free_blocks.push_back(block);
+            return;
+        }
+    }
+    delete block;
+}
+
 // RecvNode构造函数：初始化接收消息节点
 // 参数：
-//   - max_len: 消息最大长度
+//   - block: 消息体所在的接收缓冲块
+//   - data: 消息体起始地址
+//   - len: 消息体长度
 //   - msg_id: 消息ID
-RecvNode::RecvNode(short max_len, short msg_id) :MsgNode(max_len),
-_msg_id(msg_id) {
+RecvNode::RecvNode(RecvBlockPtr block, const char* data, short len, short msg_id)
+    : _block(std::move(block)), _data(data), _len(len), _msg_id(msg_id) {
 
 }
 
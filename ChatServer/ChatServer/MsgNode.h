@@ -2,7 +2,13 @@
 #include <string>
 #include "const.h"
 #include <iostream>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <string_view>
 #include <boost/asio.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+#include "MsgPool.h"
 
 // 定义最大消息长度
 #define MAX_LENGTH 1024 * 2
@@ -21,6 +27,12 @@
 // 定义最大发送队列大小
 #define MAX_SENDQUE 1000
 
+// 定义会话接收缓冲块大小（一次 async_read_some 可读入多个完整帧，必须大于一个最大帧）
+#define RECV_BLOCK_SIZE (1024 * 16)
+
+// 接收缓冲池最多缓存的空闲块数量，超出部分直接释放
+#define RECV_BLOCK_POOL_MAX 1024
+
 using boost::asio::ip::tcp;
 
 // 前向声明
@@ -32,7 +44,7 @@ class CSession;
 //   - session: CSession对象
 //   - msg_id: 消息ID
 //   - msg_data: 消息数据
-typedef std::function<void(std::shared_ptr<CSession>, const short& msg_id, const std::string& msg_data)> FunCallBack;
+typedef std::function<void(std::shared_ptr<CSession>, const short& msg_id, std::string_view msg_data)> FunCallBack;
 
 // MsgNode类：消息节点的基类
 // 
@@ -40,25 +52,37 @@ typedef std::function<void(std::shared_ptr<CSession>, const short& msg_id, const
 //   提供消息存储的基本结构，包含消息数据和数据长度
 // 
 // 实现逻辑：
-//   1. 使用动态分配的字符数组存储消息数据
-//   2. 跟踪当前已使用的长度和总长度
-//   3. 提供清空消息的方法
+//   1. 节点对象和数据缓冲区都从 MsgPool 分配，稳态下不进入系统分配器
+//   2. 缓冲区不再清零：SendNode 会完整写入头部和消息体，末尾仍补 \0
+//   3. 侵入式引用计数（MsgNodePtr），不需要 make_shared 的控制块
 class MsgNode
 {
 public:
     // 构造函数：创建消息节点
     // 参数：
     //   - max_len: 消息最大长度
-    MsgNode(short max_len) :_total_len(max_len), _cur_len(0) {
-        // 分配内存并初始化为0（末尾添加\0确保安全性）
-        _data = new char[_total_len + 1]();
+    MsgNode(short max_len) :_total_len(max_len), _cur_len(0), _ref_count(0) {
+        // 从内存池分配（末尾添加\0确保安全性）
+        _data = static_cast<char*>(MsgPool::Allocate(_total_len + 1));
         _data[_total_len] = '\0';
     }
 
-    // 析构函数：释放内存
-    ~MsgNode() {
+    // 析构函数：缓冲区归还内存池
+    virtual ~MsgNode() {
         //std::cout << "destruct MsgNode" << std::endl;
-        delete[] _data;
+        MsgPool::Deallocate(_data, _total_len + 1);
+    }
+
+    MsgNode(const MsgNode&) = delete;
+    MsgNode& operator=(const MsgNode&) = delete;
+
+    // 节点对象本身也从内存池分配（虚析构保证 size 为派生类大小）
+    static void* operator new(std::size_t size) {
+        return MsgPool::Allocate(size);
+    }
+
+    static void operator delete(void* p, std::size_t size) {
+        MsgPool::Deallocate(p, size);
     }
 
     // 清空消息内容
@@ -70,26 +94,121 @@ public:
     short _cur_len;      // 当前使用的长度
     short _total_len;    // 总长度
     char* _data;         // 消息数据指针
+
+private:
+    friend void intrusive_ptr_add_ref(MsgNode* node);
+    friend void intrusive_ptr_release(MsgNode* node);
+
+    std::atomic<int> _ref_count;  // 引用计数
 };
 
+inline void intrusive_ptr_add_ref(MsgNode* node) {
+    node->_ref_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void intrusive_ptr_release(MsgNode* node) {
+    if (node->_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete node;
+    }
+}
+
+typedef boost::intrusive_ptr<MsgNode> MsgNodePtr;
+
+// RecvBlock类：会话接收缓冲块
+// 
+// 作用：
+//   CSession 直接把 socket 数据读进 RecvBlock，解析出的每一帧只是块内的一段视图，
+//   不再为每帧分配内存、memset 和 memcpy
+// 
+// 实现逻辑：
+//   1. 侵入式引用计数：会话和所有尚未处理完的 RecvNode 各持有一个引用
+//   2. 引用计数归零时块回到 RecvBlockPool，而不是 delete
+//   3. 只有引用计数为 1（仅会话自己持有）时，会话才能覆盖已解析区域
+class RecvBlock {
+public:
+    char* Data() { return _data; }
+    static constexpr std::size_t Capacity() { return RECV_BLOCK_SIZE; }
+
+    // 是否只被一个持有者引用（调用方自身）
+    bool Unique() const { return _ref_count.load(std::memory_order_acquire) == 1; }
+
+private:
+    friend class RecvBlockPool;
+    friend void intrusive_ptr_add_ref(RecvBlock* block);
+    friend void intrusive_ptr_release(RecvBlock* block);
+
+    RecvBlock() : _ref_count(0) {}
+
+    std::atomic<int> _ref_count;
+    char _data[RECV_BLOCK_SIZE];
+};
+
+typedef boost::intrusive_ptr<RecvBlock> RecvBlockPtr;
+
+// RecvBlockPool类：接收缓冲块池
+// 
+// 作用：
+//   复用 RecvBlock，稳态下读路径不再向系统申请内存
+// 
+// 注意：
+//   实例在进程退出时不析构，避免逻辑线程在静态析构阶段归还块时访问已销毁的池
+class RecvBlockPool {
+public:
+    static RecvBlockPool& Inst();
+
+    // 取出一个空闲块（池空时新建）
+    RecvBlockPtr Acquire();
+
+    // 归还块（由 intrusive_ptr_release 在引用计数归零时调用）
+    void Release(RecvBlock* block);
+
+private:
+    RecvBlockPool() = default;
+
+    std::mutex _mutex;
+    std::vector<RecvBlock*> _free_blocks;
+};
+
+inline void intrusive_ptr_add_ref(RecvBlock* block) {
+    block->_ref_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void intrusive_ptr_release(RecvBlock* block) {
+    if (block->_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        RecvBlockPool::Inst().Release(block);
+    }
+}
+
 // RecvNode类：接收消息节点
 // 
 // 作用：
-//   表示从网络接收到的消息
+//   表示从网络接收到的一帧消息
 // 
 // 特点：
-//   继承自MsgNode，添加了消息ID字段
-//   用于CSession接收消息时使用
-class RecvNode :public MsgNode {
+//   只是 RecvBlock 内消息体的视图（块引用 + 偏移 + 长度），按值传递，
+//   持有块引用保证逻辑线程处理期间数据不会被会话覆盖
+class RecvNode {
     friend class LogicSystem;  // 允许LogicSystem访问私有成员
 public:
+    RecvNode() : _data(nullptr), _len(0), _msg_id(0) {}
+
     // 构造函数：创建接收消息节点
     // 参数：
-    //   - max_len: 消息最大长度
+    //   - block: 消息体所在的接收缓冲块
+    //   - data: 消息体起始地址（位于 block 内）
+    //   - len: 消息体长度
     //   - msg_id: 消息ID
-    RecvNode(short max_len, short msg_id);
+    RecvNode(RecvBlockPtr block, const char* data, short len, short msg_id);
+
+    // 消息体视图，生命周期与本节点相同
+    std::string_view Body() const { return std::string_view(_data, _len); }
+    short MsgId() const { return _msg_id; }
+
 private:
-    short _msg_id;       // 消息ID
+    RecvBlockPtr _block;   // 消息体所在缓冲块
+    const char* _data;     // 消息体起始地址
+    short _len;            // 消息体长度
+    short _msg_id;         // 消息ID
 };
 
 // SendNode类：发送消息节点
@@ -0,0 +1,206 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+// 消息内存池（按尺寸分级 + 线程本地缓存）
+//
+// 作用：
+//   为 MsgNode 对象和消息缓冲区提供内存，替代每条消息一次的 new[] / delete[]。
+//   稳态下分配和释放都在线程本地空闲链表上完成，不进入系统分配器。
+//
+// 实现逻辑：
+//   1. 尺寸分级：64 / 256 / 1K / 2K / 4K / 16K，请求按向上取整落到对应级别，
+//      超过 16K 的请求直接走 operator new
+//   2. 每个线程每个级别一条空闲链表，最多缓存 MSG_POOL_LOCAL_MAX 块
+//   3. 发送节点通常在逻辑线程分配、在 IO 线程释放：本地缓存满时成批归还到中心链表，
+//      本地缓存空时再从中心链表成批取回，中心链表也满了才真正释放
+//   4. 线程退出时把本地缓存全部归还中心链表
+//
+// 统计：
+//   pool_hits  - 由池满足的分配次数
+//   mallocs    - 向系统申请内存的次数（稳态应当不再增长）
+//   frees      - 向系统归还内存的次数
+
+// 每个线程每个尺寸级别最多缓存的空闲块数
+#define MSG_POOL_LOCAL_MAX 256
+// 本地缓存与中心链表之间一次搬运的块数
+#define MSG_POOL_TRANSFER_BATCH 64
+// 中心链表每个尺寸级别最多缓存的空闲块数
+#define MSG_POOL_CENTRAL_MAX 8192
+
+class MsgPool
+{
+public:
+	struct Stats {
+		uint64_t pool_hits;
+		uint64_t mallocs;
+		uint64_t frees;
+	};
+
+	static constexpr std::size_t kClassCount = 6;
+
+	static void* Allocate(std::size_t size) {
+		int cls = ClassOf(size);
+		if (cls < 0) {
+			Counters().mallocs.fetch_add(1, std::memory_order_relaxed);
+			return ::operator new(size);
+		}
+
+		LocalCache& local = Local();
+		FreeList& list = local.lists[cls];
+		if (list.head == nullptr) {
+			RefillFromCentral(cls, list);
+		}
+		if (list.head != nullptr) {
+			FreeBlock* block = list.head;
+			list.head = block->next;
+			--list.count;
+			Counters().pool_hits.fetch_add(1, std::memory_order_relaxed);
+			return block;
+		}
+
+		Counters().mallocs.fetch_add(1, std::memory_order_relaxed);
+		return ::operator new(ClassSize(cls));
+	}
+
+	static void Deallocate(void* p, std::size_t size) {
+		if (p == nullptr) {
+			return;
+		}
+		int cls = ClassOf(size);
+		if (cls < 0) {
+			Counters().frees.fetch_add(1, std::memory_order_relaxed);
+			::operator delete(p);
+			return;
+		}
+
+		FreeList& list = Local().lists[cls];
+		FreeBlock* block = static_cast<FreeBlock*>(p);
+		block->next = list.head;
+		list.head = block;
+		++list.count;
+		if (list.count > MSG_POOL_LOCAL_MAX) {
+			SpillToCentral(cls, list);
+		}
+	}
+
+	static Stats GetStats() {
+		Stats stats;
+		stats.pool_hits = Counters().pool_hits.load(std::memory_order_relaxed);
+		stats.mallocs = Counters().mallocs.load(std::memory_order_relaxed);
+		stats.frees = Counters().frees.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	static std::size_t ClassSize(int cls) {
+		static const std::size_t sizes[kClassCount] = { 64, 256, 1024, 2048, 4096, 16384 };
+		return sizes[cls];
+	}
+
+	// 尺寸对应的级别，超过最大级别返回 -1
+	static int ClassOf(std::size_t size) {
+		for (std::size_t i = 0; i < kClassCount; ++i) {
+			if (size <= ClassSize(static_cast<int>(i))) {
+				return static_cast<int>(i);
+			}
+		}
+		return -1;
+	}
+
+private:
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+
+	struct FreeList {
+		FreeBlock* head = nullptr;
+		std::size_t count = 0;
+	};
+
+	struct CentralList {
+		std::mutex mutex;
+		FreeList list;
+	};
+
+	struct CounterSet {
+		std::atomic<uint64_t> pool_hits{ 0 };
+		std::atomic<uint64_t> mallocs{ 0 };
+		std::atomic<uint64_t> frees{ 0 };
+	};
+
+	struct LocalCache {
+		FreeList lists[kClassCount];
+
+		~LocalCache() {
+			for (std::size_t i = 0; i < kClassCount; ++i) {
+				while (lists[i].head != nullptr) {
+					SpillToCentral(static_cast<int>(i), lists[i]);
+				}
+			}
+		}
+	};
+
+	// 中心链表和计数器在进程退出时不析构，线程本地缓存析构时仍可安全归还
+	static CentralList* Central() {
+		static CentralList* central = new CentralList[kClassCount];
+		return central;
+	}
+
+	static CounterSet& Counters() {
+		static CounterSet* counters = new CounterSet();
+		return *counters;
+	}
+
+	static LocalCache& Local() {
+		thread_local LocalCache cache;
+		return cache;
+	}
+
+	static void RefillFromCentral(int cls, FreeList& local) {
+		CentralList& central = Central()[cls];
+		std::lock_guard<std::mutex> lock(central.mutex);
+		for (int i = 0; i < MSG_POOL_TRANSFER_BATCH && central.list.head != nullptr; ++i) {
+			FreeBlock* block = central.list.head;
+			central.list.head = block->next;
+			--central.list.count;
+			block->next = local.head;
+			local.head = block;
+			++local.count;
+		}
+	}
+
+	// 把本地链表头部的一批块交给中心链表，中心链表已满的部分归还系统
+	static void SpillToCentral(int cls, FreeList& local) {
+		FreeBlock* batch = nullptr;
+		std::size_t moved = 0;
+		while (moved < MSG_POOL_TRANSFER_BATCH && local.head != nullptr) {
+			FreeBlock* block = local.head;
+			local.head = block->next;
+			--local.count;
+			block->next = batch;
+			batch = block;
+			++moved;
+		}
+
+		CentralList& central = Central()[cls];
+		std::unique_lock<std::mutex> lock(central.mutex);
+		while (batch != nullptr && central.list.count < MSG_POOL_CENTRAL_MAX) {
+			FreeBlock* block = batch;
+			batch = block->next;
+			block->next = central.list.head;
+			central.list.head = block;
+			++central.list.count;
+		}
+		lock.unlock();
+
+		while (batch != nullptr) {
+			FreeBlock* block = batch;
+			batch = block->next;
+			::operator delete(block);
+			Counters().frees.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+};
@@ -21,13 +21,14 @@ int MysqlDao::RegUser(const std::string& name,
     // 使用 RAII ConnectionGuard，自动归还连接
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return -1;
     }
 
     try {
         sql::Connection* con = guard.get();
         
+        // CALL 返回多个结果集，不放入语句缓存
         std::unique_ptr<sql::PreparedStatement> pstmt(con->prepareStatement("CALL reg_user(?,?,?,@result)"));
 
         pstmt->setString(1, name);
@@ -41,7 +42,7 @@ int MysqlDao::RegUser(const std::string& name,
         int result = -1;
         if (res->next()) {
             result = res->getInt("result");
-            std::cout << "[MysqlDao] RegUser result: " << result << std::endl;
+            LOG_DEBUG << "[MysqlDao] RegUser result: " << result;
         }
 
         // 不需要手动 returnConnection，Guard 析构时自动执行
@@ -50,9 +51,9 @@ int MysqlDao::RegUser(const std::string& name,
     catch (sql::SQLException& e) {
         // 异常时标记连接为坏的，Guard 析构时会销毁并补充新连接
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in RegUser: " << e.what()
+        LOG_ERROR << "[MysqlDao] SQLException in RegUser: " << e.what()
             << " (MySQL error code: " << e.getErrorCode()
-            << ", SQLState: " << e.getSQLState() << ")" << std::endl;
+            << ", SQLState: " << e.getSQLState() << ")";
         return -1;
     }
 }
@@ -60,19 +61,18 @@ int MysqlDao::RegUser(const std::string& name,
 bool MysqlDao::CheckEmail(const std::string& name, const std::string& email) {
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool in CheckEmail" << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool in CheckEmail";
         return false;
     }
 
     try {
-        sql::Connection* con = guard.get();
-        std::unique_ptr<sql::PreparedStatement> pstmt(con->prepareStatement("SELECT email FROM user WHERE name = ?"));
+        sql::PreparedStatement* pstmt = guard.prepare("SELECT email FROM user WHERE name = ?");
 
         pstmt->setString(1, name);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
 
         while (res->next()) {
-            std::cout << "Check Email: " << res->getString("email") << std::endl;
+            LOG_DEBUG << "Check Email: " << res->getString("email");
             if (email != res->getString("email")) {
                 return false;
             }
@@ -83,9 +83,9 @@ bool MysqlDao::CheckEmail(const std::string& name, const std::string& email) {
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "SQLException in CheckEmail: " << e.what();
-        std::cerr << " (MySQL error code: " << e.getErrorCode();
-        std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+        LOG_ERROR << "SQLException in CheckEmail: " << e.what()
+            << " (MySQL error code: " << e.getErrorCode()
+            << ", SQLState: " << e.getSQLState() << " )";
         return false;
     }
 }
@@ -96,15 +96,12 @@ bool MysqlDao::UpdatePwdByEmail(const std::string& email, const std::string& new
         return false;
     }
     try {
-        sql::Connection* con = guard.get();
         std::string hashedPwd = sha256_hex(newpwdPlain);
 
         // 先查询 uid，用于后续缓存失效
         int uid = -1;
         {
-            std::unique_ptr<sql::PreparedStatement> selectStmt(
-                con->prepareStatement("SELECT uid FROM user WHERE email = ?")
-            );
+            sql::PreparedStatement* selectStmt = guard.prepare("SELECT uid FROM user WHERE email = ?");
             selectStmt->setString(1, email);
             std::unique_ptr<sql::ResultSet> res(selectStmt->executeQuery());
             if (res->next()) {
@@ -112,28 +109,26 @@ bool MysqlDao::UpdatePwdByEmail(const std::string& email, const std::string& new
             }
         }
 
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            con->prepareStatement("UPDATE user SET pwd = ? WHERE email = ?")
-        );
+        sql::PreparedStatement* pstmt = guard.prepare("UPDATE user SET pwd = ? WHERE email = ?");
         pstmt->setString(1, hashedPwd);
         pstmt->setString(2, email);
 
         int updateCount = pstmt->executeUpdate();
-        std::cout << "Updated rows: " << updateCount << std::endl;
+        LOG_DEBUG << "Updated rows: " << updateCount;
 
         // FlashCache: 密码修改后，主动失效缓存（多机同步）
         if (updateCount > 0 && uid > 0) {
             PublishCacheInvalidation(uid);
-            std::cout << "[FlashCache] Published cache invalidation for uid: " << uid << std::endl;
+            LOG_DEBUG << "[FlashCache] Published cache invalidation for uid: " << uid;
         }
 
         return updateCount > 0;
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "SQLException in UpdatePwdByEmail: " << e.what()
+        LOG_ERROR << "SQLException in UpdatePwdByEmail: " << e.what()
             << " (MySQL error code: " << e.getErrorCode()
-            << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+            << ", SQLState: " << e.getSQLState() << " )";
         return false;
     }
 }
@@ -145,15 +140,14 @@ bool MysqlDao::CheckPwd(const std::string& identifier, const std::string& pwdPla
     }
     
     try {
-        sql::Connection* con = guard.get();
         bool isEmail = (identifier.find('@') != std::string::npos);
-        std::unique_ptr<sql::PreparedStatement> pstmt;
+        sql::PreparedStatement* pstmt = nullptr;
         if (isEmail) {
-            pstmt.reset(con->prepareStatement("SELECT * FROM user WHERE email = ?"));
+            pstmt = guard.prepare("SELECT * FROM user WHERE email = ?");
             pstmt->setString(1, identifier);
         }
         else {
-            pstmt.reset(con->prepareStatement("SELECT * FROM user WHERE name = ?"));
+            pstmt = guard.prepare("SELECT * FROM user WHERE name = ?");
             pstmt->setString(1, identifier);
         }
 
@@ -182,11 +176,11 @@ bool MysqlDao::CheckPwd(const std::string& identifier, const std::string& pwdPla
         if (pwdPlain == origin_pwd) {
             bool migrated = UpdatePwdByEmail(db_email, pwdPlain);
             if (migrated) {
-                std::cout << "Migrated password for email " << db_email << " to hashed format." << std::endl;
+                LOG_INFO << "Migrated password for email " << db_email << " to hashed format.";
                 origin_pwd = sha256_hex(pwdPlain);
             }
             else {
-                std::cout << "Password migration failed for " << db_email << std::endl;
+                LOG_WARN << "Password migration failed for " << db_email;
             }
             userInfo.name = db_name;
             userInfo.email = db_email;
@@ -202,9 +196,9 @@ bool MysqlDao::CheckPwd(const std::string& identifier, const std::string& pwdPla
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "SQLException in CheckPwd: " << e.what();
-        std::cerr << " (MySQL error code: " << e.getErrorCode();
-        std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+        LOG_ERROR << "SQLException in CheckPwd: " << e.what()
+            << " (MySQL error code: " << e.getErrorCode()
+            << ", SQLState: " << e.getSQLState() << " )";
         return false;
     }
 }
@@ -297,7 +291,7 @@ bool MysqlDao::GetUser(int uid, UserInfo& userInfo)
             }
             return false;
         } catch (const std::exception& e) {
-            std::cerr << "[MysqlDao] Singleflight wait failed: " << e.what() << std::endl;
+            LOG_ERROR << "[MysqlDao] Singleflight wait failed: " << e.what();
             return false;
         }
     }
@@ -308,20 +302,17 @@ std::optional<UserInfo> MysqlDao::LoadUserFromDB(int uid)
 {
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return std::nullopt;
     }
 
     try {
-        sql::Connection* con = guard.get();
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            con->prepareStatement("SELECT uid, name, email, pwd FROM user WHERE uid = ?")
-        );
+        sql::PreparedStatement* pstmt = guard.prepare("SELECT uid, name, email, pwd FROM user WHERE uid = ?");
         pstmt->setInt(1, uid);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
 
         if (!res->next()) {
-            std::cerr << "[MysqlDao] No user found for uid: " << uid << std::endl;
+            LOG_WARN << "[MysqlDao] No user found for uid: " << uid;
             return std::nullopt;
         }
 
@@ -335,7 +326,7 @@ std::optional<UserInfo> MysqlDao::LoadUserFromDB(int uid)
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in LoadUserFromDB: " << e.what() << std::endl;
+        LOG_ERROR << "[MysqlDao] SQLException in LoadUserFromDB: " << e.what();
         return std::nullopt;
     }
 }
@@ -344,13 +335,12 @@ std::shared_ptr<UserInfo> MysqlDao::GetUserByName(const std::string& name)
 {
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return nullptr;
     }
 
     try {
-        sql::Connection* con = guard.get();
-        std::unique_ptr<sql::PreparedStatement> pstmt(con->prepareStatement("SELECT * from user where name = ?"));
+        sql::PreparedStatement* pstmt = guard.prepare("SELECT * from user where name = ?");
         pstmt->setString(1, name);
 
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
@@ -372,7 +362,7 @@ std::shared_ptr<UserInfo> MysqlDao::GetUserByName(const std::string& name)
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in GetUserByName: " << e.what() << std::endl;
+        LOG_ERROR << "[MysqlDao] SQLException in GetUserByName: " << e.what();
         return nullptr;
     }
 }
@@ -383,20 +373,17 @@ std::vector<ApplyInfo> MysqlDao::GetFriendRequests(int uid) {
     std::vector<ApplyInfo> requests;
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return requests;
     }
 
     try {
-        sql::Connection* con = guard.get();
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            con->prepareStatement(
-                "SELECT fr.from_uid, u.name, fr.desc, u.icon, u.nick, u.sex, fr.status "
-                "FROM friend_requests fr "
-                "JOIN user u ON fr.from_uid = u.uid "
-                "WHERE fr.to_uid = ? AND fr.status = 0 "
-                "ORDER BY fr.create_time DESC"
-            )
+        sql::PreparedStatement* pstmt = guard.prepare(
+            "SELECT fr.from_uid, u.name, fr.desc, u.icon, u.nick, u.sex, fr.status "
+            "FROM friend_requests fr "
+            "JOIN user u ON fr.from_uid = u.uid "
+            "WHERE fr.to_uid = ? AND fr.status = 0 "
+            "ORDER BY fr.create_time DESC"
         );
         pstmt->setInt(1, uid);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
@@ -416,7 +403,7 @@ std::vector<ApplyInfo> MysqlDao::GetFriendRequests(int uid) {
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in GetFriendRequests: " << e.what() << std::endl;
+        LOG_ERROR << "[MysqlDao] SQLException in GetFriendRequests: " << e.what();
     }
 
     return requests;
@@ -426,16 +413,13 @@ std::vector<ApplyInfo> MysqlDao::GetFriendRequests(int uid) {
 bool MysqlDao::ReplyFriendRequest(int fromUid, int toUid, bool agree) {
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return false;
     }
 
     try {
-        sql::Connection* con = guard.get();
         // 更新申请状态
-        std::unique_ptr<sql::PreparedStatement> updateStmt(
-            con->prepareStatement("UPDATE friend_requests SET status = ? WHERE from_uid = ? AND to_uid = ? AND status = 0")
-        );
+        sql::PreparedStatement* updateStmt = guard.prepare("UPDATE friend_requests SET status = ? WHERE from_uid = ? AND to_uid = ? AND status = 0");
         updateStmt->setInt(1, agree ? 1 : 2);
         updateStmt->setInt(2, fromUid);
         updateStmt->setInt(3, toUid);
@@ -443,9 +427,7 @@ bool MysqlDao::ReplyFriendRequest(int fromUid, int toUid, bool agree) {
 
         if (updateCount > 0 && agree) {
             // 如果同意，添加好友关系
-            std::unique_ptr<sql::PreparedStatement> insertFriendStmt(
-                con->prepareStatement("INSERT INTO friends (uid1, uid2, create_time) VALUES (?, ?, NOW()), (?, ?, NOW())")
-            );
+            sql::PreparedStatement* insertFriendStmt = guard.prepare("INSERT INTO friends (uid1, uid2, create_time) VALUES (?, ?, NOW()), (?, ?, NOW())");
             insertFriendStmt->setInt(1, fromUid);
             insertFriendStmt->setInt(2, toUid);
             insertFriendStmt->setInt(3, toUid);
@@ -455,14 +437,14 @@ bool MysqlDao::ReplyFriendRequest(int fromUid, int toUid, bool agree) {
             // FlashCache: 好友关系变更，失效双方缓存
             InvalidateUserCache(fromUid);
             InvalidateUserCache(toUid);
-            std::cout << "[FlashCache] Invalidated cache for uid: " << fromUid << " and " << toUid << std::endl;
+            LOG_DEBUG << "[FlashCache] Invalidated cache for uid: " << fromUid << " and " << toUid;
         }
 
         return updateCount > 0;
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in ReplyFriendRequest: " << e.what() << std::endl;
+        LOG_ERROR << "[MysqlDao] SQLException in ReplyFriendRequest: " << e.what();
         return false;
     }
 }
@@ -472,20 +454,17 @@ std::vector<UserInfo> MysqlDao::GetMyFriends(int uid) {
     std::vector<UserInfo> friends;
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return friends;
     }
 
     try {
-        sql::Connection* con = guard.get();
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            con->prepareStatement(
-                "SELECT u.uid, u.name, u.email, u.nick, u.icon, u.sex, u.desc "
-                "FROM friends f "
-                "JOIN user u ON (f.uid2 = u.uid) "
-                "WHERE f.uid1 = ? "
-                "ORDER BY u.nick ASC"
-            )
+        sql::PreparedStatement* pstmt = guard.prepare(
+            "SELECT u.uid, u.name, u.email, u.nick, u.icon, u.sex, u.desc "
+            "FROM friends f "
+            "JOIN user u ON (f.uid2 = u.uid) "
+            "WHERE f.uid1 = ? "
+            "ORDER BY u.nick ASC"
         );
         pstmt->setInt(1, uid);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
@@ -504,7 +483,7 @@ std::vector<UserInfo> MysqlDao::GetMyFriends(int uid) {
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in GetMyFriends: " << e.what() << std::endl;
+        LOG_ERROR << "[MysqlDao] SQLException in GetMyFriends: " << e.what();
     }
 
     return friends;
@@ -514,15 +493,12 @@ std::vector<UserInfo> MysqlDao::GetMyFriends(int uid) {
 bool MysqlDao::IsFriend(int uid1, int uid2) {
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return false;
     }
 
     try {
-        sql::Connection* con = guard.get();
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            con->prepareStatement("SELECT COUNT(*) as count FROM friends WHERE (uid1 = ? AND uid2 = ?) OR (uid1 = ? AND uid2 = ?)")
-        );
+        sql::PreparedStatement* pstmt = guard.prepare("SELECT COUNT(*) as count FROM friends WHERE (uid1 = ? AND uid2 = ?) OR (uid1 = ? AND uid2 = ?)");
         pstmt->setInt(1, uid1);
         pstmt->setInt(2, uid2);
         pstmt->setInt(3, uid2);
@@ -538,39 +514,136 @@ bool MysqlDao::IsFriend(int uid1, int uid2) {
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in IsFriend: " << e.what() << std::endl;
+        LOG_ERROR << "[MysqlDao] SQLException in IsFriend: " << e.what();
         return false;
     }
 }
 
-bool MysqlDao::SaveChatMessage(int fromUid, int toUid, const std::string& payload)
+// 写入单条聊天消息
+//
+// 注意：
+//   msgId 为服务端消息 ID，写入唯一列 msg_id（为 0 时写 NULL），主键 id 仍由自增列生成；
+//   同一条消息重复写入（整批失败后逐条重写、或提交成功但回包丢失后重试）时 msg_id 冲突，
+//   库里那一行内容相同就算已写入，不同说明 msg_id 撞号（服务器编号配重），报错而不是悄悄丢掉
+bool MysqlDao::SaveChatMessage(int fromUid, int toUid, const std::string& payload, long long msgId)
 {
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return false;
     }
 
     try {
-        sql::Connection* con = guard.get();
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            con->prepareStatement("INSERT INTO messages (from_uid, to_uid, payload, status, create_time) VALUES (?, ?, ?, 0, NOW())")
-        );
-        pstmt->setInt(1, fromUid);
-        pstmt->setInt(2, toUid);
-        pstmt->setString(3, payload);
+        sql::PreparedStatement* pstmt = guard.prepare(
+            "INSERT INTO messages (msg_id, from_uid, to_uid, payload, status, create_time) VALUES (?, ?, ?, ?, 0, NOW())");
+        if (msgId > 0) {
+            pstmt->setInt64(1, msgId);
+        }
+        else {
+            pstmt->setNull(1, sql::DataType::BIGINT);
+        }
+        pstmt->setInt(2, fromUid);
+        pstmt->setInt(3, toUid);
+        pstmt->setString(4, payload);
         pstmt->execute();
 
         return true;
     }
+    catch (sql::SQLException& e) {
+        if (e.getErrorCode() == MYSQL_ER_DUP_ENTRY && msgId > 0) {
+            return IsSameChatMessage(guard, msgId, payload);
+        }
+        guard.markBad();
+        LOG_ERROR << "[MysqlDao] SQLException in SaveChatMessage: " << e.what();
+        return false;
+    }
+}
+
+// msg_id 冲突时比较库里已有那一行的内容：相同说明是重复写入，不同说明撞号
+bool MysqlDao::IsSameChatMessage(ConnectionGuard& guard, long long msgId, const std::string& payload)
+{
+    try {
+        sql::PreparedStatement* pstmt = guard.prepare("SELECT payload FROM messages WHERE msg_id = ?");
+        pstmt->setInt64(1, msgId);
+        std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+        if (res->next() && res->getString("payload") == payload) {
+            return true;
+        }
+        LOG_ERROR << "[MysqlDao] msg_id " << msgId << " already used by another message, check [SelfServer] MsgWorkerId";
+        return false;
+    }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in SaveChatMessage: " << e.what() << std::endl;
+        LOG_ERROR << "[MysqlDao] SQLException in IsSameChatMessage: " << e.what();
         return false;
     }
 }
 
-bool MysqlDao::GetUnreadChatMessagesWithIds(int uid, std::vector<long long>& ids, std::vector<std::string>& payloads)
+// 批量写入聊天消息
+// 
+// 实现逻辑：
+//   拼成一条 INSERT ... VALUES (...),(...)，自动提交模式下单条语句就是一个事务：
+//   整批一次网络往返、一次提交（一次 redo log 刷盘），要么全部写入要么全部不写入；
+//   任一行 msg_id 冲突整批失败，由 ChatMsgWriter 逐条重写，在 SaveChatMessage 里区分重复写入和撞号
+bool MysqlDao::SaveChatMessages(const std::vector<ChatMsgRow>& rows)
+{
+    if (rows.empty()) return true;
+
+    ConnectionGuard guard(pool_);
+    if (!guard) {
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
+        return false;
+    }
+
+    try {
+        sql::Connection* con = guard.get();
+        std::string sql = "INSERT INTO messages (msg_id, from_uid, to_uid, payload, status, create_time) VALUES ";
+        sql.reserve(sql.size() + rows.size() * 27);
+        for (size_t i = 0; i < rows.size(); ++i) {
+            if (i) sql += ",";
+            sql += "(?, ?, ?, ?, 0, NOW())";
+        }
+
+        std::unique_ptr<sql::PreparedStatement> pstmt(con->prepareStatement(sql));
+        unsigned int index = 1;
+        for (const auto& row : rows) {
+            if (row.msg_id > 0) {
+                pstmt->setInt64(index++, row.msg_id);
+            }
+            else {
+                pstmt->setNull(index++, sql::DataType::BIGINT);
+            }
+            pstmt->setInt(index++, row.from_uid);
+            pstmt->setInt(index++, row.to_uid);
+            pstmt->setString(index++, row.payload);
+        }
+        pstmt->execute();
+
+        return true;
+    }
+    catch (sql::SQLException& e) {
+        if (e.getErrorCode() != MYSQL_ER_DUP_ENTRY) {
+            guard.markBad();
+        }
+        LOG_ERROR << "[MysqlDao] SQLException in SaveChatMessages (" << rows.size() << " rows): " << e.what();
+        return false;
+    }
+}
+
+// 取一页未读消息
+//
+// 实现逻辑：
+//   用上一页最后一条的 id 作为游标（WHERE id > ?），不用 OFFSET，翻到第几页都是一次索引范围扫描，
+//   上一页下发期间有消息被确认（status 变化）也不会跳过或重复
+//
+// 参数：
+//   - after_id: 游标，首页传 0
+//   - limit: 每页条数
+//
+// 返回值：
+//   查询成功返回 true（可能为空页），ids 与 payloads 一一对应；返回条数等于 limit 说明可能还有下一页
+bool MysqlDao::GetUnreadChatMessagesPage(int uid, long long after_id, int limit,
+    std::vector<long long>& ids, std::vector<std::string>& payloads)
 {
     ids.clear();
     payloads.clear();
@@ -578,17 +651,16 @@ bool MysqlDao::GetUnreadChatMessagesWithIds(int uid, std::vector<long long>& ids
     // 使用 RAII ConnectionGuard，自动归还连接
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return false;
     }
 
     try {
-        sql::Connection* con = guard.get();
-        
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            con->prepareStatement("SELECT id, payload FROM messages WHERE to_uid = ? AND status = 0 ORDER BY id ASC")
-        );
+        sql::PreparedStatement* pstmt = guard.prepare(
+            "SELECT id, payload FROM messages WHERE to_uid = ? AND status = 0 AND id > ? ORDER BY id ASC LIMIT ?");
         pstmt->setInt(1, uid);
+        pstmt->setInt64(2, after_id);
+        pstmt->setInt(3, limit);
         std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
 
         while (res->next()) {
@@ -601,7 +673,7 @@ bool MysqlDao::GetUnreadChatMessagesWithIds(int uid, std::vector<long long>& ids
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in GetUnreadChatMessagesWithIds: " << e.what() << std::endl;
+        LOG_ERROR << "[MysqlDao] SQLException in GetUnreadChatMessagesPage: " << e.what();
         return false;
     }
 }
@@ -613,7 +685,7 @@ bool MysqlDao::DeleteChatMessagesByIds(const std::vector<long long>& ids)
     
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return false;
     }
 
@@ -637,7 +709,7 @@ bool MysqlDao::DeleteChatMessagesByIds(const std::vector<long long>& ids)
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in DeleteChatMessagesByIds: " << e.what() << std::endl;
+        LOG_ERROR << "[MysqlDao] SQLException in DeleteChatMessagesByIds: " << e.what();
         return false;
     }
 }
@@ -646,29 +718,26 @@ bool MysqlDao::AckOfflineMessages(int uid, long long max_msg_id)
 {
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cerr << "[MysqlDao] Failed to get connection from pool." << std::endl;
+        LOG_ERROR << "[MysqlDao] Failed to get connection from pool.";
         return false;
     }
 
     try {
-        sql::Connection* con = guard.get();
         // 只更新status=0的消息
-        std::unique_ptr<sql::PreparedStatement> pstmt(
-            con->prepareStatement("UPDATE messages SET status=1 WHERE to_uid = ? AND id <= ? AND status = 0")
-        );
+        sql::PreparedStatement* pstmt = guard.prepare("UPDATE messages SET status=1 WHERE to_uid = ? AND id <= ? AND status = 0");
         pstmt->setInt(1, uid);
         pstmt->setInt64(2, max_msg_id);
         int affected_rows = pstmt->executeUpdate();
         
-        std::cout << "[AckOfflineMessages] uid=" << uid 
+        LOG_DEBUG << "[AckOfflineMessages] uid=" << uid 
                   << " max_msg_id=" << max_msg_id 
-                  << " affected_rows=" << affected_rows << std::endl;
+                  << " affected_rows=" << affected_rows;
 
         return true;
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[MysqlDao] SQLException in AckOfflineMessages: " << e.what() << std::endl;
+        LOG_ERROR << "[MysqlDao] SQLException in AckOfflineMessages: " << e.what();
         return false;
     }
 }
@@ -679,35 +748,45 @@ void MysqlDao::LogCacheMetrics() const
 {
     auto stats = GetUserCacheStats();
     
-    std::cout << "\n==================== FlashCache Metrics ====================" << std::endl;
+    LOG_INFO << "\n==================== FlashCache Metrics ====================";
     
     // 基础统计
-    std::cout << "[Size]     Current: " << stats.current_size 
-              << " / " << stats.capacity 
-              << " (Peak: " << stats.peak_size << ")" << std::endl;
-    std::cout << "[Usage]    " << std::fixed << std::setprecision(1) 
-              << (stats.usage_rate() * 100.0) << "%" << std::endl;
+    LOG_INFO << "[Size]     Current: " << stats.current_size 
+             << " / " << stats.capacity 
+             << " (Peak: " << stats.peak_size << ")";
+    LOG_INFO << "[Usage]    " << std::fixed << std::setprecision(1) 
+             << (stats.usage_rate() * 100.0) << "%";
     
     // 命中率统计
-    std::cout << "[Gets]     Total: " << stats.total_gets() 
-              << " (Hits: " << stats.hits 
-              << ", Misses: " << stats.misses << ")" << std::endl;
-    std::cout << "[HitRate]  " << std::fixed << std::setprecision(2) 
-              << (stats.hit_rate() * 100.0) << "%" << std::endl;
+    LOG_INFO << "[Gets]     Total: " << stats.total_gets() 
+             << " (Hits: " << stats.hits 
+             << ", Misses: " << stats.misses << ")";
+    LOG_INFO << "[HitRate]  " << std::fixed << std::setprecision(2) 
+             << (stats.hit_rate() * 100.0) << "%";
     
     // 写入和删除统计
-    std::cout << "[Puts]     " << stats.puts << std::endl;
-    std::cout << "[Removes]  " << stats.removes << std::endl;
-    std::cout << "[Evictions] " << stats.evictions << std::endl;
-    std::cout << "[Expired]  " << stats.expired << std::endl;
+    LOG_INFO << "[Puts]     " << stats.puts;
+    LOG_INFO << "[Removes]  " << stats.removes;
+    LOG_INFO << "[Evictions] " << stats.evictions;
+    LOG_INFO << "[Expired]  " << stats.expired;
     
     // 时间统计
-    std::cout << "[Uptime]   " << std::fixed << std::setprecision(1) 
-              << stats.uptime_seconds() << " seconds" << std::endl;
-    std::cout << "[AvgQPS]   " << std::fixed << std::setprecision(1) 
-              << stats.avg_qps() << " queries/sec" << std::endl;
+    LOG_INFO << "[Uptime]   " << std::fixed << std::setprecision(1) 
+             << stats.uptime_seconds() << " seconds";
+    LOG_INFO << "[AvgQPS]   " << std::fixed << std::setprecision(1) 
+             << stats.avg_qps() << " queries/sec";
     
-    std::cout << "============================================================\n" << std::endl;
+    LOG_INFO << "============================================================";
+}
+
+// 预编译语句缓存命中率（所有连接合计）
+void MysqlDao::LogStmtCacheStats() const
+{
+    StmtCacheStats stats = GetStmtCacheStats();
+    LOG_INFO << "[MysqlDao] stmt_cache hits=" << stats.hits
+             << " misses=" << stats.misses
+             << " uncached=" << stats.uncached
+             << " hit_rate=" << std::fixed << std::setprecision(2) << (stats.hit_rate() * 100.0) << "%";
 }
 
 // ==================== 缓存失效接口实现 ====================
@@ -717,7 +796,7 @@ void MysqlDao::InvalidateUserCacheMultiple(const std::vector<int>& uids)
     for (int uid : uids) {
         userCache_.remove(uid);
     }
-    std::cout << "[FlashCache] Invalidated " << uids.size() << " users from cache" << std::endl;
+    LOG_INFO << "[FlashCache] Invalidated " << uids.size() << " users from cache";
 }
 
 void MysqlDao::ClearUserCacheAll()
@@ -728,7 +807,7 @@ void MysqlDao::ClearUserCacheAll()
     // 清空所有缓存数据
     userCache_.clear();
     
-    std::cout << "[FlashCache] Cleared all " << cleared_count << " users from cache" << std::endl;
+    LOG_INFO << "[FlashCache] Cleared all " << cleared_count << " users from cache";
 }
 
 // ==================== 多机缓存同步实现 ====================
@@ -736,7 +815,7 @@ void MysqlDao::ClearUserCacheAll()
 void MysqlDao::StartCacheSync()
 {
     if (cacheSync_) {
-        std::cout << "[FlashCache] Cache sync already started" << std::endl;
+        LOG_INFO << "[FlashCache] Cache sync already started";
         return;
     }
     
@@ -756,10 +835,10 @@ void MysqlDao::StartCacheSync()
     });
     
     if (cacheSync_->Start()) {
-        std::cout << "[FlashCache] Cache sync started, channel: " 
-                  << cacheSync_->GetChannel() << std::endl;
+        LOG_INFO << "[FlashCache] Cache sync started, channel: " 
+                 << cacheSync_->GetChannel();
     } else {
-        std::cout << "[FlashCache] Failed to start cache sync" << std::endl;
+        LOG_WARN << "[FlashCache] Failed to start cache sync";
         cacheSync_.reset();
     }
 }
@@ -769,7 +848,7 @@ void MysqlDao::StopCacheSync()
     if (cacheSync_) {
         cacheSync_->Stop();
         cacheSync_.reset();
-        std::cout << "[FlashCache] Cache sync stopped" << std::endl;
+        LOG_INFO << "[FlashCache] Cache sync stopped";
     }
 }
 
@@ -813,11 +892,11 @@ MysqlDao::WarmupResult MysqlDao::WarmupCache(size_t limit)
     WarmupResult result;
     auto start_time = std::chrono::high_resolution_clock::now();
     
-    std::cout << "[FlashCache] Starting cache warmup, limit: " << limit << std::endl;
+    LOG_INFO << "[FlashCache] Starting cache warmup, limit: " << limit;
     
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cout << "[FlashCache] Warmup failed: cannot get database connection" << std::endl;
+        LOG_WARN << "[FlashCache] Warmup failed: cannot get database connection";
         return result;
     }
     
@@ -856,32 +935,32 @@ MysqlDao::WarmupResult MysqlDao::WarmupCache(size_t limit)
                 
                 // 每 100 个用户输出一次进度
                 if (result.loaded_users % 100 == 0) {
-                    std::cout << "[FlashCache] Warmup progress: " 
-                              << result.loaded_users << "/" << result.total_users << std::endl;
+                    LOG_INFO << "[FlashCache] Warmup progress: " 
+                             << result.loaded_users << "/" << result.total_users;
                 }
             }
             catch (const std::exception& e) {
                 result.failed_users++;
-                std::cerr << "[FlashCache] Warmup error for user: " << e.what() << std::endl;
+                LOG_ERROR << "[FlashCache] Warmup error for user: " << e.what();
             }
         }
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[FlashCache] Warmup SQL error: " << e.what() << std::endl;
+        LOG_ERROR << "[FlashCache] Warmup SQL error: " << e.what();
     }
     
     auto end_time = std::chrono::high_resolution_clock::now();
     result.elapsed_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
     
-    std::cout << "[FlashCache] Warmup completed!" << std::endl;
-    std::cout << "  - Total users: " << result.total_users << std::endl;
-    std::cout << "  - Loaded: " << result.loaded_users << std::endl;
-    std::cout << "  - Failed: " << result.failed_users << std::endl;
-    std::cout << "  - Success rate: " << std::fixed << std::setprecision(1) 
-              << result.success_rate() << "%" << std::endl;
-    std::cout << "  - Elapsed: " << std::fixed << std::setprecision(2) 
-              << result.elapsed_ms << " ms" << std::endl;
+    LOG_INFO << "[FlashCache] Warmup completed!";
+    LOG_INFO << "  - Total users: " << result.total_users;
+    LOG_INFO << "  - Loaded: " << result.loaded_users;
+    LOG_INFO << "  - Failed: " << result.failed_users;
+    LOG_INFO << "  - Success rate: " << std::fixed << std::setprecision(1) 
+             << result.success_rate() << "%";
+    LOG_INFO << "  - Elapsed: " << std::fixed << std::setprecision(2) 
+             << result.elapsed_ms << " ms";
     
     return result;
 }
@@ -895,11 +974,11 @@ MysqlDao::WarmupResult MysqlDao::WarmupCacheByUids(const std::vector<int>& uids)
         return result;
     }
     
-    std::cout << "[FlashCache] Starting warmup for " << uids.size() << " specific users" << std::endl;
+    LOG_INFO << "[FlashCache] Starting warmup for " << uids.size() << " specific users";
     
     ConnectionGuard guard(pool_);
     if (!guard) {
-        std::cout << "[FlashCache] Warmup failed: cannot get database connection" << std::endl;
+        LOG_WARN << "[FlashCache] Warmup failed: cannot get database connection";
         return result;
     }
     
@@ -950,16 +1029,16 @@ MysqlDao::WarmupResult MysqlDao::WarmupCacheByUids(const std::vector<int>& uids)
     }
     catch (sql::SQLException& e) {
         guard.markBad();
-        std::cerr << "[FlashCache] Warmup SQL error: " << e.what() << std::endl;
+        LOG_ERROR << "[FlashCache] Warmup SQL error: " << e.what();
     }
     
     auto end_time = std::chrono::high_resolution_clock::now();
     result.elapsed_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
     
-    std::cout << "[FlashCache] Warmup by UIDs completed: " 
-              << result.loaded_users << "/" << result.total_users 
-              << " (" << std::fixed << std::setprecision(1) << result.success_rate() << "%)"
-              << " in " << std::fixed << std::setprecision(2) << result.elapsed_ms << " ms" << std::endl;
+    LOG_INFO << "[FlashCache] Warmup by UIDs completed: " 
+             << result.loaded_users << "/" << result.total_users 
+             << " (" << std::fixed << std::setprecision(1) << result.success_rate() << "%)"
+             << " in " << std::fixed << std::setprecision(2) << result.elapsed_ms << " ms";
     
     return result;
 }
@@ -971,5 +1050,5 @@ void MysqlDao::WarmupCacheAsync(size_t limit)
     });
     warmup_thread.detach();
     
-    std::cout << "[FlashCache] Async warmup started in background thread" << std::endl;
+    LOG_INFO << "[FlashCache] Async warmup started in background thread";
 }
\ No newline at end of file
@@ -4,291 +4,523 @@
 #include <mutex>
 #include <condition_variable>
 #include <queue>
+#include <deque>
+#include <algorithm>
+#include <sstream>
 #include <atomic>
 #include <memory>
 #include <iostream>
 #include <chrono>
 #include <future>
 #include <unordered_map>
+#include <vector>
 #include <optional>
 #include <mysql_driver.h>
 #include <cppconn/prepared_statement.h>
 #include <cppconn/resultset.h>
 #include <cppconn/statement.h>
 #include <cppconn/exception.h>
+#include <cppconn/datatype.h>
 #include <string>
 #include "data.h"
 #include "sharded_cache.h"
 #include "CacheInvalidationSync.h"
 /*数据库访问层（DAO  data access object）*/
 
+// 每个连接最多缓存多少条预编译语句（服务端 max_prepared_stmt_count 缺省 16382，由所有连接共享）
+#define MYSQL_STMT_CACHE_CAPACITY 64
+// 唯一键冲突的错误码（ER_DUP_ENTRY）
+#define MYSQL_ER_DUP_ENTRY 1062
+
 // ------------------ PooledConnection ------------------
-// 池化连接：包含连接对象 + 最后使用时间戳
+// 池化连接：包含连接对象 + 最后使用时间戳 + 预编译语句缓存
+//
+// 预编译语句缓存：
+//   SQL 文本 -> 该连接上 prepare 过的语句。同一条 SQL 在一个连接上只 prepare 一次（一次服务端往返），
+//   之后重新绑定参数直接执行。语句属于连接，坏连接被丢弃时缓存一起丢弃
 struct PooledConnection {
     std::unique_ptr<sql::Connection> conn;
+    std::unordered_map<std::string, std::unique_ptr<sql::PreparedStatement>> stmts;
     std::chrono::steady_clock::time_point last_used;
     
     PooledConnection(std::unique_ptr<sql::Connection> c) 
         : conn(std::move(c)), 
           last_used(std::chrono::steady_clock::now()) {}
     
-    // 允许移动
-    PooledConnection(PooledConnection&& other) noexcept
-        : conn(std::move(other.conn)), last_used(other.last_used) {}
-    
-    PooledConnection& operator=(PooledConnection&& other) noexcept {
-        if (this != &other) {
-            conn = std::move(other.conn);
-            last_used = other.last_used;
-        }
-        return *this;
+    // 析构顺序：先语句后连接
+    ~PooledConnection() {
+        stmts.clear();
+        conn.reset();
     }
     
-    // 禁止拷贝
+    // 禁止拷贝和移动（池中存放指针，语句缓存不需要跟着搬）
     PooledConnection(const PooledConnection&) = delete;
     PooledConnection& operator=(const PooledConnection&) = delete;
 };
 
+// 预编译语句缓存统计（所有连接合计）
+struct StmtCacheStats {
+    uint64_t hits = 0;       // 直接复用已 prepare 的语句
+    uint64_t misses = 0;     // 首次 prepare 并放入缓存
+    uint64_t uncached = 0;   // 连接的缓存已满，prepare 后用完即释放
+
+    double hit_rate() const {
+        uint64_t total = hits + misses + uncached;
+        return total > 0 ? static_cast<double>(hits) / total : 0.0;
+    }
+};
+
+// 连接池统计
+struct MySqlPoolStats {
+    // 取连接等待时间直方图的桶上界（微秒），最后一个桶是 >= 1s（未超时）
+    static constexpr int WAIT_BUCKETS = 7;
+    static constexpr int64_t WAIT_BUCKET_BOUNDS_US[WAIT_BUCKETS - 1] = { 10, 100, 1000, 10000, 100000, 1000000 };
+
+    int total = 0;               // 连接总数（含借出和正在检查的）
+    int idle = 0;                // 空闲连接数
+    int min_size = 0;
+    int max_size = 0;
+    uint64_t acquires = 0;       // 取连接成功次数
+    uint64_t timeouts = 0;       // 取连接超时次数
+    uint64_t created = 0;        // 新建连接数（不含 Init）
+    uint64_t create_failed = 0;  // 新建连接失败次数
+    uint64_t dropped_bad = 0;    // 因出错 / Ping 失败丢弃的连接数
+    uint64_t closed_idle = 0;    // 空闲过久被回收的连接数
+    uint64_t pinged = 0;         // 后台 Ping 次数
+    uint64_t wait_hist[WAIT_BUCKETS] = {};
+};
+
 // ------------------ MySqlPool ------------------
+// 弹性连接池
+//
+// 实现逻辑：
+//   1. 连接数在 [min, max] 之间：没有空闲连接且未到 max 时，取连接的线程在锁外自己建一个新连接；
+//      到了 max 才等待，最多等 acquire_timeout_ms
+//   2. 空闲连接后进先出：常用的连接一直是热的（语句缓存也是热的），冷的连接留在队首等待回收
+//   3. 后台维护线程（每 MAINTAIN_INTERVAL_SECONDS 一次，坏连接被丢弃时立即唤醒）：
+//      - Ping 闲置超过 IDLE_PING_SECONDS 的连接，失败的丢弃
+//      - 闲置超过 IDLE_CLOSE_SECONDS 且连接数多于 min 的关闭
+//      - 连接数低于 min 时补齐
+//   4. 建连接、Ping、关闭连接都不持有池锁：先在锁内预留名额（total_）或把连接移出空闲队列，再在锁外操作
+//   5. 取连接的等待时间按 MySqlPoolStats::WAIT_BUCKET_BOUNDS_US 计入直方图
 class MySqlPool {
 public:
-    MySqlPool() : poolSize_(0), b_stop_(false) {}
+    MySqlPool() : b_stop_(false) {}
 
     // Init 接受 url，例如 "tcp://127.0.0.1:3306"
+    // 参数：
+    //   - minSize: 常驻连接数，Init 时同步建好
+    //   - maxSize: 连接数上限，<= minSize 时等于 minSize（固定大小）
+    //   - acquireTimeoutMs: 连接全部借出且已到上限时，getConnection 最多等待的毫秒数
     void Init(const std::string& url,
         const std::string& user,
         const std::string& pass,
         const std::string& schema,
-        int poolSize)
+        int minSize,
+        int maxSize = 0,
+        int acquireTimeoutMs = DEFAULT_ACQUIRE_TIMEOUT_MS)
     {
         url_ = url;
         user_ = user;
         pass_ = pass;
         schema_ = schema;
-        poolSize_ = poolSize;
+        min_size_ = std::max(1, minSize);
+        max_size_ = std::max(min_size_, maxSize);
+        acquire_timeout_ms_ = acquireTimeoutMs;
         b_stop_ = false;
 
-        std::cout << "[MySqlPool] Init called. url=" << url_
+        LOG_INFO << "[MySqlPool] Init called. url=" << url_
             << " user=" << user_ << " schema=" << schema_
-            << " poolSize=" << poolSize_ << std::endl;
+            << " min=" << min_size_ << " max=" << max_size_;
 
         sql::mysql::MySQL_Driver* driver = nullptr;
         try {
             driver = sql::mysql::get_mysql_driver_instance();
             if (!driver) {
-                std::cerr << "[MySqlPool] get_mysql_driver_instance returned null!" << std::endl;
+                LOG_ERROR << "[MySqlPool] get_mysql_driver_instance returned null!";
                 throw std::runtime_error("driver null");
             }
         }
         catch (const std::exception& e) {
-            std::cerr << "[MySqlPool] get_mysql_driver_instance exception: " << e.what() << std::endl;
+            LOG_ERROR << "[MySqlPool] get_mysql_driver_instance exception: " << e.what();
             throw;
         }
         catch (...) {
-            std::cerr << "[MySqlPool] unknown exception getting driver" << std::endl;
+            LOG_ERROR << "[MySqlPool] unknown exception getting driver";
             throw;
         }
 
         // 先单次尝试连接（便于定位）
         try {
-            std::cout << "[MySqlPool] Trying single test connection..." << std::endl;
+            LOG_INFO << "[MySqlPool] Trying single test connection...";
             std::unique_ptr<sql::Connection> testCon(driver->connect(url_, user_, pass_));
             if (!testCon) {
-                std::cerr << "[MySqlPool] testCon is null after connect!" << std::endl;
+                LOG_ERROR << "[MySqlPool] testCon is null after connect!";
                 throw std::runtime_error("testCon null");
             }
             testCon->setSchema(schema_);
-            std::cout << "[MySqlPool] single test connection ok" << std::endl;
+            LOG_INFO << "[MySqlPool] single test connection ok";
         }
         catch (sql::SQLException& e) {
-            std::cerr << "[MySqlPool] test connect failed (SQLException): " << e.what()
-                << " (err:" << e.getErrorCode() << ", state:" << e.getSQLState() << ")" << std::endl;
+            LOG_ERROR << "[MySqlPool] test connect failed (SQLException): " << e.what()
+                << " (err:" << e.getErrorCode() << ", state:" << e.getSQLState() << ")";
             throw;
         }
         catch (const std::exception& e) {
-            std::cerr << "[MySqlPool] test connect failed (std::exception): " << e.what() << std::endl;
+            LOG_ERROR << "[MySqlPool] test connect failed (std::exception): " << e.what();
             throw;
         }
         catch (...) {
-            std::cerr << "[MySqlPool] test connect failed (unknown)" << std::endl;
+            LOG_ERROR << "[MySqlPool] test connect failed (unknown)";
             throw;
         }
 
-        // 保存驱动指针，供后续 getConnection() 动态创建新连接
+        // 保存驱动指针，供后续动态创建新连接
         driver_ = driver;
-        
-        // 如果 test 通过，逐个建池（每次都有 try/catch）
-        for (int i = 0; i < poolSize_; ++i) {
-            try {
-                std::unique_ptr<sql::Connection> con(driver->connect(url_, user_, pass_));
-                con->setSchema(schema_);
-                pool_.push(PooledConnection(std::move(con)));
-                std::cout << "[MySqlPool] push connection " << i << std::endl;
-            }
-            catch (sql::SQLException& e) {
-                std::cerr << "[MySqlPool] connect #" << i << " failed: " << e.what()
-                    << " (err:" << e.getErrorCode() << ", state:" << e.getSQLState() << ")" << std::endl;
-                // 这里选择：继续尝试剩下的，或直接抛出。为了稳健，这里继续但打印错误。
-            }
-            catch (const std::exception& e) {
-                std::cerr << "[MySqlPool] connect #" << i << " std::exception: " << e.what() << std::endl;
-            }
-            catch (...) {
-                std::cerr << "[MySqlPool] connect #" << i << " unknown exception" << std::endl;
+
+        // 如果 test 通过，建好常驻连接（失败的由维护线程稍后补齐）
+        for (int i = 0; i < min_size_; ++i) {
+            std::unique_ptr<PooledConnection> con = createConnection();
+            if (con) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                idle_.push_back(std::move(con));
+                ++total_;
             }
         }
 
         // 检查池子是否为空（防止死锁）
-        if (pool_.empty()) {
-            std::cerr << "[MySqlPool] CRITICAL: Pool is empty after Init! All connection attempts failed." << std::endl;
+        if (idle_.empty()) {
+            LOG_ERROR << "[MySqlPool] CRITICAL: Pool is empty after Init! All connection attempts failed.";
             throw std::runtime_error("[MySqlPool] Failed to initialize any database connections");
         }
 
-        std::cout << "[MySqlPool] Init done, actual pool size = " << pool_.size() 
-                  << " (min required: " << MIN_POOL_SIZE << "), driver saved for lazy loading" << std::endl;
+        maintainer_ = std::thread([this]() { maintainLoop(); });
+        LOG_INFO << "[MySqlPool] Init done, connections = " << total_
+                 << " (min " << min_size_ << ", max " << max_size_ << ")";
     }
 
-    // 从池子里取一个连接，支持自动重建
-    // 实现懒加载 + 自动重建机制：
-    //   - 超时机制：最多等待 3 秒，超时返回 nullptr（防止死锁）
-    //   - 惰性检查：闲置 > 60s 的连接才执行 Ping 检查
-    //   - 自动补充：坏连接销毁后尝试同步创建新连接
+    // 从池子里取一个连接
+    // 实现逻辑：
+    //   - 有空闲连接直接取（不做 Ping，健康检查由维护线程完成）
+    //   - 没有空闲连接且未到上限：预留名额后在锁外新建
+    //   - 已到上限：等待归还，超时返回 nullptr
     // 调用者必须检查返回值是否为 nullptr
-    std::unique_ptr<sql::Connection> getConnection() {
+    std::unique_ptr<PooledConnection> getConnection() {
+        auto start = std::chrono::steady_clock::now();
+        auto deadline = start + std::chrono::milliseconds(acquire_timeout_ms_);
+        bool create_failed = false;
         std::unique_lock<std::mutex> lock(mutex_);
-        
-        // 设置超时时间为 3 秒，防止死锁
-        if (cond_.wait_for(lock, std::chrono::seconds(3), 
-            [this] { return b_stop_ || !pool_.empty(); })) {
-            
+        for (;;) {
             if (b_stop_) return nullptr;
-            
-            // 虚假唤醒检查：即使 wait_for 返回 true，pool 也可能为空
-            if (pool_.empty()) {
-                std::cerr << "[MySqlPool] Spurious wakeup detected, pool is empty" << std::endl;
-                return nullptr;
-            }
-            
-            // 成功获取连接
-            auto pooledItem = std::move(pool_.front());
-            pool_.pop();
-            
-            // 第二层：惰性检查（防失效）
-            auto now = std::chrono::steady_clock::now();
-            auto idle_duration = std::chrono::duration_cast<std::chrono::seconds>(
-                now - pooledItem.last_used
-            );
-            
-            bool isValid = true;
-            if (idle_duration.count() > IDLE_THRESHOLD_SECONDS) {
-                // 闲置超过 60 秒，执行 Ping 检查
-                isValid = isConnectionValid(pooledItem.conn.get());
+
+            if (!idle_.empty()) {
+                std::unique_ptr<PooledConnection> con = std::move(idle_.back());
+                idle_.pop_back();
+                lock.unlock();
+                recordAcquire(start);
+                return con;
             }
-            
-            // 第三层：自动补充（防失效）
-            if (!isValid) {
-                std::cout << "[MySqlPool] Connection stale (idle " << idle_duration.count() 
-                          << "s), attempting to reconnect..." << std::endl;
-                
-                // 销毁坏连接
-                pooledItem.conn.reset();
-                
-                // 尝试创建新连接替换
-                if (driver_) {
-                    try {
-                        std::unique_ptr<sql::Connection> new_con(
-                            driver_->connect(url_, user_, pass_)
-                        );
-                        new_con->setSchema(schema_);
-                        std::cout << "[MySqlPool] Reconnected successfully" << std::endl;
-                        return new_con;
-                    }
-                    catch (sql::SQLException& e) {
-                        std::cerr << "[MySqlPool] Failed to reconnect: " << e.what() << std::endl;
-                        // 重连失败，返回 nullptr，让上层处理
-                        return nullptr;
-                    }
+
+            // 建连接失败过就不再重试（数据库可能不可用），剩余时间内等待别的线程归还
+            if (total_ < max_size_ && !create_failed) {
+                ++total_;  // 预留名额，建连接期间其他线程不会超过上限
+                lock.unlock();
+                std::unique_ptr<PooledConnection> con = createConnection();
+                if (con) {
+                    recordAcquire(start);
+                    return con;
                 }
-                
-                std::cerr << "[MySqlPool] Driver not available for reconnection" << std::endl;
+                create_failed = true;
+                lock.lock();
+                --total_;
+                continue;
+            }
+
+            if (cond_.wait_until(lock, deadline) == std::cv_status::timeout && idle_.empty()) {
+                timeouts_.fetch_add(1, std::memory_order_relaxed);
+                LOG_ERROR << "[MySqlPool] getConnection timeout after " << acquire_timeout_ms_
+                          << "ms, connections=" << total_ << "/" << max_size_;
                 return nullptr;
             }
-            
-            // 连接有效，返回
-            return std::move(pooledItem.conn);
-        } else {
-            // 超时：池子在 3 秒内仍未有可用连接
-            std::cerr << "[MySqlPool] getConnection timeout after 3s, pool is empty" << std::endl;
-            return nullptr;
         }
     }
 
     // 用完把连接放回池子
     // isHealthy=true：连接正常，放回池子
-    // isHealthy=false：连接坏了，销毁并尝试补充新连接
-    void returnConnection(std::unique_ptr<sql::Connection> con, bool isHealthy = true) {
+    // isHealthy=false：连接坏了，锁外销毁，由维护线程（或下一个取连接的线程）补充
+    void returnConnection(std::unique_ptr<PooledConnection> con, bool isHealthy = true) {
         if (!con) return;
         
-        std::unique_lock<std::mutex> lock(mutex_);
-        if (b_stop_) return;
-        
         if (isHealthy) {
-            // 好连接：放回池子，更新时间戳为当前时间
-            pool_.push(PooledConnection(std::move(con)));
-            cond_.notify_one();
-        } else {
-            // 坏连接：销毁并尝试补充新连接
-            con.reset();
-            
-            if (driver_) {
-                try {
-                    std::unique_ptr<sql::Connection> newCon(
-                        driver_->connect(url_, user_, pass_)
-                    );
-                    newCon->setSchema(schema_);
-                    pool_.push(PooledConnection(std::move(newCon)));
-                    std::cout << "[MySqlPool] Replaced bad connection with new one" << std::endl;
-                    cond_.notify_one();
-                }
-                catch (sql::SQLException& e) {
-                    std::cerr << "[MySqlPool] Failed to create replacement connection: " << e.what() << std::endl;
-                    // 补充失败，池子暂时缩容，依靠 getConnection 的重连逻辑恢复
-                }
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (b_stop_) {
+                --total_;
+                lock.unlock();
+                return;  // 连接在锁外析构
             }
+            // 好连接：放回池子（保留语句缓存），更新时间戳为当前时间
+            con->last_used = std::chrono::steady_clock::now();
+            idle_.push_back(std::move(con));
+            lock.unlock();
+            cond_.notify_one();
+            return;
         }
+
+        // 坏连接：先在锁外关闭，再归还名额
+        con.reset();
+        dropped_bad_.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --total_;
+        }
+        cond_.notify_one();           // 等待中的线程可以自己建连接
+        maintain_cond_.notify_one();  // 维护线程补齐 min
     }
 
     void Close() {
-        std::unique_lock<std::mutex> lock(mutex_);
-        b_stop_ = true;
-        while (!pool_.empty()) pool_.pop();
+        std::deque<std::unique_ptr<PooledConnection>> closing;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (b_stop_ && !maintainer_.joinable()) return;
+            b_stop_ = true;
+            closing.swap(idle_);
+            total_ -= static_cast<int>(closing.size());
+        }
         cond_.notify_all();
-        std::cout << "[MySqlPool] Closed pool" << std::endl;
+        maintain_cond_.notify_all();
+        if (maintainer_.joinable()) {
+            maintainer_.join();
+        }
+        closing.clear();
+        LOG_INFO << "[MySqlPool] Closed pool";
     }
 
     ~MySqlPool() {
         Close();
     }
 
+    MySqlPoolStats getStats() const {
+        MySqlPoolStats stats;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stats.total = total_;
+            stats.idle = static_cast<int>(idle_.size());
+        }
+        stats.min_size = min_size_;
+        stats.max_size = max_size_;
+        stats.acquires = acquires_.load(std::memory_order_relaxed);
+        stats.timeouts = timeouts_.load(std::memory_order_relaxed);
+        stats.created = created_.load(std::memory_order_relaxed);
+        stats.create_failed = create_failed_.load(std::memory_order_relaxed);
+        stats.dropped_bad = dropped_bad_.load(std::memory_order_relaxed);
+        stats.closed_idle = closed_idle_.load(std::memory_order_relaxed);
+        stats.pinged = pinged_.load(std::memory_order_relaxed);
+        for (int i = 0; i < MySqlPoolStats::WAIT_BUCKETS; ++i) {
+            stats.wait_hist[i] = wait_hist_[i].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    // 输出一行连接池统计：连接数、等待时间直方图（le_ 为桶上界）
+    void LogStats() const {
+        MySqlPoolStats stats = getStats();
+        std::ostringstream hist;
+        for (int i = 0; i < MySqlPoolStats::WAIT_BUCKETS; ++i) {
+            if (i + 1 < MySqlPoolStats::WAIT_BUCKETS) {
+                hist << " wait_le_" << MySqlPoolStats::WAIT_BUCKET_BOUNDS_US[i] << "us=" << stats.wait_hist[i];
+            }
+            else {
+                hist << " wait_gt_" << MySqlPoolStats::WAIT_BUCKET_BOUNDS_US[i - 1] << "us=" << stats.wait_hist[i];
+            }
+        }
+        LOG_INFO << "[MySqlPool] total=" << stats.total << " idle=" << stats.idle
+                 << " min=" << stats.min_size << " max=" << stats.max_size
+                 << " acquires=" << stats.acquires << " timeouts=" << stats.timeouts
+                 << " created=" << stats.created << " create_failed=" << stats.create_failed
+                 << " dropped_bad=" << stats.dropped_bad << " closed_idle=" << stats.closed_idle
+                 << " pinged=" << stats.pinged << hist.str();
+    }
+
+    // 记录一次预编译语句缓存查找（由 ConnectionGuard::prepare 调用）
+    void recordStmtLookup(bool hit, bool cached) {
+        if (hit) {
+            stmt_hits_.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (cached) {
+            stmt_misses_.fetch_add(1, std::memory_order_relaxed);
+        }
+        else {
+            stmt_uncached_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    StmtCacheStats getStmtCacheStats() const {
+        StmtCacheStats stats;
+        stats.hits = stmt_hits_.load(std::memory_order_relaxed);
+        stats.misses = stmt_misses_.load(std::memory_order_relaxed);
+        stats.uncached = stmt_uncached_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
 private:
     // 配置参数
-    static constexpr int IDLE_THRESHOLD_SECONDS = 60;      // 闲置多久才需要 Ping
-    static constexpr int MIN_POOL_SIZE = 2;                 // 最小池子大小
+    static constexpr int DEFAULT_ACQUIRE_TIMEOUT_MS = 3000;  // 取连接最长等待
+    static constexpr int MAINTAIN_INTERVAL_SECONDS = 5;      // 维护线程巡检间隔
+    static constexpr int IDLE_PING_SECONDS = 30;             // 闲置多久需要 Ping
+    static constexpr int IDLE_CLOSE_SECONDS = 60;            // 多于 min 的连接闲置多久关闭
     
-    std::string host_;
     std::string url_;
     std::string user_;
     std::string pass_;
     std::string schema_;
-    int poolSize_ = 0;
+    int min_size_ = 0;
+    int max_size_ = 0;
+    int acquire_timeout_ms_ = DEFAULT_ACQUIRE_TIMEOUT_MS;
 
-    // 保存 MySQL 驱动指针，用于动态创建新连接（懒加载）
+    // 保存 MySQL 驱动指针，用于动态创建新连接
     sql::mysql::MySQL_Driver* driver_ = nullptr;
 
-    std::queue<PooledConnection> pool_;
-    std::mutex mutex_;
-    std::condition_variable cond_;
+    // 以下由 mutex_ 保护
+    std::deque<std::unique_ptr<PooledConnection>> idle_;  // 队尾最近归还
+    int total_ = 0;                                        // 空闲 + 借出 + 正在建立 / 检查的连接数
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;           // 等待空闲连接或名额
+    std::condition_variable maintain_cond_;  // 唤醒维护线程
     std::atomic<bool> b_stop_;
+    std::thread maintainer_;
+
+    std::atomic<uint64_t> acquires_{ 0 };
+    std::atomic<uint64_t> timeouts_{ 0 };
+    std::atomic<uint64_t> created_{ 0 };
+    std::atomic<uint64_t> create_failed_{ 0 };
+    std::atomic<uint64_t> dropped_bad_{ 0 };
+    std::atomic<uint64_t> closed_idle_{ 0 };
+    std::atomic<uint64_t> pinged_{ 0 };
+    std::atomic<uint64_t> wait_hist_[MySqlPoolStats::WAIT_BUCKETS] = {};
+
+    std::atomic<uint64_t> stmt_hits_{ 0 };
+    std::atomic<uint64_t> stmt_misses_{ 0 };
+    std::atomic<uint64_t> stmt_uncached_{ 0 };
+
+    // 新建一个连接（不持有锁调用），失败返回 nullptr
+    std::unique_ptr<PooledConnection> createConnection() {
+        if (!driver_) return nullptr;
+        try {
+            std::unique_ptr<sql::Connection> con(driver_->connect(url_, user_, pass_));
+            con->setSchema(schema_);
+            created_.fetch_add(1, std::memory_order_relaxed);
+            return std::make_unique<PooledConnection>(std::move(con));
+        }
+        catch (sql::SQLException& e) {
+            LOG_ERROR << "[MySqlPool] connect failed: " << e.what()
+                << " (err:" << e.getErrorCode() << ", state:" << e.getSQLState() << ")";
+        }
+        catch (const std::exception& e) {
+            LOG_ERROR << "[MySqlPool] connect failed: " << e.what();
+        }
+        create_failed_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    void recordAcquire(std::chrono::steady_clock::time_point start) {
+        int64_t waited_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        int bucket = 0;
+        while (bucket < MySqlPoolStats::WAIT_BUCKETS - 1
+            && waited_us > MySqlPoolStats::WAIT_BUCKET_BOUNDS_US[bucket]) {
+            ++bucket;
+        }
+        wait_hist_[bucket].fetch_add(1, std::memory_order_relaxed);
+        acquires_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 维护线程
+    void maintainLoop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!b_stop_) {
+            maintain_cond_.wait_for(lock, std::chrono::seconds(MAINTAIN_INTERVAL_SECONDS));
+            if (b_stop_) break;
+            lock.unlock();
+            checkIdleConnections();
+            refillToMin();
+            lock.lock();
+        }
+    }
+
+    // Ping 久未使用的空闲连接，回收多于 min 的空闲连接
+    void checkIdleConnections() {
+        auto now = std::chrono::steady_clock::now();
+        std::vector<std::unique_ptr<PooledConnection>> to_ping;
+        std::vector<std::unique_ptr<PooledConnection>> to_close;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            // 队首是最久未用的，遇到最近用过的就停止
+            while (!idle_.empty()) {
+                auto idle_for = now - idle_.front()->last_used;
+                if (idle_for < std::chrono::seconds(IDLE_PING_SECONDS)) break;
+                if (idle_for >= std::chrono::seconds(IDLE_CLOSE_SECONDS)
+                    && total_ - static_cast<int>(to_close.size()) > min_size_) {
+                    to_close.push_back(std::move(idle_.front()));
+                }
+                else {
+                    to_ping.push_back(std::move(idle_.front()));
+                }
+                idle_.pop_front();
+            }
+            total_ -= static_cast<int>(to_close.size());
+        }
+        closed_idle_.fetch_add(to_close.size(), std::memory_order_relaxed);
+        to_close.clear();  // 锁外关闭
+
+        std::vector<std::unique_ptr<PooledConnection>> alive;
+        int dropped = 0;
+        for (auto& con : to_ping) {
+            pinged_.fetch_add(1, std::memory_order_relaxed);
+            if (isConnectionValid(con->conn.get())) {
+                con->last_used = std::chrono::steady_clock::now();
+                alive.push_back(std::move(con));
+            }
+            else {
+                con.reset();
+                ++dropped;
+            }
+        }
+        if (to_ping.empty()) return;
+        dropped_bad_.fetch_add(dropped, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            total_ -= dropped;
+            if (b_stop_) {
+                total_ -= static_cast<int>(alive.size());
+                return;  // alive 在锁外析构
+            }
+            // 放回队首：仍然是最冷的连接
+            for (auto it = alive.rbegin(); it != alive.rend(); ++it) {
+                idle_.push_front(std::move(*it));
+            }
+        }
+        cond_.notify_all();
+    }
+
+    // 连接数低于 min 时补齐
+    void refillToMin() {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (b_stop_ || total_ >= min_size_) return;
+                ++total_;
+            }
+            std::unique_ptr<PooledConnection> con = createConnection();
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!con || b_stop_) {
+                --total_;
+                return;  // 失败的下个周期再试
+            }
+            idle_.push_back(std::move(con));
+            cond_.notify_one();
+        }
+    }
     
     // 辅助方法：检查连接是否有效（不持有锁调用）
     bool isConnectionValid(sql::Connection* con) {
@@ -299,11 +531,11 @@ private:
             return true;
         }
         catch (const std::exception& e) {
-            std::cerr << "[MySqlPool] Connection validation failed: " << e.what() << std::endl;
+            LOG_ERROR << "[MySqlPool] Connection validation failed: " << e.what();
             return false;
         }
         catch (...) {
-            std::cerr << "[MySqlPool] Connection validation failed with unknown exception" << std::endl;
+            LOG_ERROR << "[MySqlPool] Connection validation failed with unknown exception";
             return false;
         }
     }
@@ -313,9 +545,9 @@ private:
 // 使用方式：
 //   ConnectionGuard guard(pool_);
 //   if (!guard) return false;
-//   sql::Connection* con = guard.get();
 //   try {
-//       // 使用 con 执行 SQL
+//       // 固定的 SQL 用 prepare 取缓存的语句；拼接出来的 SQL（IN 列表等）仍用 guard.get()->prepareStatement
+//       sql::PreparedStatement* pstmt = guard.prepare("SELECT ... WHERE uid = ?");
 //   } catch (...) {
 //       guard.markBad();  // 标记连接为坏的
 //       throw;
@@ -330,6 +562,7 @@ public:
     }
 
     ~ConnectionGuard() {
+        uncached_.clear();
         if (pool_ && con_) {
             pool_->returnConnection(std::move(con_), is_healthy_);
         }
@@ -341,19 +574,49 @@ public:
     
     // 允许移动
     ConnectionGuard(ConnectionGuard&& other) noexcept 
-        : pool_(std::move(other.pool_)), con_(std::move(other.con_)), is_healthy_(other.is_healthy_) {}
+        : pool_(std::move(other.pool_)), con_(std::move(other.con_)),
+          uncached_(std::move(other.uncached_)), is_healthy_(other.is_healthy_) {}
     
     ConnectionGuard& operator=(ConnectionGuard&& other) noexcept {
         if (this != &other) {
+            uncached_.clear();
+            if (pool_ && con_) {
+                pool_->returnConnection(std::move(con_), is_healthy_);
+            }
             pool_ = std::move(other.pool_);
             con_ = std::move(other.con_);
+            uncached_ = std::move(other.uncached_);
             is_healthy_ = other.is_healthy_;
         }
         return *this;
     }
     
     // 获取原始指针用于操作
-    sql::Connection* get() { return con_.get(); }
+    sql::Connection* get() { return con_->conn.get(); }
+
+    // 取该连接上缓存的预编译语句，没有则 prepare 并缓存
+    // 注意：
+    //   返回的语句归连接所有，不要 delete；只在 guard 存活期间使用，每次执行前重新绑定全部参数。
+    //   同一函数内不要对同一条 SQL 嵌套使用（会拿到同一个语句对象）。
+    //   缓存满时 prepare 的语句由 guard 持有，guard 析构时释放
+    sql::PreparedStatement* prepare(const std::string& sql) {
+        auto it = con_->stmts.find(sql);
+        if (it != con_->stmts.end()) {
+            pool_->recordStmtLookup(true, true);
+            return it->second.get();
+        }
+        std::unique_ptr<sql::PreparedStatement> stmt(con_->conn->prepareStatement(sql));
+        sql::PreparedStatement* raw = stmt.get();
+        if (con_->stmts.size() < MYSQL_STMT_CACHE_CAPACITY) {
+            con_->stmts.emplace(sql, std::move(stmt));
+            pool_->recordStmtLookup(false, true);
+        }
+        else {
+            uncached_.push_back(std::move(stmt));
+            pool_->recordStmtLookup(false, false);
+        }
+        return raw;
+    }
     
     // 判断是否获取成功
     operator bool() const { return con_ != nullptr; }
@@ -363,7 +626,8 @@ public:
 
 private:
     std::shared_ptr<MySqlPool> pool_;
-    std::unique_ptr<sql::Connection> con_;
+    std::unique_ptr<PooledConnection> con_;
+    std::vector<std::unique_ptr<sql::PreparedStatement>> uncached_;  // 缓存满时 prepare 的语句
     bool is_healthy_;  // 连接是否健康
 };
 
@@ -387,8 +651,12 @@ public:
     bool ReplyFriendRequest(int fromUid, int toUid, bool agree);
     std::vector<UserInfo> GetMyFriends(int uid);
     bool IsFriend(int uid1, int uid2);
-    bool SaveChatMessage(int fromUid, int toUid, const std::string& payload);
-    bool GetUnreadChatMessagesWithIds(int uid, std::vector<long long>& ids, std::vector<std::string>& payloads);
+    bool SaveChatMessage(int fromUid, int toUid, const std::string& payload, long long msgId = 0);
+    // 多行 INSERT 一次写入一批消息（ChatMsgWriter 攒批后调用），任一行失败整批不写入
+    bool SaveChatMessages(const std::vector<ChatMsgRow>& rows);
+    // 按库内自增 id 升序取一页未读消息（keyset 分页：id > after_id，最多 limit 条）
+    bool GetUnreadChatMessagesPage(int uid, long long after_id, int limit,
+        std::vector<long long>& ids, std::vector<std::string>& payloads);
     bool DeleteChatMessagesByIds(const std::vector<long long>& ids);
     bool AckOfflineMessages(int uid, long long max_msg_id);
     
@@ -448,6 +716,13 @@ public:
     
     // 重置缓存统计
     void ResetCacheStats() { userCache_.resetStats(); }
+
+    // 预编译语句缓存统计（见 PooledConnection）
+    StmtCacheStats GetStmtCacheStats() const { return pool_->getStmtCacheStats(); }
+    void LogStmtCacheStats() const;
+
+    // 连接池统计（连接数、取连接等待时间直方图）
+    void LogPoolStats() const { pool_->LogStats(); }
     
     // ==================== 缓存预热接口 ====================
     
@@ -529,5 +804,8 @@ private:
     
     // 内部方法：从数据库加载用户（不带 Singleflight）
     std::optional<UserInfo> LoadUserFromDB(int uid);
+
+    // 内部方法：msg_id 冲突时判断库里那一行是否就是同一条消息
+    bool IsSameChatMessage(ConnectionGuard& guard, long long msgId, const std::string& payload);
 };
 
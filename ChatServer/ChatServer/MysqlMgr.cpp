@@ -65,14 +65,20 @@ bool MysqlMgr::IsFriend(int uid1, int uid2)
     return _dao.IsFriend(uid1, uid2);
 }
 
-bool MysqlMgr::SaveChatMessage(int fromUid, int toUid, const std::string& payload)
+bool MysqlMgr::SaveChatMessage(int fromUid, int toUid, const std::string& payload, long long msgId)
 {
-    return _dao.SaveChatMessage(fromUid, toUid, payload);
+    return _dao.SaveChatMessage(fromUid, toUid, payload, msgId);
 }
 
-bool MysqlMgr::GetUnreadChatMessages(int uid, std::vector<long long>& ids, std::vector<std::string>& payloads)
+bool MysqlMgr::SaveChatMessages(const std::vector<ChatMsgRow>& rows)
 {
-    return _dao.GetUnreadChatMessagesWithIds(uid, ids, payloads);
+    return _dao.SaveChatMessages(rows);
+}
+
+bool MysqlMgr::GetUnreadChatMessagesPage(int uid, long long after_id, int limit,
+    std::vector<long long>& ids, std::vector<std::string>& payloads)
+{
+    return _dao.GetUnreadChatMessagesPage(uid, after_id, limit, ids, payloads);
 }
 
 bool MysqlMgr::DeleteChatMessagesByIds(const std::vector<long long>& ids)
@@ -21,10 +21,17 @@ public:
     bool ReplyFriendRequest(int fromUid, int toUid, bool agree);
     std::vector<UserInfo> GetMyFriends(int uid);
     bool IsFriend(int uid1, int uid2);
-    bool SaveChatMessage(int fromUid, int toUid, const std::string& payload);
-    bool GetUnreadChatMessages(int uid, std::vector<long long>& ids, std::vector<std::string>& payloads);
+    bool SaveChatMessage(int fromUid, int toUid, const std::string& payload, long long msgId = 0);
+    bool SaveChatMessages(const std::vector<ChatMsgRow>& rows);
+    bool GetUnreadChatMessagesPage(int uid, long long after_id, int limit,
+        std::vector<long long>& ids, std::vector<std::string>& payloads);
     bool DeleteChatMessagesByIds(const std::vector<long long>& ids);
     bool AckOfflineMessages(int uid, long long max_msg_id);
+    // 预编译语句缓存命中率
+    StmtCacheStats GetStmtCacheStats() const { return _dao.GetStmtCacheStats(); }
+    void LogStmtCacheStats() const { _dao.LogStmtCacheStats(); }
+    // 连接池连接数和取连接等待时间
+    void LogPoolStats() const { _dao.LogPoolStats(); }
 private:
     MysqlMgr();
     MysqlDao  _dao;
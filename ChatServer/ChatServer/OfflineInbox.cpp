@@ -0,0 +1,181 @@
+#include "OfflineInbox.h"
+#include "RedisMgr.h"
+#include "AsyncRedisMgr.h"
+#include "ConfigMgr.h"
+#include "const.h"
+#include <cctype>
+#include <cstdint>
+#include <limits>
+
+namespace {
+	long long ReadInboxConfig(const char* key, long long fallback)
+	{
+		std::string value = ConfigMgr::Inst()["OfflineInbox"][key];
+		if (value.empty()) {
+			return fallback;
+		}
+		try {
+			long long n = std::stoll(value);
+			return n > 0 ? n : fallback;
+		}
+		catch (const std::exception&) {
+			LOG_WARN << "[OfflineInbox] invalid number in [OfflineInbox] " << key << ": " << value;
+			return fallback;
+		}
+	}
+
+	bool ParseUnsigned(const std::string& text, uint64_t& value)
+	{
+		if (text.empty() || text.size() > 20) {
+			return false;
+		}
+		value = 0;
+		for (char c : text) {
+			if (!std::isdigit(static_cast<unsigned char>(c))) {
+				return false;
+			}
+			uint64_t digit = static_cast<uint64_t>(c - '0');
+			if (value > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+				return false;
+			}
+			value = value * 10 + digit;
+		}
+		return true;
+	}
+}
+
+OfflineInbox::OfflineInbox()
+	: _max_len(static_cast<std::size_t>(ReadInboxConfig("MaxLen", OFFLINE_INBOX_MAXLEN))),
+	_ttl_sec(ReadInboxConfig("TtlSec", OFFLINE_INBOX_TTL_SEC))
+{
+	LOG_INFO << "[OfflineInbox] max_len=" << _max_len << " ttl_sec=" << _ttl_sec;
+}
+
+std::string OfflineInbox::Key(int uid)
+{
+	return OFFLINE_INBOX_PREFIX + std::to_string(uid);
+}
+
+bool OfflineInbox::NextStreamId(const std::string& id, std::string& next)
+{
+	std::size_t dash = id.find('-');
+	if (dash == std::string::npos) {
+		return false;
+	}
+	uint64_t ms = 0;
+	uint64_t seq = 0;
+	if (!ParseUnsigned(id.substr(0, dash), ms) || !ParseUnsigned(id.substr(dash + 1), seq)) {
+		return false;
+	}
+	if (seq == std::numeric_limits<uint64_t>::max()) {
+		if (ms == std::numeric_limits<uint64_t>::max()) {
+			return false;
+		}
+		++ms;
+		seq = 0;
+	}
+	else {
+		++seq;
+	}
+	next = std::to_string(ms) + "-" + std::to_string(seq);
+	return true;
+}
+
+// 追加一条消息
+//
+// 实现逻辑：
+//   XADD 与 EXPIRE 走同一连接的 pipeline；MAXLEN 用 ~ 近似裁剪，Redis 按整个宏节点删除，开销是常数
+void OfflineInbox::Append(int uid, const std::string& payload)
+{
+	std::string key = Key(uid);
+	AsyncRedisMgr::GetInstance()->Pipeline({
+		{ "XADD", key, "MAXLEN", "~", std::to_string(_max_len), "*", "p", payload },
+		{ "EXPIRE", key, std::to_string(_ttl_sec) } },
+		[uid](std::vector<RedisValue> replies) {
+			if (replies[0].IsError()) {
+				LOG_WARN << "[OfflineInbox] XADD failed uid=" << uid << " err=" << replies[0].str;
+			}
+		});
+}
+
+// 读取一页
+//
+// 实现逻辑：
+//   XRANGE key <after_id 的后继> + COUNT n，回复为 [[id, [field, value, ...]], ...]，取字段 p
+bool OfflineInbox::ReadPage(int uid, const std::string& after_id, std::size_t count, std::vector<InboxEntry>& entries)
+{
+	entries.clear();
+	std::string start = "-";
+	if (!after_id.empty() && !NextStreamId(after_id, start)) {
+		LOG_WARN << "[OfflineInbox] bad cursor uid=" << uid << " after_id=" << after_id;
+		return false;
+	}
+
+	RedisPipeline pipe = RedisMgr::GetInstance()->Pipeline();
+	pipe.Command({ "XRANGE", Key(uid), start, "+", "COUNT", std::to_string(count) });
+	if (!pipe.Execute()) {
+		LOG_WARN << "[OfflineInbox] XRANGE failed uid=" << uid;
+		return false;
+	}
+	const redisReply* reply = pipe.Reply(0);
+	if (reply == nullptr || reply->type != REDIS_REPLY_ARRAY) {
+		LOG_WARN << "[OfflineInbox] XRANGE unexpected reply uid=" << uid;
+		return false;
+	}
+
+	entries.reserve(reply->elements);
+	for (std::size_t i = 0; i < reply->elements; ++i) {
+		const redisReply* item = reply->element[i];
+		if (item->type != REDIS_REPLY_ARRAY || item->elements < 2
+			|| item->element[0]->type != REDIS_REPLY_STRING || item->element[1]->type != REDIS_REPLY_ARRAY) {
+			continue;
+		}
+		InboxEntry entry;
+		entry.id.assign(item->element[0]->str, item->element[0]->len);
+		const redisReply* fields = item->element[1];
+		for (std::size_t f = 0; f + 1 < fields->elements; f += 2) {
+			const redisReply* name = fields->element[f];
+			const redisReply* value = fields->element[f + 1];
+			if (name->type == REDIS_REPLY_STRING && name->len == 1 && name->str[0] == 'p'
+				&& value->type == REDIS_REPLY_STRING) {
+				entry.payload.assign(value->str, value->len);
+				break;
+			}
+		}
+		entries.push_back(std::move(entry));
+	}
+	return true;
+}
+
+bool OfflineInbox::Ack(int uid, const std::string& up_to_id)
+{
+	std::string min_id;
+	if (!NextStreamId(up_to_id, min_id)) {
+		LOG_WARN << "[OfflineInbox] bad ack id uid=" << uid << " id=" << up_to_id;
+		return false;
+	}
+	AsyncRedisMgr::GetInstance()->Command({ "XTRIM", Key(uid), "MINID", min_id },
+		[uid](RedisValue reply) {
+			if (reply.IsError()) {
+				LOG_WARN << "[OfflineInbox] XTRIM failed uid=" << uid << " err=" << reply.str;
+			}
+		});
+	return true;
+}
+
+void OfflineInbox::Delete(int uid, const std::vector<std::string>& ids)
+{
+	if (ids.empty()) {
+		return;
+	}
+	std::vector<std::string> args;
+	args.reserve(ids.size() + 2);
+	args.push_back("XDEL");
+	args.push_back(Key(uid));
+	args.insert(args.end(), ids.begin(), ids.end());
+	AsyncRedisMgr::GetInstance()->Command(args, [uid](RedisValue reply) {
+		if (reply.IsError()) {
+			LOG_WARN << "[OfflineInbox] XDEL failed uid=" << uid << " err=" << reply.str;
+		}
+		});
+}
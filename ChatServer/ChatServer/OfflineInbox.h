@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Singleton.h"
+
+// 离线收件箱的 Redis 键前缀（Stream 类型，与旧的 offline_msg_ 列表不同名，避免 WRONGTYPE）
+#define OFFLINE_INBOX_PREFIX "offline_inbox_"
+// 每个收件箱最多保留的条数（XADD MAXLEN ~，超出后丢最旧的，丢掉的仍可从 MySQL 取到）
+#define OFFLINE_INBOX_MAXLEN 1000
+// 收件箱最后一次写入后保留的秒数
+#define OFFLINE_INBOX_TTL_SEC (7 * 24 * 3600)
+// 每页读取的条数
+#define OFFLINE_INBOX_PAGE 100
+
+// 收件箱中的一条消息
+struct InboxEntry {
+	std::string id;       // Stream 条目 ID（"毫秒-序号"），同时作为读取游标和确认位置
+	std::string payload;  // 入库格式的 JSON 文本消息
+};
+
+// OfflineInbox：每个用户一个 Redis Stream 的离线收件箱
+//
+// 作用：
+//   代替原来的 LPUSH 列表。列表按 LRANGE 0 -1 取出是新消息在前，取的同时 DEL 整个列表，
+//   客户端还没确认就已经删了，而且长度没有上限
+//
+// 实现逻辑：
+//   1. Append：XADD MAXLEN ~ N，同时刷新过期时间，不等回复
+//   2. ReadPage：从游标之后 XRANGE ... COUNT n，按写入顺序返回，只读不删，开销与页大小成正比
+//   3. Ack：客户端确认某个条目 ID 后 XTRIM MINID 删掉它及之前的条目
+//
+// 注意：
+//   XTRIM MINID 需要 Redis 6.2 及以上
+//   长度和过期时间由 [OfflineInbox] MaxLen / TtlSec 配置
+class OfflineInbox : public Singleton<OfflineInbox>
+{
+	friend class Singleton<OfflineInbox>;
+public:
+	// 追加一条消息（异步发出，不等待 Redis 回复）
+	void Append(int uid, const std::string& payload);
+
+	// 读取一页
+	// 参数：
+	//   - after_id: 游标，只返回 ID 大于它的条目；为空时从头读
+	//   - count: 最多条数
+	//   - entries: 输出参数，按 ID 升序
+	// 返回值：
+	//   Redis 出错返回 false（阻塞调用，在 DB 线程中使用）
+	bool ReadPage(int uid, const std::string& after_id, std::size_t count, std::vector<InboxEntry>& entries);
+
+	// 确认：删除 ID 不大于 up_to_id 的条目（异步发出）；up_to_id 格式不对时忽略并返回 false
+	bool Ack(int uid, const std::string& up_to_id);
+
+	// 删除指定条目（XDEL，异步发出）：这些消息数据库中已有，不需要等客户端确认
+	void Delete(int uid, const std::vector<std::string>& ids);
+
+	static std::string Key(int uid);
+
+	// Stream ID 的后继（"ms-seq" -> "ms-(seq+1)"），格式不对时返回 false
+	// 用作 XRANGE 的起点实现开区间（Redis 6.2 之前不支持 "(" 前缀）和 XTRIM MINID 的阈值
+	static bool NextStreamId(const std::string& id, std::string& next);
+
+private:
+	OfflineInbox();
+
+	std::size_t _max_len;
+	long long _ttl_sec;
+};
@@ -0,0 +1,175 @@
+#include "OfflineSync.h"
+#include "AsyncDBPool.h"
+#include "ClientCodec.h"
+#include "CSession.h"
+#include "MysqlMgr.h"
+
+bool OfflineSync::Start(std::shared_ptr<CSession> session, int uid)
+{
+	if (!session->TryBeginOfflineSync()) {
+		return false;
+	}
+	std::make_shared<OfflineSync>(session, uid)->Post(true);
+	return true;
+}
+
+OfflineSync::OfflineSync(std::weak_ptr<CSession> session, int uid)
+	: _session(std::move(session)), _uid(uid), _after_id(0), _db_rows(0)
+{
+}
+
+OfflineSync::~OfflineSync()
+{
+	if (std::shared_ptr<CSession> session = _session.lock()) {
+		session->EndOfflineSync();
+	}
+}
+
+void OfflineSync::Post(bool load_inbox)
+{
+	auto self = shared_from_this();
+	bool accepted = AsyncDBPool::GetInstance()->PostTask([self, load_inbox]() {
+		std::shared_ptr<CSession> session = self->_session.lock();
+		if (!session) {
+			LOG_INFO << "[OfflineSync] session expired, abort sync for uid=" << self->_uid;
+			return;
+		}
+		if (load_inbox) {
+			self->LoadInbox();
+		}
+		self->DbPage(session);
+	}, TaskPriority::High);
+	// 客户端收不到离线消息会在下次登录 / 重新拉取时再请求
+	if (!accepted) {
+		LOG_WARN << "[OfflineSync] db queue full, drop offline sync for uid=" << _uid << " after_id=" << _after_id;
+	}
+}
+
+// 预读收件箱
+//
+// 实现逻辑：
+//   按页 XRANGE 直到读完或达到 OFFLINE_INBOX_PRELOAD_MAX；Redis 出错时按空收件箱处理，只下发数据库
+void OfflineSync::LoadInbox()
+{
+	std::vector<InboxEntry> inbox;
+	std::vector<InboxEntry> page;
+	std::string cursor;
+	while (inbox.size() < OFFLINE_INBOX_PRELOAD_MAX) {
+		if (!OfflineInbox::GetInstance()->ReadPage(_uid, cursor, OFFLINE_INBOX_PAGE, page)) {
+			break;
+		}
+		for (auto& entry : page) {
+			inbox.push_back(std::move(entry));
+		}
+		if (page.size() < OFFLINE_INBOX_PAGE) {
+			break;
+		}
+		cursor = inbox.back().id;
+	}
+	_merger.reset(new OfflineMerger(std::move(inbox)));
+}
+
+// 下发数据库的一页
+//
+// 实现逻辑：
+//   1. 取 id > _after_id 的一页，与收件箱去重，重复的收件箱条目 XDEL
+//   2. 按编码后的帧长切帧下发，每帧带最后一条的 id（last_id），客户端确认后标记已读；
+//      遇到放不进一帧的消息时本页截到它之前，下发完以 MsgTooLarge 结束本次同步
+//   3. 页满时等发送队列排空再取下一页；不满说明读完，接着补发收件箱剩余的消息
+void OfflineSync::DbPage(const std::shared_ptr<CSession>& session)
+{
+	std::vector<long long> ids;
+	std::vector<std::string> payloads;
+	if (!MysqlMgr::GetInstance()->GetUnreadChatMessagesPage(_uid, _after_id, OFFLINE_PAGE_ROWS, ids, payloads)) {
+		LOG_WARN << "[OfflineSync] page query failed, uid=" << _uid << " after_id=" << _after_id
+			<< ", deliver inbox only";
+		SendLeftovers(session, _merger->TakeLeftovers(), ErrorCodes::RPCFailed);
+		return;
+	}
+	bool more = ids.size() >= OFFLINE_PAGE_ROWS;
+	std::size_t fit = FirstOversizedOffline(payloads);
+	bool oversized = fit < payloads.size();
+	if (oversized) {
+		LOG_WARN << "[OfflineSync] uid=" << _uid << " message id=" << ids[fit] << " larger than one frame ("
+			<< payloads[fit].size() << " bytes), stop sync before it";
+		ids.resize(fit);
+		payloads.resize(fit);
+		more = false;
+	}
+
+	_merger->MatchDbPage(payloads);
+	std::vector<std::string> matched = _merger->TakeMatchedIds();
+	if (!matched.empty()) {
+		OfflineInbox::GetInstance()->Delete(_uid, matched);
+	}
+
+	WireCodec codec = session->GetCodec();
+	// 最后一页之后还要补发收件箱，先确定补发是否为空，最后一帧的 more 才准确
+	std::vector<InboxEntry> leftovers;
+	if (!more && !oversized) {
+		leftovers = _merger->TakeLeftovers();
+	}
+	if (ids.empty() && leftovers.empty() && !oversized) {
+		session->Send(ClientCodec::EncodeOfflineMsgBatch(codec, payloads, 0, 0, _after_id, false),
+			ID_NOTIFY_OFFLINE_MSG_BATCH);
+	}
+	std::size_t begin = 0;
+	for (std::size_t end : OfflineFrameEnds(payloads)) {
+		bool frame_more = more || end < ids.size() || !leftovers.empty() || oversized;
+		session->Send(ClientCodec::EncodeOfflineMsgBatch(codec, payloads, begin, end, ids[end - 1], frame_more),
+			ID_NOTIFY_OFFLINE_MSG_BATCH);
+		begin = end;
+	}
+	_db_rows += ids.size();
+	if (!ids.empty()) {
+		_after_id = ids.back();
+	}
+
+	if (more) {
+		auto self = shared_from_this();
+		session->OnSendQueueDrained(OFFLINE_SEND_LOW_WATERMARK, [self]() {
+			self->Post(false);
+			});
+		return;
+	}
+
+	LOG_DEBUG << "[OfflineSync] uid=" << _uid << " db_rows=" << _db_rows << " inbox=" << _merger->InboxSize()
+		<< " deduped=" << _merger->MatchedCount() << " inbox_only=" << leftovers.size();
+	SendLeftovers(session, std::move(leftovers), oversized ? ErrorCodes::MsgTooLarge : ErrorCodes::Success);
+}
+
+// 补发只在收件箱中的消息，帧带 inbox_id，最后一帧 more 为 false
+//
+// 注意：
+//   出错时（数据库查询失败、消息过长）即使没有可发的消息也要发结束帧，客户端据此知道本次同步已结束
+void OfflineSync::SendLeftovers(const std::shared_ptr<CSession>& session, std::vector<InboxEntry> leftovers,
+	int error)
+{
+	std::vector<std::string> payloads;
+	payloads.reserve(leftovers.size());
+	for (auto& entry : leftovers) {
+		payloads.push_back(std::move(entry.payload));
+	}
+	// 确认按条目 ID 范围裁剪收件箱，放不进一帧的条目之后的都不发
+	std::size_t fit = FirstOversizedOffline(payloads);
+	if (fit < payloads.size()) {
+		LOG_WARN << "[OfflineSync] uid=" << _uid << " inbox entry " << leftovers[fit].id << " larger than one frame ("
+			<< payloads[fit].size() << " bytes), stop sync before it";
+		payloads.resize(fit);
+		leftovers.erase(leftovers.begin() + fit, leftovers.end());
+		if (error == ErrorCodes::Success) {
+			error = ErrorCodes::MsgTooLarge;
+		}
+	}
+	bool failed = error != ErrorCodes::Success;
+	WireCodec codec = session->GetCodec();
+	std::size_t begin = 0;
+	for (std::size_t end : OfflineFrameEnds(payloads)) {
+		session->Send(ClientCodec::EncodeOfflineMsgBatch(codec, payloads, begin, end, 0,
+			failed || end < leftovers.size(), leftovers[end - 1].id), ID_NOTIFY_OFFLINE_MSG_BATCH);
+		begin = end;
+	}
+	if (failed) {
+		session->Send(ClientCodec::EncodeOfflineMsgError(codec, error), ID_NOTIFY_OFFLINE_MSG_BATCH);
+	}
+}
@@ -0,0 +1,186 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "OfflineInbox.h"
+
+// 离线消息每页从库里取的条数（keyset 分页，见 MysqlDao::GetUnreadChatMessagesPage）
+#define OFFLINE_PAGE_ROWS 200
+// 离线消息单帧消息体的字节数上限（客户端 ChatClient/tcpmgr.h 的 MAX_LENGTH，超过会断开连接）
+#define OFFLINE_FRAME_MAX_BYTES 4096
+// JSON 帧外壳的最大字节数：{"error":0,"last_id":<20>,"more":false,"inbox_id":"<41>","msgs":[]} 约 120 字节
+#define OFFLINE_FRAME_ENVELOPE_BYTES 128
+// 留给消息的字节数，每条按入库 JSON 加一个逗号计（protobuf 编码不会比入库 JSON 长）
+#define OFFLINE_BATCH_BYTES (OFFLINE_FRAME_MAX_BYTES - OFFLINE_FRAME_ENVELOPE_BYTES)
+// 发送队列降到这个帧数以下才取下一页，离线下发最多占用 MAX_SENDQUE 的一小部分
+#define OFFLINE_SEND_LOW_WATERMARK 32
+// 一次同步最多预读的收件箱条数（MAXLEN ~ 是近似裁剪，收件箱可能略长于上限）
+#define OFFLINE_INBOX_PRELOAD_MAX (OFFLINE_INBOX_MAXLEN * 2)
+
+class CSession;
+
+// 单条入库 JSON 能否放进一帧离线消息（DealChatTextMsg 发送时按同一条件拒绝）
+inline bool OfflinePayloadFits(const std::string& payload)
+{
+	return payload.size() + 1 <= OFFLINE_BATCH_BYTES;
+}
+
+// 返回第一条放不进一帧的下标，都放得下时返回 payloads.size()
+//
+// 注意：
+//   客户端按 id / 条目 ID 范围确认，放不进的消息不能跳过，只能截到它之前（发送时已拒绝，只有历史数据会超长）
+inline std::size_t FirstOversizedOffline(const std::vector<std::string>& payloads)
+{
+	for (std::size_t i = 0; i < payloads.size(); ++i) {
+		if (!OfflinePayloadFits(payloads[i])) {
+			return i;
+		}
+	}
+	return payloads.size();
+}
+
+// 离线消息按编码后的帧长切帧（外壳 + 每条入库 JSON + 逗号），返回每帧的结束下标（不含），每帧至少一条
+//
+// 注意：
+//   调用前先截到 FirstOversizedOffline 之前，否则超长的单条仍会单独成帧
+inline std::vector<std::size_t> OfflineFrameEnds(const std::vector<std::string>& payloads)
+{
+	std::vector<std::size_t> ends;
+	std::size_t bytes = 0;
+	for (std::size_t i = 0; i < payloads.size(); ++i) {
+		std::size_t item = payloads[i].size() + 1;
+		if (i > 0 && bytes + item > OFFLINE_BATCH_BYTES) {
+			ends.push_back(i);
+			bytes = 0;
+		}
+		bytes += item;
+	}
+	if (!payloads.empty()) {
+		ends.push_back(payloads.size());
+	}
+	return ends;
+}
+
+// OfflineMerger：收件箱与数据库两层离线消息的去重（纯内存，不做 IO）
+//
+// 实现逻辑：
+//   1. 两层存的是同一份入库 JSON（含服务端 msg_id），内容相同即同一条消息
+//   2. 构造时为收件箱条目按内容建索引；数据库每取一页，逐行匹配并消耗一个同内容的收件箱条目
+//   3. 数据库读完后剩下未匹配的条目就是只在收件箱中的消息（写库还在攒批、或写库失败），按写入顺序补发
+//
+// 注意：
+//   索引的 key 指向 _entries 中的字符串，构造后 _entries 不再增删；TakeLeftovers 之后不能再匹配
+class OfflineMerger
+{
+public:
+	explicit OfflineMerger(std::vector<InboxEntry> inbox)
+		: _entries(std::move(inbox)), _matched(_entries.size(), false)
+	{
+		_by_payload.reserve(_entries.size());
+		for (std::size_t i = 0; i < _entries.size(); ++i) {
+			_by_payload[_entries[i].payload].idx.push_back(i);
+		}
+	}
+
+	OfflineMerger(const OfflineMerger&) = delete;
+	OfflineMerger& operator=(const OfflineMerger&) = delete;
+
+	// 匹配数据库的一页，返回本页与收件箱重复的行数
+	std::size_t MatchDbPage(const std::vector<std::string>& payloads)
+	{
+		std::size_t matched = 0;
+		for (const auto& payload : payloads) {
+			auto it = _by_payload.find(payload);
+			if (it == _by_payload.end() || it->second.next == it->second.idx.size()) {
+				continue;
+			}
+			std::size_t i = it->second.idx[it->second.next++];
+			_matched[i] = true;
+			_newly_matched.push_back(_entries[i].id);
+			++matched;
+		}
+		_total_matched += matched;
+		return matched;
+	}
+
+	// 取出上次调用以来匹配上的收件箱条目 ID（这些消息库里都有，可以从收件箱删掉）
+	std::vector<std::string> TakeMatchedIds()
+	{
+		std::vector<std::string> ids;
+		ids.swap(_newly_matched);
+		return ids;
+	}
+
+	// 数据库读完后取出未匹配的收件箱条目，按写入顺序
+	std::vector<InboxEntry> TakeLeftovers()
+	{
+		_by_payload.clear();
+		std::vector<InboxEntry> leftovers;
+		for (std::size_t i = 0; i < _entries.size(); ++i) {
+			if (!_matched[i]) {
+				leftovers.push_back(std::move(_entries[i]));
+			}
+		}
+		return leftovers;
+	}
+
+	std::size_t InboxSize() const { return _entries.size(); }
+	std::size_t MatchedCount() const { return _total_matched; }
+
+private:
+	struct Slot {
+		std::vector<std::size_t> idx;  // 同内容的条目下标，按写入顺序
+		std::size_t next = 0;          // 下一个未匹配的位置
+	};
+
+	std::vector<InboxEntry> _entries;
+	std::vector<bool> _matched;
+	std::unordered_map<std::string_view, Slot> _by_payload;
+	std::vector<std::string> _newly_matched;
+	std::size_t _total_matched = 0;
+};
+
+// OfflineSync：一次离线消息同步（拉取离线消息时创建，下发完自行结束）
+//
+// 作用：
+//   把 Redis 收件箱（快、但有长度上限和过期时间）和 MySQL messages 表（完整、持久）合并成一条有序的下发流，
+//   同一条消息只下发一次
+//
+// 实现逻辑：
+//   1. 预读收件箱（有上限），建立 OfflineMerger
+//   2. 按库内 id 分页读未读消息并下发（顺序以数据库为准），与收件箱重复的条目直接 XDEL（库里已有，不需要等确认）
+//   3. 页满时等发送队列排空再取下一页
+//   4. 数据库读完后补发只在收件箱中的消息，帧带 inbox_id，客户端确认后 XTRIM
+//   5. 数据库查询出错时退化为只下发收件箱，客户端下次拉取仍会从数据库补齐
+//   6. 遇到单条放不进一帧的历史消息时下发到它之前为止，以带错误码的帧结束（不能让客户端确认没收到的消息）
+//
+// 注意：
+//   每一步都是 AsyncDBPool 的一个 High 任务，同一时刻只有一步在运行，状态不需要加锁；
+//   只持有会话的 weak_ptr，会话断开后下一步发现会话失效即结束；
+//   同一会话同时只有一个同步（CSession::TryBeginOfflineSync），对象析构时结束
+class OfflineSync : public std::enable_shared_from_this<OfflineSync>
+{
+public:
+	// 开始同步（GetOfflineMsgHandler 调用），本会话已有同步在运行时返回 false
+	static bool Start(std::shared_ptr<CSession> session, int uid);
+
+	OfflineSync(std::weak_ptr<CSession> session, int uid);
+	~OfflineSync();
+
+private:
+	// 投递一步到 DB 线程池，load_inbox 为 true 时是第一步
+	void Post(bool load_inbox);
+	void LoadInbox();
+	void DbPage(const std::shared_ptr<CSession>& session);
+	// error 不为 0（ErrorCodes::Success）时补发的帧 more 均为 true，最后再发一个带错误码的结束帧
+	void SendLeftovers(const std::shared_ptr<CSession>& session, std::vector<InboxEntry> leftovers, int error);
+
+	std::weak_ptr<CSession> _session;
+	int _uid;
+	long long _after_id;       // 数据库游标（已下发的最大 id）
+	std::unique_ptr<OfflineMerger> _merger;
+	std::size_t _db_rows;      // 已下发的数据库消息数（日志用）
+};
@@ -19,22 +19,172 @@ namespace {
 // RAII guard：确保取到的连接会在析构时归还到池里
 class RedisConnectionGuard {
 public:
-    RedisConnectionGuard(RedisConPool* pool, redisContext* ctx) : pool_(pool), ctx_(ctx) {}
+    RedisConnectionGuard(RedisConPool* pool, redisContext* ctx) : pool_(pool), ctx_(ctx), broken_(false) {}
     ~RedisConnectionGuard() {
         if (pool_ && ctx_) {
-            pool_->returnConnection(ctx_);
+            if (broken_) {
+                pool_->returnBrokenConnection(ctx_);
+            }
+            else {
+                pool_->returnConnection(ctx_);
+            }
             // 不置 ctx_ 为 nullptr，因为析构后不会再用
         }
     }
     redisContext* get() const { return ctx_; }
+    // 标记连接出错：析构时重连后再归还，而不是原样放回池中
+    void MarkBroken() { broken_ = true; }
     // 禁止复制
     RedisConnectionGuard(const RedisConnectionGuard&) = delete;
     RedisConnectionGuard& operator=(const RedisConnectionGuard&) = delete;
 private:
     RedisConPool* pool_;
     redisContext* ctx_;
+    bool broken_;
 };
 
+// ==================== RedisPipeline ====================
+
+RedisPipeline::~RedisPipeline()
+{
+    FreeReplies();
+}
+
+RedisPipeline::RedisPipeline(RedisPipeline&& other) noexcept
+    : pool_(other.pool_), commands_(std::move(other.commands_)), replies_(std::move(other.replies_))
+{
+    other.replies_.clear();
+}
+
+RedisPipeline& RedisPipeline::Command(std::vector<std::string> args)
+{
+    commands_.push_back(std::move(args));
+    return *this;
+}
+
+// 执行所有命令
+//
+// 实现逻辑：
+//   1. 借一个连接，逐条 redisAppendCommandArgv 追加到输出缓冲区（此时不发生网络 IO）
+//   2. 第一次 redisGetReply 把缓冲区整体写出，之后依次读回每条命令的回复
+//   3. 回复保存在 replies_ 中，由析构函数或下一次 Execute 释放
+bool RedisPipeline::Execute()
+{
+    FreeReplies();
+    if (commands_.empty()) {
+        return true;
+    }
+    if (pool_ == nullptr) {
+        return false;
+    }
+
+    auto connect = pool_->getConnection();
+    if (connect == nullptr) {
+        LOG_WARN << "[RedisPipeline] getConnection returned nullptr, commands=" << commands_.size();
+        return false;
+    }
+    RedisConnectionGuard guard(pool_, connect);
+
+    std::vector<const char*> argv;
+    std::vector<size_t> argvlen;
+    for (const auto& cmd : commands_) {
+        argv.clear();
+        argvlen.clear();
+        for (const auto& arg : cmd) {
+            argv.push_back(arg.data());
+            argvlen.push_back(arg.size());
+        }
+        if (redisAppendCommandArgv(connect, static_cast<int>(argv.size()), argv.data(), argvlen.data()) != REDIS_OK) {
+            LOG_WARN << "[RedisPipeline] append failed: " << connect->errstr;
+            // 前面追加的命令还在输出缓冲区里，连接不能原样归还
+            guard.MarkBroken();
+            return false;
+        }
+    }
+
+    replies_.reserve(commands_.size());
+    for (std::size_t i = 0; i < commands_.size(); ++i) {
+        void* reply = nullptr;
+        if (redisGetReply(connect, &reply) != REDIS_OK || reply == nullptr) {
+            LOG_WARN << "[RedisPipeline] read reply " << i << "/" << commands_.size()
+                     << " failed: " << connect->errstr;
+            // 后面的回复还没读，连接不能原样归还
+            guard.MarkBroken();
+            FreeReplies();
+            return false;
+        }
+        replies_.push_back(static_cast<redisReply*>(reply));
+    }
+    LOG_DEBUG << "[RedisPipeline] executed " << commands_.size() << " commands in one round trip";
+    return true;
+}
+
+const redisReply* RedisPipeline::Reply(std::size_t index) const
+{
+    return index < replies_.size() ? replies_[index] : nullptr;
+}
+
+bool RedisPipeline::IsNil(std::size_t index) const
+{
+    const redisReply* reply = Reply(index);
+    return reply != nullptr && reply->type == REDIS_REPLY_NIL;
+}
+
+bool RedisPipeline::IsError(std::size_t index) const
+{
+    const redisReply* reply = Reply(index);
+    return reply == nullptr || reply->type == REDIS_REPLY_ERROR;
+}
+
+bool RedisPipeline::IsOk(std::size_t index) const
+{
+    const redisReply* reply = Reply(index);
+    if (reply == nullptr || reply->type != REDIS_REPLY_STATUS) {
+        return false;
+    }
+    std::string status(reply->str, reply->len);
+    return status == "OK" || status == "ok";
+}
+
+bool RedisPipeline::GetString(std::size_t index, std::string& value) const
+{
+    const redisReply* reply = Reply(index);
+    if (reply == nullptr || reply->type != REDIS_REPLY_STRING) {
+        return false;
+    }
+    value.assign(reply->str, reply->len);
+    return true;
+}
+
+long long RedisPipeline::GetInteger(std::size_t index, long long fallback) const
+{
+    const redisReply* reply = Reply(index);
+    if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER) {
+        return fallback;
+    }
+    return reply->integer;
+}
+
+bool RedisPipeline::GetArray(std::size_t index, std::vector<std::string>& values) const
+{
+    const redisReply* reply = Reply(index);
+    if (reply == nullptr || reply->type != REDIS_REPLY_ARRAY) {
+        return false;
+    }
+    for (size_t i = 0; i < reply->elements; ++i) {
+        values.push_back(replyToString(reply->element[i]));
+    }
+    return true;
+}
+
+void RedisPipeline::FreeReplies()
+{
+    for (auto* reply : replies_) {
+        freeReplyObject(reply);
+    }
+    replies_.clear();
+}
+
 // RedisMgr 构造与析构
 RedisMgr::RedisMgr()
 {
@@ -50,8 +200,8 @@ RedisMgr::RedisMgr()
     
     // 根据CPU核心数动态设置连接池大小
     size_t pool_size = std::max(16u, std::thread::hardware_concurrency() * 2);
-    std::cout << "[RedisMgr] CPU cores: " << std::thread::hardware_concurrency() 
-              << ", Redis pool size: " << pool_size << std::endl;
+    LOG_INFO << "[RedisMgr] CPU cores: " << std::thread::hardware_concurrency() 
+             << ", Redis pool size: " << pool_size;
     con_pool_.reset(new RedisConPool(pool_size, host.c_str(), port_, pwd.c_str()));
 }
 
@@ -65,64 +215,51 @@ bool RedisMgr::Get(const std::string& key, std::string& value)
 {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::Get] getConnection returned nullptr for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::Get] getConnection returned nullptr for key=" << key;
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
 
     redisReply* reply = (redisReply*)redisCommand(connect, "GET %s", key.c_str());
     if (reply == nullptr) {
-        std::cout << "[RedisMgr::Get] redisCommand returned NULL for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::Get] redisCommand returned NULL for key=" << key;
         return false;
     }
 
     if (reply->type == REDIS_REPLY_NIL) {
         // key not found
         freeReplyObject(reply);
-        std::cout << "[RedisMgr::Get] GET " << key << " -> (nil)\n";
+        LOG_DEBUG << "[RedisMgr::Get] GET " << key << " -> (nil)";
         return false;
     }
 
     if (reply->type != REDIS_REPLY_STRING) {
-        std::cout << "[RedisMgr::Get] GET " << key << " unexpected reply type=" << reply->type << std::endl;
+        LOG_WARN << "[RedisMgr::Get] GET " << key << " unexpected reply type=" << reply->type;
         freeReplyObject(reply);
         return false;
     }
 
     value.assign(reply->str, reply->len);
     freeReplyObject(reply);
-    std::cout << "Succeed to execute command [ GET " << key << " ]\n";
+    LOG_DEBUG << "Succeed to execute command [ GET " << key << " ]";
     return true;
 }
 
 // 原子地获取并清空list
+// MULTI / LRANGE / DEL / EXEC 作为一个 pipeline 发出，一次往返（原来是四次）
 bool RedisMgr::GetAllList(const std::string& key, std::vector<std::string>& values)
 {
-    auto connect = con_pool_->getConnection();
-    if (connect == nullptr) {
-        std::cout << "[RedisMgr::GetAllList] getConnection nullptr for key=" << key << std::endl;
-        return false;
-    }
-    RedisConnectionGuard guard(con_pool_.get(), connect);
-
-    // 使用 MULTI/EXEC 保证原子性
-    redisReply* multi_reply = (redisReply*)redisCommand(connect, "MULTI");
-    if (multi_reply == nullptr || multi_reply->type == REDIS_REPLY_ERROR) {
-        std::cout << "[RedisMgr::GetAllList] MULTI failed" << std::endl;
-        if (multi_reply) freeReplyObject(multi_reply);
+    RedisPipeline pipe = Pipeline();
+    pipe.Command({ "MULTI" }).LRange(key, 0, -1).Del(key).Command({ "EXEC" });
+    if (!pipe.Execute()) {
+        LOG_WARN << "[RedisMgr::GetAllList] pipeline failed for key=" << key;
         return false;
     }
-    freeReplyObject(multi_reply);
-
-    redisReply* lrange_reply = (redisReply*)redisCommand(connect, "LRANGE %s 0 -1", key.c_str());
-    redisReply* del_reply = (redisReply*)redisCommand(connect, "DEL %s", key.c_str());
 
-    redisReply* exec_reply = (redisReply*)redisCommand(connect, "EXEC");
+    // EXEC 的回复是事务内各命令回复组成的数组，第一个元素即 LRANGE 的结果
+    const redisReply* exec_reply = pipe.Reply(3);
     if (exec_reply == nullptr || exec_reply->type != REDIS_REPLY_ARRAY || exec_reply->elements < 2) {
-        std::cout << "[RedisMgr::GetAllList] EXEC failed" << std::endl;
-        if (lrange_reply) freeReplyObject(lrange_reply);
-        if (del_reply) freeReplyObject(del_reply);
-        if (exec_reply) freeReplyObject(exec_reply);
+        LOG_WARN << "[RedisMgr::GetAllList] EXEC failed";
         return false;
     }
 
@@ -130,11 +267,9 @@ bool RedisMgr::GetAllList(const std::string& key, std::vector<std::string>& valu
     redisReply* lrange_result = exec_reply->element[0];
     if (lrange_result->type == REDIS_REPLY_ARRAY) {
         for (size_t i = 0; i < lrange_result->elements; ++i) {
-            values.push_back(std::string(lrange_result->element[i]->str, lrange_result->element[i]->len));
+            values.push_back(replyToString(lrange_result->element[i]));
         }
     }
-
-    freeReplyObject(exec_reply); // lrange_reply 和 del_reply 会被 exec_reply 一起释放
     return true;
 }
 
@@ -142,14 +277,14 @@ bool RedisMgr::GetAllList(const std::string& key, std::vector<std::string>& valu
 bool RedisMgr::Set(const std::string& key, const std::string& value) {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::Set] getConnection returned nullptr for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::Set] getConnection returned nullptr for key=" << key;
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
 
     redisReply* reply = (redisReply*)redisCommand(connect, "SET %s %s", key.c_str(), value.c_str());
     if (reply == nullptr) {
-        std::cout << "[RedisMgr::Set] Execut command [ SET " << key << "  " << value << " ] failure (reply==NULL)!\n";
+        LOG_WARN << "[RedisMgr::Set] Execut command [ SET " << key << "  " << value << " ] failure (reply==NULL)!";
         return false;
     }
 
@@ -163,10 +298,10 @@ bool RedisMgr::Set(const std::string& key, const std::string& value) {
     freeReplyObject(reply);
 
     if (ok) {
-        std::cout << "Execut command [ SET " << key << "  " << value << " ] success ! " << std::endl;
+        LOG_DEBUG << "Execut command [ SET " << key << "  " << value << " ] success ! ";
         return true;
     }
-    std::cout << "Execut command [ SET " << key << "  " << value << " ] failure ! " << std::endl;
+    LOG_WARN << "Execut command [ SET " << key << "  " << value << " ] failure ! ";
     return false;
 }
 
@@ -175,14 +310,14 @@ bool RedisMgr::Auth(const std::string& password)
 {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::Auth] getConnection returned nullptr\n";
+        LOG_WARN << "[RedisMgr::Auth] getConnection returned nullptr";
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
 
     redisReply* reply = (redisReply*)redisCommand(connect, "AUTH %s", password.c_str());
     if (reply == nullptr) {
-        std::cout << "[RedisMgr::Auth] AUTH returned NULL\n";
+        LOG_WARN << "[RedisMgr::Auth] AUTH returned NULL";
         return false;
     }
 
@@ -192,8 +327,12 @@ bool RedisMgr::Auth(const std::string& password)
     }
     freeReplyObject(reply);
 
-    if (ok) std::cout << "认证成功" << std::endl;
-    else std::cout << "认证失败" << std::endl;
+    if (ok) {
+        LOG_INFO << "认证成功";
+    }
+    else {
+        LOG_WARN << "认证失败";
+    }
     return ok;
 }
 
@@ -202,14 +341,14 @@ bool RedisMgr::LPush(const std::string& key, const std::string& value)
 {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::LPush] getConnection nullptr for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::LPush] getConnection nullptr for key=" << key;
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
 
     redisReply* reply = (redisReply*)redisCommand(connect, "LPUSH %s %s", key.c_str(), value.c_str());
     if (reply == nullptr) {
-        std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] failure (reply==NULL)!\n";
+        LOG_WARN << "Execut command [ LPUSH " << key << "  " << value << " ] failure (reply==NULL)!";
         return false;
     }
 
@@ -217,10 +356,10 @@ bool RedisMgr::LPush(const std::string& key, const std::string& value)
     freeReplyObject(reply);
 
     if (ok) {
-        std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] success ! " << std::endl;
+        LOG_DEBUG << "Execut command [ LPUSH " << key << "  " << value << " ] success ! ";
         return true;
     }
-    std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] failure ! " << std::endl;
+    LOG_WARN << "Execut command [ LPUSH " << key << "  " << value << " ] failure ! ";
     return false;
 }
 
@@ -228,31 +367,31 @@ bool RedisMgr::LPush(const std::string& key, const std::string& value)
 bool RedisMgr::LPop(const std::string& key, std::string& value) {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::LPop] getConnection nullptr for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::LPop] getConnection nullptr for key=" << key;
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
 
     redisReply* reply = (redisReply*)redisCommand(connect, "LPOP %s", key.c_str());
     if (reply == nullptr) {
-        std::cout << "Execut command [ LPOP " << key << " ] failure (reply==NULL)!\n";
+        LOG_WARN << "Execut command [ LPOP " << key << " ] failure (reply==NULL)!";
         return false;
     }
 
     if (reply->type == REDIS_REPLY_NIL) {
         freeReplyObject(reply);
-        std::cout << "Execut command [ LPOP " << key << " ] -> (nil)\n";
+        LOG_DEBUG << "Execut command [ LPOP " << key << " ] -> (nil)";
         return false;
     }
     if (reply->type != REDIS_REPLY_STRING) {
         freeReplyObject(reply);
-        std::cout << "Execut command [ LPOP " << key << " ] unexpected type=" << reply->type << "\n";
+        LOG_WARN << "Execut command [ LPOP " << key << " ] unexpected type=" << reply->type;
         return false;
     }
 
     value.assign(reply->str, reply->len);
     freeReplyObject(reply);
-    std::cout << "Execut command [ LPOP " << key << " ] success ! " << std::endl;
+    LOG_DEBUG << "Execut command [ LPOP " << key << " ] success ! ";
     return true;
 }
 
@@ -260,14 +399,14 @@ bool RedisMgr::LPop(const std::string& key, std::string& value) {
 bool RedisMgr::RPush(const std::string& key, const std::string& value) {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::RPush] getConnection nullptr for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::RPush] getConnection nullptr for key=" << key;
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
 
     redisReply* reply = (redisReply*)redisCommand(connect, "RPUSH %s %s", key.c_str(), value.c_str());
     if (reply == nullptr) {
-        std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] failure (reply==NULL)!\n";
+        LOG_WARN << "Execut command [ RPUSH " << key << "  " << value << " ] failure (reply==NULL)!";
         return false;
     }
 
@@ -275,10 +414,10 @@ bool RedisMgr::RPush(const std::string& key, const std::string& value) {
     freeReplyObject(reply);
 
     if (ok) {
-        std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] success ! " << std::endl;
+        LOG_DEBUG << "Execut command [ RPUSH " << key << "  " << value << " ] success ! ";
         return true;
     }
-    std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] failure ! " << std::endl;
+    LOG_WARN << "Execut command [ RPUSH " << key << "  " << value << " ] failure ! ";
     return false;
 }
 
@@ -286,31 +425,31 @@ bool RedisMgr::RPush(const std::string& key, const std::string& value) {
 bool RedisMgr::RPop(const std::string& key, std::string& value) {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::RPop] getConnection nullptr for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::RPop] getConnection nullptr for key=" << key;
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
 
     redisReply* reply = (redisReply*)redisCommand(connect, "RPOP %s", key.c_str());
     if (reply == nullptr) {
-        std::cout << "Execut command [ RPOP " << key << " ] failure (reply==NULL)!\n";
+        LOG_WARN << "Execut command [ RPOP " << key << " ] failure (reply==NULL)!";
         return false;
     }
 
     if (reply->type == REDIS_REPLY_NIL) {
         freeReplyObject(reply);
-        std::cout << "Execut command [ RPOP " << key << " ] -> (nil)\n";
+        LOG_DEBUG << "Execut command [ RPOP " << key << " ] -> (nil)";
         return false;
     }
     if (reply->type != REDIS_REPLY_STRING) {
         freeReplyObject(reply);
-        std::cout << "Execut command [ RPOP " << key << " ] unexpected type=" << reply->type << "\n";
+        LOG_WARN << "Execut command [ RPOP " << key << " ] unexpected type=" << reply->type;
         return false;
     }
 
     value.assign(reply->str, reply->len);
     freeReplyObject(reply);
-    std::cout << "Execut command [ RPOP " << key << " ] success ! " << std::endl;
+    LOG_DEBUG << "Execut command [ RPOP " << key << " ] success ! ";
     return true;
 }
 
@@ -318,14 +457,14 @@ bool RedisMgr::RPop(const std::string& key, std::string& value) {
 bool RedisMgr::HSet(const std::string& key, const std::string& hkey, const std::string& value) {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::HSet] getConnection nullptr for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::HSet] getConnection nullptr for key=" << key;
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
 
     redisReply* reply = (redisReply*)redisCommand(connect, "HSET %s %s %s", key.c_str(), hkey.c_str(), value.c_str());
     if (reply == nullptr) {
-        std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] failure (reply==NULL)!\n";
+        LOG_WARN << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] failure (reply==NULL)!";
         return false;
     }
 
@@ -333,10 +472,10 @@ bool RedisMgr::HSet(const std::string& key, const std::string& hkey, const std::
     freeReplyObject(reply);
 
     if (ok) {
-        std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] success ! " << std::endl;
+        LOG_DEBUG << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] success ! ";
         return true;
     }
-    std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] failure ! " << std::endl;
+    LOG_WARN << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] failure ! ";
     return false;
 }
 
@@ -345,7 +484,7 @@ bool RedisMgr::HSet(const char* key, const char* hkey, const char* hvalue, size_
 {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::HSet(binary)] getConnection nullptr\n";
+        LOG_WARN << "[RedisMgr::HSet(binary)] getConnection nullptr";
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
@@ -363,7 +502,7 @@ bool RedisMgr::HSet(const char* key, const char* hkey, const char* hvalue, size_
 
     redisReply* reply = (redisReply*)redisCommandArgv(connect, 4, argv, argvlen);
     if (reply == nullptr) {
-        std::cout << "Execut command [ HSet(binary) ] failure (reply==NULL)!\n";
+        LOG_WARN << "Execut command [ HSet(binary) ] failure (reply==NULL)!";
         return false;
     }
 
@@ -371,10 +510,10 @@ bool RedisMgr::HSet(const char* key, const char* hkey, const char* hvalue, size_
     freeReplyObject(reply);
 
     if (ok) {
-        std::cout << "Execut command [ HSet(binary) ] success ! " << std::endl;
+        LOG_DEBUG << "Execut command [ HSet(binary) ] success ! ";
         return true;
     }
-    std::cout << "Execut command [ HSet(binary) ] failure ! " << std::endl;
+    LOG_WARN << "Execut command [ HSet(binary) ] failure ! ";
     return false;
 }
 
@@ -382,7 +521,7 @@ bool RedisMgr::HDel(const std::string& key, const std::string& field)
 {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::HDel] getConnection returned nullptr for key=" << key << " field=" << field << std::endl;
+        LOG_WARN << "[RedisMgr::HDel] getConnection returned nullptr for key=" << key << " field=" << field;
         return false;
     }
     // RAII: 确保连接会被归还到连接池
@@ -391,7 +530,7 @@ bool RedisMgr::HDel(const std::string& key, const std::string& field)
     // 执行 HDEL 命令
     redisReply* reply = (redisReply*)redisCommand(connect, "HDEL %s %s", key.c_str(), field.c_str());
     if (reply == nullptr) {
-        std::cout << "Execut command [ HDEL " << key << " " << field << " ] failure (reply==NULL)!\n";
+        LOG_WARN << "Execut command [ HDEL " << key << " " << field << " ] failure (reply==NULL)!";
         return false;
     }
 
@@ -406,17 +545,17 @@ bool RedisMgr::HDel(const std::string& key, const std::string& field)
         }
     }
     else {
-        std::cout << "Execut command [ HDEL " << key << " " << field << " ] unexpected reply type=" << reply->type << std::endl;
+        LOG_WARN << "Execut command [ HDEL " << key << " " << field << " ] unexpected reply type=" << reply->type;
     }
 
     freeReplyObject(reply);
 
     if (ok) {
-        std::cout << "Execut command [ HDEL " << key << " " << field << " ] success ! " << std::endl;
+        LOG_DEBUG << "Execut command [ HDEL " << key << " " << field << " ] success ! ";
         return true;
     }
     else {
-        std::cout << "Execut command [ HDEL " << key << " " << field << " ] no field removed.\n";
+        LOG_DEBUG << "Execut command [ HDEL " << key << " " << field << " ] no field removed.";
         return false;
     }
 }
@@ -427,7 +566,7 @@ std::string RedisMgr::HGet(const std::string& key, const std::string& hkey)
 {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::HGet] getConnection nullptr for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::HGet] getConnection nullptr for key=" << key;
         return "";
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
@@ -443,25 +582,25 @@ std::string RedisMgr::HGet(const std::string& key, const std::string& hkey)
 
     redisReply* reply = (redisReply*)redisCommandArgv(connect, 3, argv, argvlen);
     if (reply == nullptr) {
-        std::cout << "Execut command [ HGet " << key << " " << hkey << " ] failure (reply==NULL)!\n";
+        LOG_WARN << "Execut command [ HGet " << key << " " << hkey << " ] failure (reply==NULL)!";
         return "";
     }
 
     if (reply->type == REDIS_REPLY_NIL) {
         freeReplyObject(reply);
-        std::cout << "Execut command [ HGet " << key << " " << hkey << " ] -> (nil)\n";
+        LOG_DEBUG << "Execut command [ HGet " << key << " " << hkey << " ] -> (nil)";
         return "";
     }
 
     if (reply->type != REDIS_REPLY_STRING) {
-        std::cout << "Execut command [ HGet " << key << " " << hkey << " ] unexpected type=" << reply->type << std::endl;
+        LOG_WARN << "Execut command [ HGet " << key << " " << hkey << " ] unexpected type=" << reply->type;
         freeReplyObject(reply);
         return "";
     }
 
     std::string value(reply->str, reply->len);
     freeReplyObject(reply);
-    std::cout << "Execut command [ HGet " << key << " " << hkey << " ] success ! " << std::endl;
+    LOG_DEBUG << "Execut command [ HGet " << key << " " << hkey << " ] success ! ";
     return value;
 }
 
@@ -470,14 +609,14 @@ bool RedisMgr::Del(const std::string& key)
 {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::Del] getConnection nullptr for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::Del] getConnection nullptr for key=" << key;
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
 
     redisReply* reply = (redisReply*)redisCommand(connect, "DEL %s", key.c_str());
     if (reply == nullptr) {
-        std::cout << "Execut command [ Del " << key << " ] failure (reply==NULL)!\n";
+        LOG_WARN << "Execut command [ Del " << key << " ] failure (reply==NULL)!";
         return false;
     }
 
@@ -485,10 +624,10 @@ bool RedisMgr::Del(const std::string& key)
     freeReplyObject(reply);
 
     if (ok) {
-        std::cout << "Execut command [ Del " << key << " ] success ! " << std::endl;
+        LOG_DEBUG << "Execut command [ Del " << key << " ] success ! ";
         return true;
     }
-    std::cout << "Execut command [ Del " << key << " ] failure ! " << std::endl;
+    LOG_WARN << "Execut command [ Del " << key << " ] failure ! ";
     return false;
 }
 
@@ -497,14 +636,14 @@ bool RedisMgr::ExistsKey(const std::string& key)
 {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::ExistsKey] getConnection nullptr for key=" << key << std::endl;
+        LOG_WARN << "[RedisMgr::ExistsKey] getConnection nullptr for key=" << key;
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
 
     redisReply* reply = (redisReply*)redisCommand(connect, "EXISTS %s", key.c_str());
     if (reply == nullptr) {
-        std::cout << "Not Found [ Key " << key << " ]  ! (reply==NULL)\n";
+        LOG_DEBUG << "Not Found [ Key " << key << " ]  ! (reply==NULL)";
         return false;
     }
 
@@ -512,10 +651,10 @@ bool RedisMgr::ExistsKey(const std::string& key)
     freeReplyObject(reply);
 
     if (ok) {
-        std::cout << " Found [ Key " << key << " ] exists ! " << std::endl;
+        LOG_DEBUG << " Found [ Key " << key << " ] exists ! ";
         return true;
     }
-    std::cout << " Not Found [ Key " << key << " ] ! " << std::endl;
+    LOG_DEBUG << " Not Found [ Key " << key << " ] ! ";
     return false;
 }
 
@@ -529,13 +668,18 @@ void RedisMgr::Close()
     }
 }
 
+RedisPipeline RedisMgr::Pipeline()
+{
+    return RedisPipeline(con_pool_.get());
+}
+
 // ==================== Pub/Sub 支持 ====================
 
 bool RedisMgr::Publish(const std::string& channel, const std::string& message)
 {
     auto connect = con_pool_->getConnection();
     if (connect == nullptr) {
-        std::cout << "[RedisMgr::Publish] getConnection nullptr for channel=" << channel << std::endl;
+        LOG_WARN << "[RedisMgr::Publish] getConnection nullptr for channel=" << channel;
         return false;
     }
     RedisConnectionGuard guard(con_pool_.get(), connect);
@@ -543,16 +687,16 @@ bool RedisMgr::Publish(const std::string& channel, const std::string& message)
     redisReply* reply = (redisReply*)redisCommand(connect, "PUBLISH %s %s", 
                                                    channel.c_str(), message.c_str());
     if (reply == nullptr) {
-        std::cout << "[RedisMgr::Publish] redisCommand returned NULL for channel=" << channel << std::endl;
+        LOG_WARN << "[RedisMgr::Publish] redisCommand returned NULL for channel=" << channel;
         return false;
     }
 
     bool ok = (reply->type == REDIS_REPLY_INTEGER);
     if (ok) {
-        std::cout << "[RedisMgr::Publish] Published to " << channel 
-                  << ", subscribers: " << reply->integer << std::endl;
+        LOG_DEBUG << "[RedisMgr::Publish] Published to " << channel 
+                  << ", subscribers: " << reply->integer;
     } else {
-        std::cout << "[RedisMgr::Publish] Failed, reply type=" << reply->type << std::endl;
+        LOG_WARN << "[RedisMgr::Publish] Failed, reply type=" << reply->type;
     }
     
     freeReplyObject(reply);
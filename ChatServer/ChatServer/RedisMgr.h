@@ -1,34 +1,32 @@
 #pragma once
 #include"const.h"
+#include<chrono>
 
+// 连接全部借出且已到上限时，getConnection 最多等待的毫秒数
+#define REDIS_POOL_ACQUIRE_TIMEOUT_MS 3000
+// 新建连接（含补充断开的连接）的连接超时
+#define REDIS_POOL_CONNECT_TIMEOUT_MS 1000
+
+// RedisConPool：同步 Redis 连接池
+//
+// 实现逻辑：
+//   1. 构造时建好 poolSize 条连接，失败的不重试，由 getConnection 按需补齐
+//   2. 连接数（含借出的）记在 total_ 中；重连失败释放的连接让出名额，下一个取连接的线程新建一条补上
+//   3. 没有空闲连接且已到上限时最多等待 REDIS_POOL_ACQUIRE_TIMEOUT_MS，超时返回 nullptr，
+//      Redis 不可用时调用方快速失败，不会永久阻塞（DB 线程上的 OfflineInbox 也走这里）
 class RedisConPool {
 public:
     RedisConPool(size_t poolSize, const char* host, int port, const char* pwd)
-        : poolSize_(poolSize), host_(host), port_(port), b_stop_(false) {
+        : b_stop_(false), poolSize_(poolSize), host_(host), port_(port), pwd_(pwd), total_(0) {
         for (size_t i = 0; i < poolSize_; ++i) {
-            auto* context = redisConnect(host, port);
-            if (context == nullptr || context->err != 0) {
-                if (context != nullptr) {
-                    redisFree(context);
-                }
-                continue;
-            }
-
-            auto reply = (redisReply*)redisCommand(context, "AUTH %s", pwd);
-            if (reply->type == REDIS_REPLY_ERROR) {
-                std::cout << "??????" << std::endl;
-                //??г?? ???redisCommand??к????redisReply?????????
-                redisFree(context);
-                freeReplyObject(reply);
+            auto* context = createConnection();
+            if (context == nullptr) {
                 continue;
             }
-
-            //??г?? ???redisCommand??к????redisReply?????????
-            freeReplyObject(reply);
-            std::cout << "??????" << std::endl;
             connections_.push(context);
+            ++total_;
         }
-
+        LOG_INFO << "[RedisConPool] connections = " << total_ << "/" << poolSize_;
     }
 
     ~RedisConPool() {
@@ -38,21 +36,48 @@ public:
         }
     }
 
+    // 取一个连接
+    // 实现逻辑：
+    //   - 有空闲连接直接取
+    //   - 没有空闲连接且未到上限：预留名额后在锁外新建（补充之前释放的连接）
+    //   - 已到上限：等待归还，超时返回 nullptr
+    // 调用者必须检查返回值是否为 nullptr
     redisContext* getConnection() {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(REDIS_POOL_ACQUIRE_TIMEOUT_MS);
+        bool create_failed = false;
         std::unique_lock<std::mutex> lock(mutex_);
-        cond_.wait(lock, [this] {
+        for (;;) {
             if (b_stop_) {
-                return true;
+                return nullptr;
+            }
+
+            if (!connections_.empty()) {
+                auto* context = connections_.front();
+                connections_.pop();
+                return context;
+            }
+
+            // 新建失败过就不再重试（Redis 可能不可用），剩余时间内等待别的线程归还
+            if (total_ < poolSize_ && !create_failed) {
+                ++total_;  // 预留名额，新建期间其他线程不会超过上限
+                lock.unlock();
+                auto* context = createConnection();
+                if (context != nullptr) {
+                    LOG_INFO << "[RedisConPool] created a replacement connection";
+                    return context;
+                }
+                create_failed = true;
+                lock.lock();
+                --total_;
+                continue;
+            }
+
+            if (cond_.wait_until(lock, deadline) == std::cv_status::timeout && connections_.empty()) {
+                LOG_WARN << "[RedisConPool] getConnection timeout after " << REDIS_POOL_ACQUIRE_TIMEOUT_MS
+                    << "ms, connections=" << total_ << "/" << poolSize_;
+                return nullptr;
             }
-            return !connections_.empty();
-            });
-        //?????????????????
-        if (b_stop_) {
-            return  nullptr;
         }
-        auto* context = connections_.front();
-        connections_.pop();
-        return context;
     }
 
     void returnConnection(redisContext* context) {
@@ -64,21 +89,137 @@ public:
         cond_.notify_one();
     }
 
+    // 归还一个出错的连接（输出缓冲区里可能还有没发出的命令，或者还有没读的回复）
+    // 实现逻辑：
+    //   redisReconnect 关闭旧 socket、清空缓冲区并重新连接，再重新 AUTH 后放回池中；
+    //   重连失败时释放该连接并让出名额，不把状态不明的连接交给下一个使用者，由下一个取连接的线程补上
+    void returnBrokenConnection(redisContext* context) {
+        if (redisReconnect(context) == REDIS_OK && auth(context)) {
+            LOG_INFO << "[RedisConPool] reconnected a broken connection";
+            returnConnection(context);
+            return;
+        }
+        LOG_WARN << "[RedisConPool] reconnect failed, drop connection: " << context->errstr;
+        redisFree(context);
+        std::lock_guard<std::mutex> lock(mutex_);
+        --total_;
+        // 等待中的线程可以用让出的名额新建连接
+        cond_.notify_one();
+    }
+
     void Close() {
         b_stop_ = true;
         cond_.notify_all();
     }
 
 private:
+    // 新建一条连接并 AUTH，失败返回 nullptr（不持有锁调用）
+    redisContext* createConnection() {
+        timeval timeout = { REDIS_POOL_CONNECT_TIMEOUT_MS / 1000, (REDIS_POOL_CONNECT_TIMEOUT_MS % 1000) * 1000 };
+        auto* context = redisConnectWithTimeout(host_.c_str(), port_, timeout);
+        if (context == nullptr || context->err != 0) {
+            LOG_WARN << "[RedisConPool] connect " << host_ << ":" << port_ << " failed: "
+                << (context != nullptr ? context->errstr : "can't allocate redis context");
+            if (context != nullptr) {
+                redisFree(context);
+            }
+            return nullptr;
+        }
+        if (!auth(context)) {
+            LOG_WARN << "[RedisConPool] AUTH failed";
+            redisFree(context);
+            return nullptr;
+        }
+        return context;
+    }
+
+    bool auth(redisContext* context) {
+        auto reply = (redisReply*)redisCommand(context, "AUTH %s", pwd_.c_str());
+        bool ok = reply != nullptr && reply->type != REDIS_REPLY_ERROR;
+        if (reply != nullptr) {
+            freeReplyObject(reply);
+        }
+        return ok;
+    }
+
     std::atomic<bool> b_stop_;
     size_t poolSize_;
-    const char* host_;
+    std::string host_;
     int port_;
+    std::string pwd_;
     std::queue<redisContext*> connections_;
+    size_t total_;  // 已建立的连接数（含借出的），由 mutex_ 保护
     std::mutex mutex_;
     std::condition_variable cond_;
 };
 
+// RedisPipeline：批量命令构建器
+//
+// 作用：
+//   把多条命令先用 redisAppendCommandArgv 追加到同一连接的输出缓冲区，Execute 时一次写出、
+//   再依次读回所有回复，N 条命令只需一次网络往返（原来每条命令都要借一次连接、等一次回复）
+//
+// 使用方式：
+//   auto pipe = RedisMgr::GetInstance()->Pipeline();
+//   pipe.Get(key).HIncrBy(LOGIN_COUNT, name, 1);
+//   if (pipe.Execute()) { pipe.GetString(0, value); long long n = pipe.GetInteger(1); }
+//
+// 注意：
+//   回复按命令添加顺序编号（从 0 开始）；Execute 失败时不能读取回复
+class RedisPipeline
+{
+public:
+    explicit RedisPipeline(RedisConPool* pool) : pool_(pool) {}
+    ~RedisPipeline();
+    RedisPipeline(RedisPipeline&& other) noexcept;
+    RedisPipeline(const RedisPipeline&) = delete;
+    RedisPipeline& operator=(const RedisPipeline&) = delete;
+
+    // 添加任意命令（参数二进制安全）
+    RedisPipeline& Command(std::vector<std::string> args);
+    RedisPipeline& Get(const std::string& key) { return Command({ "GET", key }); }
+    RedisPipeline& Set(const std::string& key, const std::string& value) { return Command({ "SET", key, value }); }
+    RedisPipeline& Del(const std::string& key) { return Command({ "DEL", key }); }
+    RedisPipeline& HGet(const std::string& key, const std::string& field) { return Command({ "HGET", key, field }); }
+    RedisPipeline& HSet(const std::string& key, const std::string& field, const std::string& value) {
+        return Command({ "HSET", key, field, value });
+    }
+    RedisPipeline& HIncrBy(const std::string& key, const std::string& field, long long increment) {
+        return Command({ "HINCRBY", key, field, std::to_string(increment) });
+    }
+    RedisPipeline& LPush(const std::string& key, const std::string& value) { return Command({ "LPUSH", key, value }); }
+    RedisPipeline& LRange(const std::string& key, long long start, long long stop) {
+        return Command({ "LRANGE", key, std::to_string(start), std::to_string(stop) });
+    }
+
+    // 一次往返执行所有已添加的命令；连接不可用或读写出错时返回 false
+    bool Execute();
+
+    // 命令条数 / 已收到的回复条数
+    std::size_t Size() const { return commands_.size(); }
+    std::size_t ReplyCount() const { return replies_.size(); }
+
+    // ========== 回复访问（index 为命令添加顺序） ==========
+    const redisReply* Reply(std::size_t index) const;
+    bool IsNil(std::size_t index) const;
+    bool IsError(std::size_t index) const;
+    // 状态回复 "OK"
+    bool IsOk(std::size_t index) const;
+    // 字符串回复：成功时写入 value 并返回 true；nil 或类型不符返回 false
+    bool GetString(std::size_t index, std::string& value) const;
+    // 整数回复：类型不符时返回 fallback
+    long long GetInteger(std::size_t index, long long fallback = 0) const;
+    // 数组回复中的字符串元素
+    bool GetArray(std::size_t index, std::vector<std::string>& values) const;
+
+private:
+    void FreeReplies();
+
+    RedisConPool* pool_;
+    std::vector<std::vector<std::string>> commands_;
+    std::vector<redisReply*> replies_;
+};
+
 class RedisMgr : public Singleton<RedisMgr>,
     public std::enable_shared_from_this<RedisMgr>
 {
@@ -101,6 +242,9 @@ public:
     bool Del(const std::string& key);
     bool ExistsKey(const std::string& key);
     void Close();
+
+    // 创建批量命令构建器（见 RedisPipeline），多条命令一次往返
+    RedisPipeline Pipeline();
     
     // ==================== Pub/Sub 支持 ====================
     
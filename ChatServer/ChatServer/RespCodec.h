@@ -0,0 +1,199 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// RESP 协议编解码（Redis 序列化协议 v2）
+//
+// 作用：
+//   供 AsyncRedisConnection 在 Asio socket 上直接收发 Redis 命令，不依赖 hiredis 的阻塞上下文。
+//   编码只做字符串追加，多条命令可以连续编码进同一个缓冲区一次写出（pipeline）。
+
+// Redis 回复
+struct RedisValue {
+	enum class Type : uint8_t {
+		Nil,      // $-1 / *-1
+		Status,   // +OK
+		Error,    // -ERR ...（连接断开时客户端也会构造 Error 回调给调用者）
+		Integer,  // :1
+		String,   // $n
+		Array,    // *n
+	};
+
+	Type type = Type::Nil;
+	std::string str;                  // Status / Error / String 的内容
+	long long integer = 0;            // Integer 的值
+	std::vector<RedisValue> elements; // Array 的元素
+
+	bool IsNil() const { return type == Type::Nil; }
+	bool IsError() const { return type == Type::Error; }
+	bool IsString() const { return type == Type::String; }
+	bool IsInteger() const { return type == Type::Integer; }
+	bool IsOk() const { return type == Type::Status && (str == "OK" || str == "ok"); }
+
+	static RedisValue MakeError(std::string message) {
+		RedisValue value;
+		value.type = Type::Error;
+		value.str = std::move(message);
+		return value;
+	}
+};
+
+// 把一条命令按 RESP 数组格式追加到 out：*<argc>\r\n$<len>\r\n<arg>\r\n...
+// 参数以二进制安全的方式写入，不需要像 redisCommand 那样转义空格
+template <typename Args>
+inline void RespAppendCommand(std::string& out, const Args& args) {
+	out.push_back('*');
+	out.append(std::to_string(args.size()));
+	out.append("\r\n");
+	for (const auto& arg : args) {
+		std::string_view view(arg);
+		out.push_back('$');
+		out.append(std::to_string(view.size()));
+		out.append("\r\n");
+		out.append(view.data(), view.size());
+		out.append("\r\n");
+	}
+}
+
+// RespParser：增量式回复解析器
+//
+// 实现逻辑：
+//   1. Feed 追加从 socket 读到的字节（可以是半个回复，也可以是多个回复）
+//   2. Next 尝试从当前位置解析一个完整回复：数据不够时返回 NeedMore 且不消费任何字节，
+//      下次 Feed 之后从同一位置重新解析
+//   3. 已消费的前缀在超过缓冲区一半时整体前移，避免缓冲区无限增长
+class RespParser
+{
+public:
+	enum class Result { Ok, NeedMore, Error };
+
+	void Feed(const char* data, std::size_t len) {
+		if (_pos > 0 && _pos * 2 >= _buf.size()) {
+			_buf.erase(0, _pos);
+			_pos = 0;
+		}
+		_buf.append(data, len);
+	}
+
+	Result Next(RedisValue& out) {
+		std::size_t pos = _pos;
+		Result result = ParseValue(pos, out, 0);
+		if (result == Result::Ok) {
+			_pos = pos;
+		}
+		return result;
+	}
+
+	void Reset() {
+		_buf.clear();
+		_pos = 0;
+	}
+
+	// 尚未消费的字节数
+	std::size_t Buffered() const { return _buf.size() - _pos; }
+
+private:
+	// 嵌套数组深度上限，防止畸形数据导致递归过深
+	static constexpr int kMaxDepth = 16;
+
+	// 读取一行（不含 \r\n），返回 false 表示数据不足
+	bool ReadLine(std::size_t& pos, std::string_view& line) const {
+		std::size_t end = _buf.find("\r\n", pos);
+		if (end == std::string::npos) {
+			return false;
+		}
+		line = std::string_view(_buf.data() + pos, end - pos);
+		pos = end + 2;
+		return true;
+	}
+
+	static bool ParseInteger(std::string_view text, long long& value) {
+		if (text.empty()) {
+			return false;
+		}
+		std::string tmp(text);
+		char* end = nullptr;
+		value = std::strtoll(tmp.c_str(), &end, 10);
+		return end == tmp.c_str() + tmp.size();
+	}
+
+	Result ParseValue(std::size_t& pos, RedisValue& out, int depth) const {
+		if (pos >= _buf.size()) {
+			return Result::NeedMore;
+		}
+		char prefix = _buf[pos];
+		std::size_t cursor = pos + 1;
+		std::string_view line;
+		if (!ReadLine(cursor, line)) {
+			return Result::NeedMore;
+		}
+
+		switch (prefix) {
+		case '+':
+		case '-':
+			out.type = prefix == '+' ? RedisValue::Type::Status : RedisValue::Type::Error;
+			out.str.assign(line.data(), line.size());
+			break;
+		case ':':
+			out.type = RedisValue::Type::Integer;
+			if (!ParseInteger(line, out.integer)) {
+				return Result::Error;
+			}
+			break;
+		case '$': {
+			long long len = 0;
+			if (!ParseInteger(line, len) || len < -1) {
+				return Result::Error;
+			}
+			if (len == -1) {
+				out.type = RedisValue::Type::Nil;
+				break;
+			}
+			if (_buf.size() < cursor + static_cast<std::size_t>(len) + 2) {
+				return Result::NeedMore;
+			}
+			out.type = RedisValue::Type::String;
+			out.str.assign(_buf.data() + cursor, static_cast<std::size_t>(len));
+			cursor += static_cast<std::size_t>(len) + 2;
+			break;
+		}
+		case '*': {
+			long long count = 0;
+			if (!ParseInteger(line, count) || count < -1 || depth >= kMaxDepth) {
+				return Result::Error;
+			}
+			if (count == -1) {
+				out.type = RedisValue::Type::Nil;
+				break;
+			}
+			// 最短的元素（如 ":0\r\n"）也有 4 字节，剩余数据明显不够时先不分配元素
+			if (static_cast<unsigned long long>(count) > (_buf.size() - cursor) / 4) {
+				return Result::NeedMore;
+			}
+			out.type = RedisValue::Type::Array;
+			out.elements.clear();
+			out.elements.resize(static_cast<std::size_t>(count));
+			for (auto& element : out.elements) {
+				Result result = ParseValue(cursor, element, depth + 1);
+				if (result != Result::Ok) {
+					return result;
+				}
+			}
+			break;
+		}
+		default:
+			return Result::Error;
+		}
+
+		pos = cursor;
+		return Result::Ok;
+	}
+
+	std::string _buf;
+	std::size_t _pos = 0;
+};
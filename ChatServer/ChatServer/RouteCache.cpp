@@ -0,0 +1,119 @@
+#include "RouteCache.h"
+#include "RedisMgr.h"
+#include "AsyncRedisMgr.h"
+#include "const.h"
+#include <iomanip>
+
+RouteCache::RouteCache()
+	: _routes(ROUTE_CACHE_CAPACITY_PER_SHARD, ROUTE_CACHE_SHARDS), _enabled(false), _epoch(0), _lookups(0), _redis_lookups(0)
+{
+}
+
+RouteCache::~RouteCache()
+{
+	Stop();
+}
+
+// 启动失效订阅
+//
+// 实现逻辑：
+//   复用 CacheInvalidationSync（独立订阅连接 + 订阅线程），单个失效删除对应 uid，
+//   批量失效逐个删除，CLEAR_ALL 清空整个缓存
+void RouteCache::Start()
+{
+	if (_sync) {
+		return;
+	}
+	_sync.reset(new CacheInvalidationSync(ROUTE_INVALIDATION_CHANNEL));
+	_sync->SetInvalidateCallback([this](int uid) {
+		Invalidate(uid);
+		});
+	_sync->SetInvalidateBatchCallback([this](const std::vector<int>& uids) {
+		for (int uid : uids) {
+			Invalidate(uid);
+		}
+		});
+	_sync->SetClearAllCallback([this]() {
+		_epoch.fetch_add(1, std::memory_order_acq_rel);
+		_routes.clear();
+		});
+
+	if (!_sync->Start()) {
+		// 收不到失效消息时缓存可能长期持有旧路由，直接关闭缓存，每次都查 Redis
+		LOG_WARN << "[RouteCache] invalidation subscriber failed to start, cache disabled";
+		_sync.reset();
+		return;
+	}
+	_enabled.store(true, std::memory_order_release);
+	LOG_INFO << "[RouteCache] started, channel=" << ROUTE_INVALIDATION_CHANNEL;
+}
+
+void RouteCache::Stop()
+{
+	_enabled.store(false, std::memory_order_release);
+	if (_sync) {
+		_sync->Stop();
+		_sync.reset();
+	}
+}
+
+// 查询用户所在服务器
+//
+// 实现逻辑：
+//   1. 命中直接返回（空串表示不在线）
+//   2. 未命中时记录当前失效纪元，读 Redis uip_
+//   3. 读取期间没有发生失效才回填：在线路由用长 TTL，不在线用短 TTL
+bool RouteCache::GetRoute(int uid, std::string& server)
+{
+	uint64_t lookups = _lookups.fetch_add(1, std::memory_order_relaxed) + 1;
+	if (lookups % ROUTE_CACHE_STATS_INTERVAL == 0) {
+		LogStats();
+	}
+
+	bool enabled = _enabled.load(std::memory_order_acquire);
+	if (enabled) {
+		auto cached = _routes.get(uid);
+		if (cached) {
+			server = *cached;
+			return !server.empty();
+		}
+	}
+
+	uint64_t epoch = _epoch.load(std::memory_order_acquire);
+	_redis_lookups.fetch_add(1, std::memory_order_relaxed);
+	std::string value;
+	bool found = RedisMgr::GetInstance()->Get(USERIPPREFIX + std::to_string(uid), value);
+	if (!found) {
+		value.clear();
+	}
+
+	if (enabled && _epoch.load(std::memory_order_acquire) == epoch) {
+		_routes.put(uid, value, found ? ROUTE_CACHE_TTL_MS : ROUTE_CACHE_NEGATIVE_TTL_MS);
+	}
+	server = value;
+	return found;
+}
+
+void RouteCache::Invalidate(int uid)
+{
+	_epoch.fetch_add(1, std::memory_order_acq_rel);
+	_routes.remove(uid);
+}
+
+// 失效并广播：本地立即删除，PUBLISH 走异步客户端，不占用调用线程
+void RouteCache::PublishInvalidation(int uid)
+{
+	Invalidate(uid);
+	AsyncRedisMgr::GetInstance()->Command(
+		{ "PUBLISH", ROUTE_INVALIDATION_CHANNEL, CacheInvalidationSync::InvalidationMessage(uid) }, nullptr);
+}
+
+void RouteCache::LogStats()
+{
+	auto stats = _routes.getStats();
+	LOG_INFO << "[RouteCache] lookups=" << _lookups.load(std::memory_order_relaxed)
+		<< " hits=" << stats.hits << " misses=" << stats.misses
+		<< " hit_rate=" << std::fixed << std::setprecision(2) << stats.hit_rate() * 100.0 << "%"
+		<< " redis_lookups=" << _redis_lookups.load(std::memory_order_relaxed)
+		<< " size=" << stats.current_size;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "Singleton.h"
+#include "sharded_cache.h"
+#include "CacheInvalidationSync.h"
+
+// 每个分片缓存的路由条数
+#define ROUTE_CACHE_CAPACITY_PER_SHARD 4096
+// 分片数
+#define ROUTE_CACHE_SHARDS 32
+// 在线路由的兜底过期时间（毫秒）：丢失失效消息时最多使用这么久的旧路由
+#define ROUTE_CACHE_TTL_MS (10 * 60 * 1000)
+// "无路由"（用户不在线）的过期时间（毫秒）
+#define ROUTE_CACHE_NEGATIVE_TTL_MS (30 * 1000)
+// 路由失效广播频道
+#define ROUTE_INVALIDATION_CHANNEL "route:invalidation"
+// 每多少次查询输出一次命中率
+#define ROUTE_CACHE_STATS_INTERVAL 100000
+
+// RouteCache：uid -> 所在 ChatServer 的本地路由缓存
+//
+// 作用：
+//   发消息前不再每条都 GET uip_，稳态下路由查询不访问 Redis
+//
+// 实现逻辑：
+//   1. 基于 minkv::db::ShardedCache<int, std::string>，未命中时读 Redis 回填，
+//      用户不在线（uip_ 不存在）也缓存为空串，短 TTL
+//   2. LoginHandler 写 uip_、会话关闭时向 ROUTE_INVALIDATION_CHANNEL 广播失效，
+//      各服务器通过 CacheInvalidationSync 订阅后删除本地条目
+//   3. 失效纪元：每次失效都递增 _epoch，回填前后纪元不同说明查询期间发生过失效，
+//      此时不回填，避免把刚被失效的旧值重新写回缓存
+class RouteCache : public Singleton<RouteCache>
+{
+	friend class Singleton<RouteCache>;
+public:
+	~RouteCache();
+
+	// 启动失效订阅（服务启动时调用一次）
+	void Start();
+	void Stop();
+
+	// 查询用户所在服务器
+	// 参数：
+	//   - uid: 用户ID
+	//   - server: 输出参数，服务器名（小写）
+	// 返回值：
+	//   用户有路由返回true，不在线返回false
+	bool GetRoute(int uid, std::string& server);
+
+	// 失效本地条目
+	void Invalidate(int uid);
+
+	// 失效本地条目并异步广播给其他服务器（不等待 Redis 回复）
+	void PublishInvalidation(int uid);
+
+	// 缓存统计（命中率等）
+	minkv::db::CacheStats GetStats() const { return _routes.getStats(); }
+	uint64_t RedisLookups() const { return _redis_lookups.load(std::memory_order_relaxed); }
+
+private:
+	RouteCache();
+
+	void LogStats();
+
+	minkv::db::ShardedCache<int, std::string> _routes;
+	std::unique_ptr<CacheInvalidationSync> _sync;
+	std::atomic<bool> _enabled;            // 订阅成功后才使用缓存
+	std::atomic<uint64_t> _epoch;          // 失效纪元
+	std::atomic<uint64_t> _lookups;        // 查询次数
+	std::atomic<uint64_t> _redis_lookups;  // 未命中后访问 Redis 的次数
+};
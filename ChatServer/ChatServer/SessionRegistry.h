@@ -0,0 +1,101 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+// 在线会话表的分片数（必须是 2 的幂）
+#define SESSION_REGISTRY_SHARDS 64
+
+// SessionRegistry：uid -> 会话的分片读写锁表
+//
+// 作用：
+//   每次投递、每次 gRPC 通知、每次断开都要查在线表。单个 mutex 会让所有 IO 线程、逻辑线程、
+//   gRPC 线程在同一把锁上排队
+//
+// 实现逻辑：
+//   1. 按 uid 低位分到 SESSION_REGISTRY_SHARDS 个分片，每个分片独立的 shared_mutex + unordered_map
+//   2. 查询只拿分片的共享锁，不同线程查询同一分片也不互斥；登录 / 下线只锁一个分片
+//   3. 分片按缓存行对齐，相邻分片的锁不会落在同一缓存行上互相干扰
+template<typename Session, std::size_t ShardCount = SESSION_REGISTRY_SHARDS>
+class SessionRegistry
+{
+	static_assert((ShardCount & (ShardCount - 1)) == 0, "ShardCount must be a power of two");
+public:
+	std::shared_ptr<Session> Get(int uid) const
+	{
+		const Shard& shard = ShardFor(uid);
+		std::shared_lock<std::shared_mutex> lock(shard.mtx);
+		auto iter = shard.sessions.find(uid);
+		if (iter == shard.sessions.end()) {
+			return nullptr;
+		}
+		return iter->second;
+	}
+
+	void Set(int uid, std::shared_ptr<Session> session)
+	{
+		Shard& shard = ShardFor(uid);
+		std::unique_lock<std::shared_mutex> lock(shard.mtx);
+		shard.sessions[uid] = std::move(session);
+	}
+
+	void Remove(int uid)
+	{
+		Shard& shard = ShardFor(uid);
+		std::unique_lock<std::shared_mutex> lock(shard.mtx);
+		shard.sessions.erase(uid);
+	}
+
+	// 只有当前映射仍指向 expected 时才删除（用户已在新连接上重新登录时保留新会话）
+	bool RemoveIf(int uid, const Session* expected)
+	{
+		Shard& shard = ShardFor(uid);
+		std::unique_lock<std::shared_mutex> lock(shard.mtx);
+		auto iter = shard.sessions.find(uid);
+		if (iter == shard.sessions.end() || iter->second.get() != expected) {
+			return false;
+		}
+		shard.sessions.erase(iter);
+		return true;
+	}
+
+	// 在线数（逐个分片加锁累加，只用于统计）
+	std::size_t Size() const
+	{
+		std::size_t total = 0;
+		for (const Shard& shard : _shards) {
+			std::shared_lock<std::shared_mutex> lock(shard.mtx);
+			total += shard.sessions.size();
+		}
+		return total;
+	}
+
+	void Clear()
+	{
+		for (Shard& shard : _shards) {
+			std::unique_lock<std::shared_mutex> lock(shard.mtx);
+			shard.sessions.clear();
+		}
+	}
+
+private:
+	struct alignas(64) Shard {
+		mutable std::shared_mutex mtx;
+		std::unordered_map<int, std::shared_ptr<Session>> sessions;
+	};
+
+	Shard& ShardFor(int uid)
+	{
+		return _shards[static_cast<unsigned int>(uid) & (ShardCount - 1)];
+	}
+
+	const Shard& ShardFor(int uid) const
+	{
+		return _shards[static_cast<unsigned int>(uid) & (ShardCount - 1)];
+	}
+
+	std::array<Shard, ShardCount> _shards;
+};
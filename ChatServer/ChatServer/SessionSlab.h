@@ -0,0 +1,100 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// 会话句柄：高 32 位为代数，低 32 位为槽位下标；0 表示无效句柄
+typedef uint64_t SessionHandle;
+
+#define INVALID_SESSION_HANDLE 0
+
+// SessionSlab：按槽位存放会话的表，用句柄 O(1) 插入、查找和删除
+//
+// 作用：
+//   替代 session_id(UUID 字符串) -> session 的 map：不需要生成 UUID、不做字符串哈希和比较，
+//   槽位复用后稳态下插入删除没有堆分配
+//
+// 实现逻辑：
+//   1. 空闲槽位下标放在 _free 栈中，优先复用最近释放的槽位（缓存更热）
+//   2. 每个槽位带一个代数，释放时加一；句柄中的代数与槽位不一致说明是过期句柄
+//      （会话已删除、槽位被新会话复用），Get / Remove 对过期句柄不生效
+//   3. 本身不加锁，由持有者（CServer）保证互斥
+template<typename Session>
+class SessionSlab
+{
+public:
+	SessionSlab() : _size(0) {}
+
+	// 放入会话，返回句柄
+	SessionHandle Insert(std::shared_ptr<Session> session)
+	{
+		uint32_t index;
+		if (!_free.empty()) {
+			index = _free.back();
+			_free.pop_back();
+		}
+		else {
+			index = static_cast<uint32_t>(_slots.size());
+			_slots.emplace_back();
+		}
+		Slot& slot = _slots[index];
+		slot.session = std::move(session);
+		++_size;
+		return MakeHandle(slot.generation, index);
+	}
+
+	std::shared_ptr<Session> Get(SessionHandle handle) const
+	{
+		return Valid(handle) ? _slots[SlotIndex(handle)].session : nullptr;
+	}
+
+	// 删除句柄对应的会话，过期句柄返回nullptr；返回被删除的会话，调用方可以在锁外析构
+	std::shared_ptr<Session> Remove(SessionHandle handle)
+	{
+		if (!Valid(handle)) {
+			return nullptr;
+		}
+		Slot& slot = _slots[SlotIndex(handle)];
+		std::shared_ptr<Session> removed = std::move(slot.session);
+		slot.session.reset();
+		// 代数 0 留给无效句柄，回绕时跳过
+		if (++slot.generation == 0) {
+			slot.generation = 1;
+		}
+		_free.push_back(SlotIndex(handle));
+		--_size;
+		return removed;
+	}
+
+	std::size_t Size() const { return _size; }
+	std::size_t Capacity() const { return _slots.size(); }
+
+	static uint32_t SlotIndex(SessionHandle handle) { return static_cast<uint32_t>(handle); }
+	static uint32_t Generation(SessionHandle handle) { return static_cast<uint32_t>(handle >> 32); }
+
+private:
+	struct Slot {
+		std::shared_ptr<Session> session;
+		uint32_t generation = 1;
+	};
+
+	static SessionHandle MakeHandle(uint32_t generation, uint32_t index)
+	{
+		return (static_cast<SessionHandle>(generation) << 32) | index;
+	}
+
+	bool Valid(SessionHandle handle) const
+	{
+		uint32_t index = SlotIndex(handle);
+		if (handle == INVALID_SESSION_HANDLE || index >= _slots.size()) {
+			return false;
+		}
+		const Slot& slot = _slots[index];
+		return slot.generation == Generation(handle) && slot.session != nullptr;
+	}
+
+	std::vector<Slot> _slots;
+	std::vector<uint32_t> _free;
+	std::size_t _size;
+};
@@ -0,0 +1,135 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// SmallTask 内联存放的最大可调用对象字节数（加上函数表指针并按 16 字节对齐后正好一个缓存行）
+#define SMALL_TASK_INLINE_BYTES 48
+
+// SmallTask：只可移动的 void() 任务对象
+//
+// 作用：
+//   代替 std::function<void()> 作为线程池的任务类型。libstdc++ 的 std::function 只能内联 16 字节，
+//   捕获一个 std::string 加几个 uid 的 lambda 每次投递都要堆分配；SmallTask 内联 48 字节，整个对象 64 字节
+//
+// 实现逻辑：
+//   1. 可调用对象不超过 SMALL_TASK_INLINE_BYTES 且移动不抛异常时直接构造在内部缓冲区，否则放到堆上
+//   2. 用每个类型一份的静态函数表（调用 / 移动 / 析构）做类型擦除，不需要虚函数和 RTTI
+//   3. 只可移动，允许捕获 unique_ptr 等不可拷贝的对象
+class SmallTask
+{
+public:
+	SmallTask() noexcept : _ops(nullptr) {}
+
+	template <typename F, typename Fn = typename std::decay<F>::type,
+		typename = typename std::enable_if<!std::is_same<Fn, SmallTask>::value>::type>
+	SmallTask(F&& f) : _ops(&OpsFor<Fn>::ops)
+	{
+		if constexpr (OpsFor<Fn>::Inline) {
+			new (&_storage) Fn(std::forward<F>(f));
+		}
+		else {
+			new (&_storage) Fn*(new Fn(std::forward<F>(f)));
+		}
+	}
+
+	SmallTask(SmallTask&& other) noexcept : _ops(other._ops)
+	{
+		if (_ops) {
+			_ops->move(&_storage, &other._storage);
+			other._ops = nullptr;
+		}
+	}
+
+	SmallTask& operator=(SmallTask&& other) noexcept
+	{
+		if (this != &other) {
+			Reset();
+			if (other._ops) {
+				_ops = other._ops;
+				_ops->move(&_storage, &other._storage);
+				other._ops = nullptr;
+			}
+		}
+		return *this;
+	}
+
+	SmallTask(const SmallTask&) = delete;
+	SmallTask& operator=(const SmallTask&) = delete;
+
+	~SmallTask() { Reset(); }
+
+	void operator()() { _ops->invoke(&_storage); }
+
+	explicit operator bool() const noexcept { return _ops != nullptr; }
+
+	// 可调用对象是否会内联存放（用于测试）
+	template <typename F>
+	static constexpr bool StoresInline() { return OpsFor<typename std::decay<F>::type>::Inline; }
+
+private:
+	struct Ops {
+		void (*invoke)(void*);
+		void (*move)(void* dst, void* src);
+		void (*destroy)(void*);
+	};
+
+	template <typename Fn>
+	struct OpsFor {
+		static constexpr bool Inline = sizeof(Fn) <= SMALL_TASK_INLINE_BYTES
+			&& alignof(Fn) <= alignof(std::max_align_t)
+			&& std::is_nothrow_move_constructible<Fn>::value;
+
+		static Fn* Get(void* p)
+		{
+			if constexpr (Inline) {
+				return static_cast<Fn*>(p);
+			}
+			else {
+				return *static_cast<Fn**>(p);
+			}
+		}
+
+		static void Invoke(void* p) { (*Get(p))(); }
+
+		static void Move(void* dst, void* src)
+		{
+			if constexpr (Inline) {
+				Fn* from = static_cast<Fn*>(src);
+				new (dst) Fn(std::move(*from));
+				from->~Fn();
+			}
+			else {
+				// 堆上的对象只转移指针
+				new (dst) Fn*(*static_cast<Fn**>(src));
+			}
+		}
+
+		static void Destroy(void* p)
+		{
+			if constexpr (Inline) {
+				static_cast<Fn*>(p)->~Fn();
+			}
+			else {
+				delete *static_cast<Fn**>(p);
+			}
+		}
+
+		static const Ops ops;
+	};
+
+	void Reset() noexcept
+	{
+		if (_ops) {
+			_ops->destroy(&_storage);
+			_ops = nullptr;
+		}
+	}
+
+	typename std::aligned_storage<SMALL_TASK_INLINE_BYTES, alignof(std::max_align_t)>::type _storage;
+	const Ops* _ops;
+};
+
+template <typename Fn>
+const SmallTask::Ops SmallTask::OpsFor<Fn>::ops = { &Invoke, &Move, &Destroy };
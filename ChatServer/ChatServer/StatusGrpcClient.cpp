@@ -11,7 +11,7 @@ GetChatServerRsp StatusGrpcClient::GetChatServer(int uid)
     // 从连接池获取Stub
     auto stub = pool_->getConnection();
     if (!stub) {
-        std::cerr << "StatusGrpcClient::GetChatServer - no stub from pool\n";
+        LOG_ERROR << "StatusGrpcClient::GetChatServer - no stub from pool";
         reply.set_error(ErrorCodes::RPCFailed);
         return reply;
     }
@@ -25,16 +25,16 @@ GetChatServerRsp StatusGrpcClient::GetChatServer(int uid)
     Status status = stub->GetChatServer(&context, request, &reply);
 
     if (!status.ok()) {
-        std::cerr << "GetChatServer RPC failed: " << status.error_message()
-            << " (code " << status.error_code() << ")\n";
+        LOG_ERROR << "GetChatServer RPC failed: " << status.error_message()
+            << " (code " << status.error_code() << ")";
         reply.set_error(ErrorCodes::RPCFailed);
         return reply;
     }
 
     // 输出关键日志，打印 server 返回的 host/port/token
-    std::cout << "StatusGrpcClient::GetChatServer reply: error=" << reply.error()
+    LOG_INFO << "StatusGrpcClient::GetChatServer reply: error=" << reply.error()
         << " host='" << reply.host() << "' port='" << reply.port()
-        << "' token='" << reply.token() << "'\n";
+        << "' token='" << reply.token() << "'";
 
     return reply;
 }
@@ -63,7 +63,7 @@ LoginRsp StatusGrpcClient::Login(int uid, std::string token)
     // 3. 获取连接池中的 stub
     auto stub = pool_->getConnection();
     if (!stub) {
-        std::cerr << "StatusGrpcClient::Login - no stub from pool\n";
+        LOG_ERROR << "StatusGrpcClient::Login - no stub from pool";
         reply.set_error(ErrorCodes::RPCFailed);
         return reply;
     }
@@ -79,15 +79,15 @@ LoginRsp StatusGrpcClient::Login(int uid, std::string token)
 
     // 6. 返回响应
     if (!status.ok()) {
-        std::cerr << "Login RPC failed: " << status.error_message()
-            << " (code " << status.error_code() << ")\n";
+        LOG_ERROR << "Login RPC failed: " << status.error_message()
+            << " (code " << status.error_code() << ")";
         reply.set_error(ErrorCodes::RPCFailed);
         return reply;
     }
 
     // 7. 输出响应
-    std::cout << "StatusGrpcClient::Login reply: error=" << reply.error()
-        << " uid='" << reply.uid() << "' token='" << reply.token() << "'\n";
+    LOG_INFO << "StatusGrpcClient::Login reply: error=" << reply.error()
+        << " uid='" << reply.uid() << "' token='" << reply.token() << "'";
 
     return reply;
 }
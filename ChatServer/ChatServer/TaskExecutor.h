@@ -0,0 +1,559 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Logger.h"
+#include "SmallTask.h"
+
+// 每多少个任务抽样记录一次排队时间（取时钟约 50ns，逐个记录会占到小任务开销的一成以上）
+#define TASK_EXECUTOR_WAIT_SAMPLE 8
+
+// 一次最多窃取的任务数（取对方队列的一半，不超过该值）
+#define TASK_EXECUTOR_STEAL_BATCH 32
+
+// 优先级车道数
+#define TASK_PRIORITY_COUNT 3
+
+// 排队数达到容量的百分之多少时输出告警
+#define TASK_EXECUTOR_ALARM_PERCENT 80
+
+// 任务优先级：高优先级车道有任务时不取低优先级车道
+enum class TaskPriority : uint8_t {
+	High = 0,    // 短小且有人在等结果的任务（ack、拉取离线消息）
+	Normal = 1,  // 默认
+	Low = 2,     // 可以丢弃的后台任务（ShedLow 策略下满载时被丢弃）
+};
+
+// 队列满时的处理策略（只对外部线程投递生效，工作线程投递的后续任务总是接受，避免自己等自己）
+enum class OverflowPolicy : uint8_t {
+	Block,    // 投递方等待，直到有空位或超时（超时后返回 false）
+	Reject,   // 直接返回 false
+	ShedLow,  // Low 任务返回 false；更高优先级的任务挤掉一个排队中最早的 Low 任务，没有可挤的返回 false
+};
+
+// TaskExecutor：工作窃取线程池
+//
+// 作用：
+//   执行互相之间没有顺序要求的后台任务（数据库写入、离线消息拉取、ack 等）。
+//   原 AsyncDBPool 所有生产者和消费者抢同一把锁、同一个条件变量，每次投递还要为 std::function 分配内存
+//
+// 实现逻辑：
+//   1. 每个工作线程一把锁、每个优先级一个环形队列（容量按 2 倍增长，稳态下入队出队不分配内存）。
+//      外部线程投递时按线程本地游标轮流选工作线程，工作线程自己投递的任务放进自己的队列；
+//      不同生产者很少落在同一把锁上
+//   2. 工作线程先取自己的队列（高优先级车道优先），空了再从其他工作线程最高的非空车道一次窃取一半
+//      （不超过 TASK_EXECUTOR_STEAL_BATCH）放进自己的队列。同一车道先进先出；窃取先用 try_lock，
+//      跳过正被占用的队列
+//   3. 全局只有一个原子计数 _pending。工作线程全部取空后才在条件变量上睡眠。
+//      投递方只在 _pending 由 0 变为 1 时唤醒一个线程；被唤醒的线程取到任务后若还有积压，再唤醒下一个，
+//      同一时刻最多一个唤醒在途。繁忙时投递不碰全局锁，也不会每个任务都做一次 futex 唤醒
+//   4. 每个生产者每 TASK_EXECUTOR_WAIT_SAMPLE 个任务抽一个记录入队时间，出队时累计这些任务的
+//      排队时间和最大值，供监控导出
+//   5. capacity > 0 时排队数有上限，超出按 OverflowPolicy 处理。上限是软的：并发投递时最多超出
+//      同时投递的线程数。排队数达到容量的 TASK_EXECUTOR_ALARM_PERCENT% 时告警一次，回落到一半以下后重新计
+//   6. Stop 会把已入队的任务执行完再退出，之后外部线程的 Post 返回 false
+//
+// 注意：
+//   同一个生产者先后投递的任务可能被不同线程并行执行，需要按会话保序的场景使用 LogicWorker。
+//   车道是严格优先级，High 只用于短任务，否则会饿死低优先级车道
+class TaskExecutor
+{
+public:
+	// 监控快照
+	struct Stats {
+		uint64_t submitted = 0;    // 累计投递（接受的）
+		uint64_t executed = 0;     // 累计执行
+		uint64_t stolen = 0;       // 其中被其他线程窃取的
+		uint64_t rejected = 0;     // 队列满被拒绝（含 Block 超时）
+		uint64_t shed = 0;         // ShedLow 丢弃的 Low 任务（含被挤掉的）
+		int64_t pending = 0;       // 当前排队数
+		double avg_wait_us = 0;    // 累计平均排队时间（微秒，抽样）
+		double max_wait_us = 0;    // 上次快照以来的最大排队时间（微秒，抽样）
+		int64_t lane_pending[TASK_PRIORITY_COUNT] = {};      // 按优先级的排队数
+		double lane_avg_wait_us[TASK_PRIORITY_COUNT] = {};   // 按优先级的平均排队时间
+	};
+
+	// 参数：
+	//   threads: 工作线程数（0 按 1 处理）
+	//   name: 日志中的名字
+	//   capacity: 排队数上限，0 为不限
+	//   overflow: 达到上限时的处理策略
+	//   block_timeout_ms: Block 策略最长等待时间，0 为一直等
+	TaskExecutor(std::size_t threads, std::string name, std::size_t capacity = 0,
+		OverflowPolicy overflow = OverflowPolicy::Block, int block_timeout_ms = 0)
+		: _name(std::move(name)), _capacity(static_cast<int64_t>(capacity)), _overflow(overflow),
+		_block_timeout_ms(block_timeout_ms), _pending(0), _sleepers(0), _waking(false), _blocked(0),
+		_rejected(0), _shed(0), _alarmed(false), _stop(false)
+	{
+		threads = std::max<std::size_t>(threads, 1);
+		for (std::size_t i = 0; i < threads; ++i) {
+			_workers.emplace_back(new Worker());
+		}
+		for (std::size_t i = 0; i < threads; ++i) {
+			_workers[i]->thread = std::thread(&TaskExecutor::Run, this, i);
+		}
+	}
+
+	~TaskExecutor() {
+		Stop();
+	}
+
+	TaskExecutor(const TaskExecutor&) = delete;
+	TaskExecutor& operator=(const TaskExecutor&) = delete;
+
+	// 投递任务（线程安全）
+	// 返回值：
+	//   已 Stop、或队列满被拒绝 / 丢弃时返回 false，任务不会执行。
+	//   Stop 排空期间本池任务投递的后续任务仍会执行
+	bool Post(SmallTask task, TaskPriority priority = TaskPriority::Normal) {
+		ThreadSlot& slot = CurrentThread();
+		if (slot.owner != this) {
+			if (_stop.load(std::memory_order_acquire) || !Admit(priority)) {
+				return false;
+			}
+		}
+		Worker& worker = *_workers[PickQueue(slot)];
+		Item item{ std::move(task), std::chrono::steady_clock::time_point(), priority };
+		if (++slot.sample % TASK_EXECUTOR_WAIT_SAMPLE == 0) {
+			item.enqueued = std::chrono::steady_clock::now();
+		}
+		{
+			std::lock_guard<std::mutex> lock(worker.mtx);
+			worker.queues[static_cast<std::size_t>(priority)].push_back(std::move(item));
+			++worker.submitted;
+		}
+		if (_pending.fetch_add(1) <= 0) {
+			WakeOne();
+		}
+		return true;
+	}
+
+	// 停止（幂等）：等已入队的任务全部执行完后回收线程
+	void Stop() {
+		{
+			std::lock_guard<std::mutex> lock(_sleep_mtx);
+			if (_stop.exchange(true)) {
+				return;
+			}
+		}
+		_wake.notify_all();
+		{
+			std::lock_guard<std::mutex> lock(_space_mtx);
+		}
+		_space.notify_all();
+		for (auto& worker : _workers) {
+			if (worker->thread.joinable()) {
+				worker->thread.join();
+			}
+		}
+		// 与 Stop 并发的 Post 可能在线程退出后才入队，在当前线程执行掉
+		Item item;
+		for (std::size_t i = 0; i < _workers.size(); ++i) {
+			while (TryPop(*_workers[i], item)) {
+				_pending.fetch_sub(1);
+				NotifySpace();
+				Execute(*_workers[i], item);
+			}
+		}
+		LOG_INFO << "[" << _name << "] stopped, executed " << Snapshot().executed << " tasks";
+	}
+
+	std::size_t Size() const { return _workers.size(); }
+
+	// 当前排队的任务数
+	int64_t Pending() const { return std::max<int64_t>(_pending.load(std::memory_order_relaxed), 0); }
+
+	// 汇总各工作线程的计数，并清零最大排队时间
+	Stats Snapshot() {
+		Stats stats;
+		uint64_t wait_ns = 0;
+		uint64_t wait_samples = 0;
+		uint64_t max_wait_ns = 0;
+		uint64_t lane_wait_ns[TASK_PRIORITY_COUNT] = {};
+		uint64_t lane_wait_samples[TASK_PRIORITY_COUNT] = {};
+		for (auto& worker : _workers) {
+			{
+				std::lock_guard<std::mutex> lock(worker->mtx);
+				stats.submitted += worker->submitted;
+				for (std::size_t lane = 0; lane < TASK_PRIORITY_COUNT; ++lane) {
+					stats.lane_pending[lane] += static_cast<int64_t>(worker->queues[lane].size());
+				}
+			}
+			stats.executed += worker->executed.load(std::memory_order_relaxed);
+			stats.stolen += worker->stolen.load(std::memory_order_relaxed);
+			for (std::size_t lane = 0; lane < TASK_PRIORITY_COUNT; ++lane) {
+				lane_wait_ns[lane] += worker->wait_ns[lane].load(std::memory_order_relaxed);
+				lane_wait_samples[lane] += worker->wait_samples[lane].load(std::memory_order_relaxed);
+			}
+			max_wait_ns = std::max<uint64_t>(max_wait_ns, worker->max_wait_ns.exchange(0, std::memory_order_relaxed));
+		}
+		for (std::size_t lane = 0; lane < TASK_PRIORITY_COUNT; ++lane) {
+			wait_ns += lane_wait_ns[lane];
+			wait_samples += lane_wait_samples[lane];
+			stats.lane_avg_wait_us[lane] = lane_wait_samples[lane] ? lane_wait_ns[lane] / 1000.0 / lane_wait_samples[lane] : 0;
+		}
+		stats.rejected = _rejected.load(std::memory_order_relaxed);
+		stats.shed = _shed.load(std::memory_order_relaxed);
+		stats.pending = Pending();
+		stats.avg_wait_us = wait_samples ? wait_ns / 1000.0 / wait_samples : 0;
+		stats.max_wait_us = max_wait_ns / 1000.0;
+		// 回落到告警线一半以下，允许下次再告警
+		if (stats.pending < AlarmDepth() / 2) {
+			_alarmed.store(false, std::memory_order_relaxed);
+		}
+		return stats;
+	}
+
+	// 输出一行监控日志（字段名固定，便于日志采集按 key 取值做告警）
+	void LogStats() {
+		Stats stats = Snapshot();
+		LOG_INFO << "[" << _name << "] pending=" << stats.pending << " capacity=" << _capacity
+			<< " pending_high=" << stats.lane_pending[0] << " pending_normal=" << stats.lane_pending[1]
+			<< " pending_low=" << stats.lane_pending[2]
+			<< " submitted=" << stats.submitted << " executed=" << stats.executed << " stolen=" << stats.stolen
+			<< " rejected=" << stats.rejected << " shed=" << stats.shed
+			<< " avg_wait_us=" << stats.avg_wait_us << " max_wait_us=" << stats.max_wait_us
+			<< " wait_high_us=" << stats.lane_avg_wait_us[0] << " wait_normal_us=" << stats.lane_avg_wait_us[1]
+			<< " wait_low_us=" << stats.lane_avg_wait_us[2];
+	}
+
+private:
+	struct Item {
+		SmallTask task;
+		std::chrono::steady_clock::time_point enqueued;
+		TaskPriority priority = TaskPriority::Normal;
+	};
+
+	// 环形队列：std::deque 对 80 字节的元素每 6 个就要分配一个块，这里只在扩容时分配
+	class ItemRing {
+	public:
+		ItemRing() : _items(16), _head(0), _size(0) {}
+
+		bool empty() const { return _size == 0; }
+		std::size_t size() const { return _size; }
+
+		void push_back(Item item) {
+			if (_size == _items.size()) {
+				std::vector<Item> grown(_items.size() * 2);
+				for (std::size_t i = 0; i < _size; ++i) {
+					grown[i] = std::move(_items[(_head + i) & (_items.size() - 1)]);
+				}
+				_items.swap(grown);
+				_head = 0;
+			}
+			_items[(_head + _size) & (_items.size() - 1)] = std::move(item);
+			++_size;
+		}
+
+		Item& front() { return _items[_head]; }
+
+		void pop_front() {
+			_head = (_head + 1) & (_items.size() - 1);
+			--_size;
+		}
+
+	private:
+		std::vector<Item> _items;  // 容量始终是 2 的幂
+		std::size_t _head;
+		std::size_t _size;
+	};
+
+	// 按缓存行对齐，相邻工作线程的锁和计数互不干扰
+	struct alignas(64) Worker {
+		std::mutex mtx;
+		ItemRing queues[TASK_PRIORITY_COUNT];  // 下标为 TaskPriority
+		uint64_t submitted = 0;  // 在 mtx 内更新
+		std::thread thread;
+		std::vector<Item> batch;  // 窃取时的临时缓冲，只有本线程使用
+		// 以下计数只由本线程写（Bump），读取方宽松读取
+		std::atomic<uint64_t> executed{ 0 };
+		std::atomic<uint64_t> stolen{ 0 };
+		std::atomic<uint64_t> wait_ns[TASK_PRIORITY_COUNT] = {};
+		std::atomic<uint64_t> wait_samples[TASK_PRIORITY_COUNT] = {};
+		std::atomic<uint64_t> max_wait_ns{ 0 };
+	};
+
+	// 当前线程所属的执行器和下标（工作线程投递时放回自己的队列）
+	struct ThreadSlot {
+		const TaskExecutor* owner = nullptr;
+		std::size_t index = 0;
+		std::size_t cursor = 0;
+		uint32_t sample = 0;
+	};
+
+	static ThreadSlot& CurrentThread() {
+		static thread_local ThreadSlot slot;
+		return slot;
+	}
+
+	std::size_t PickQueue(ThreadSlot& slot) {
+		if (slot.owner == this) {
+			return slot.index;
+		}
+		// 外部线程：游标从线程 id 的哈希开始，之后每次加一，不同生产者错开且不共享计数
+		if (slot.cursor == 0) {
+			slot.cursor = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+		}
+		return slot.cursor++ % _workers.size();
+	}
+
+	// 单写者计数：普通读改写即可，不需要带 lock 前缀的原子加
+	static void Bump(std::atomic<uint64_t>& counter, uint64_t n) {
+		counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+	}
+
+	int64_t AlarmDepth() const { return _capacity * TASK_EXECUTOR_ALARM_PERCENT / 100; }
+
+	// 外部投递的准入：未满直接接受，满了按策略处理
+	bool Admit(TaskPriority priority) {
+		if (_capacity <= 0) {
+			return true;
+		}
+		int64_t depth = _pending.load(std::memory_order_relaxed);
+		if (depth >= AlarmDepth() && !_alarmed.load(std::memory_order_relaxed) && !_alarmed.exchange(true)) {
+			LOG_WARN << "[" << _name << "] queue depth " << depth << " reached " << TASK_EXECUTOR_ALARM_PERCENT
+				<< "% of capacity " << _capacity;
+		}
+		if (depth < _capacity) {
+			return true;
+		}
+
+		switch (_overflow) {
+		case OverflowPolicy::ShedLow:
+			if (priority == TaskPriority::Low) {
+				_shed.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			if (EvictLow()) {
+				return true;
+			}
+			break;
+		case OverflowPolicy::Block:
+			if (WaitForSpace()) {
+				return true;
+			}
+			break;
+		case OverflowPolicy::Reject:
+			break;
+		}
+		_rejected.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	// 丢掉一个排队最早的 Low 任务给新任务腾位置（在锁外析构）
+	bool EvictLow() {
+		for (auto& worker : _workers) {
+			Item dropped;
+			{
+				std::lock_guard<std::mutex> lock(worker->mtx);
+				ItemRing& low = worker->queues[static_cast<std::size_t>(TaskPriority::Low)];
+				if (low.empty()) {
+					continue;
+				}
+				dropped = std::move(low.front());
+				low.pop_front();
+			}
+			_pending.fetch_sub(1);
+			_shed.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+		return false;
+	}
+
+	// Block 策略：等到排队数低于上限（或 Stop）
+	bool WaitForSpace() {
+		std::unique_lock<std::mutex> lock(_space_mtx);
+		// 与 WakeOne 同样的顺序：先登记再检查，出队方先减 _pending 再看 _blocked
+		_blocked.fetch_add(1);
+		auto has_space = [this] { return _pending.load() < _capacity || _stop.load(); };
+		bool ok = true;
+		if (_block_timeout_ms > 0) {
+			ok = _space.wait_for(lock, std::chrono::milliseconds(_block_timeout_ms), has_space);
+		}
+		else {
+			_space.wait(lock, has_space);
+		}
+		_blocked.fetch_sub(1);
+		return ok && !_stop.load();
+	}
+
+	// 出队后有投递方在等空位时唤醒一个
+	void NotifySpace() {
+		if (_blocked.load() > 0) {
+			{
+				std::lock_guard<std::mutex> lock(_space_mtx);
+			}
+			_space.notify_one();
+		}
+	}
+
+	// 从高到低优先级取队头
+	bool TryPop(Worker& worker, Item& item) {
+		std::lock_guard<std::mutex> lock(worker.mtx);
+		for (ItemRing& queue : worker.queues) {
+			if (!queue.empty()) {
+				item = std::move(queue.front());
+				queue.pop_front();
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// 从 victim 最高的非空车道队头取走一半任务放进 out
+	bool StealHalf(Worker& victim, std::vector<Item>& out, bool try_only) {
+		std::unique_lock<std::mutex> lock(victim.mtx, std::defer_lock);
+		if (try_only) {
+			if (!lock.try_lock()) {
+				return false;
+			}
+		}
+		else {
+			lock.lock();
+		}
+		for (ItemRing& queue : victim.queues) {
+			if (queue.empty()) {
+				continue;
+			}
+			std::size_t n = std::min<std::size_t>((queue.size() + 1) / 2, TASK_EXECUTOR_STEAL_BATCH);
+			for (std::size_t i = 0; i < n; ++i) {
+				out.push_back(std::move(queue.front()));
+				queue.pop_front();
+			}
+			return true;
+		}
+		return false;
+	}
+
+	// 先取自己的队列，再从下一个开始依次窃取（blocking 为 false 时跳过正被占用的队列）。
+	// 窃取到的第一个任务直接返回，其余放进自己的队列
+	bool Take(std::size_t index, Item& item, bool blocking) {
+		Worker& self = *_workers[index];
+		if (TryPop(self, item)) {
+			return true;
+		}
+		for (std::size_t k = 1; k < _workers.size(); ++k) {
+			if (!StealHalf(*_workers[(index + k) % _workers.size()], self.batch, !blocking)) {
+				continue;
+			}
+			item = std::move(self.batch[0]);
+			if (self.batch.size() > 1) {
+				std::lock_guard<std::mutex> lock(self.mtx);
+				for (std::size_t i = 1; i < self.batch.size(); ++i) {
+					self.queues[static_cast<std::size_t>(self.batch[i].priority)].push_back(std::move(self.batch[i]));
+				}
+			}
+			Bump(self.stolen, self.batch.size());
+			self.batch.clear();
+			return true;
+		}
+		return false;
+	}
+
+	// 有线程在睡眠且没有唤醒在途时唤醒一个
+	void WakeOne() {
+		if (_sleepers.load() == 0 || _waking.load() || _waking.exchange(true)) {
+			return;
+		}
+		{
+			std::lock_guard<std::mutex> lock(_sleep_mtx);
+		}
+		_wake.notify_one();
+	}
+
+	void Execute(Worker& self, Item& item) {
+		if (item.enqueued != std::chrono::steady_clock::time_point()) {
+			uint64_t waited = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - item.enqueued).count());
+			std::size_t lane = static_cast<std::size_t>(item.priority);
+			Bump(self.wait_ns[lane], waited);
+			Bump(self.wait_samples[lane], 1);
+			// 快照会并发清零最大值，这里用 CAS
+			uint64_t max_wait = self.max_wait_ns.load(std::memory_order_relaxed);
+			while (waited > max_wait && !self.max_wait_ns.compare_exchange_weak(max_wait, waited, std::memory_order_relaxed)) {
+			}
+		}
+
+		// 捕获异常防止线程退出
+		try {
+			item.task();
+		}
+		catch (const std::exception& e) {
+			LOG_ERROR << "[" << _name << "] task exception: " << e.what();
+		}
+		catch (...) {
+			LOG_ERROR << "[" << _name << "] task unknown exception";
+		}
+		item.task = SmallTask();
+		Bump(self.executed, 1);
+	}
+
+	void Run(std::size_t index) {
+		ThreadSlot& slot = CurrentThread();
+		slot.owner = this;
+		slot.index = index;
+		Worker& self = *_workers[index];
+
+		Item item;
+		for (;;) {
+			// _pending > 0 说明别的队列里还有任务（只是 try_lock 没抢到），第二遍等锁去取
+			if (Take(index, item, false) || (_pending.load() > 0 && Take(index, item, true))) {
+				// 还有积压：叫醒下一个睡眠的线程一起处理
+				if (_pending.fetch_sub(1) > 1) {
+					WakeOne();
+				}
+				NotifySpace();
+				Execute(self, item);
+				continue;
+			}
+			// 任务刚被别的线程取走、计数还没减，让出 CPU 后重试
+			if (_pending.load() > 0) {
+				std::this_thread::yield();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(_sleep_mtx);
+			if (_stop.load() && _pending.load() <= 0) {
+				break;
+			}
+			// 先登记睡眠再检查 _pending：投递方先加 _pending 再看 _sleepers，两边至少有一方能看到对方。
+			// 每次检查前清掉 _waking：在途的唤醒已经送达（或者没有线程可唤醒），允许下一次唤醒
+			_sleepers.fetch_add(1);
+			_wake.wait(lock, [this] {
+				_waking.store(false);
+				return _pending.load() > 0 || _stop.load();
+				});
+			_sleepers.fetch_sub(1);
+		}
+		slot.owner = nullptr;
+	}
+
+	std::string _name;
+	const int64_t _capacity;
+	const OverflowPolicy _overflow;
+	const int _block_timeout_ms;
+	std::vector<std::unique_ptr<Worker>> _workers;
+	// 只有在任务入队之后才加一，出队时减一（可能短暂为负）
+	std::atomic<int64_t> _pending;
+	std::atomic<int> _sleepers;
+	std::atomic<bool> _waking;  // 已发出 notify、被唤醒的线程还没检查条件
+	std::atomic<int> _blocked;  // Block 策略下正在等空位的投递方
+	std::atomic<uint64_t> _rejected;
+	std::atomic<uint64_t> _shed;
+	std::atomic<bool> _alarmed;
+	std::atomic<bool> _stop;
+	std::mutex _sleep_mtx;
+	std::condition_variable _wake;
+	std::mutex _space_mtx;
+	std::condition_variable _space;
+};
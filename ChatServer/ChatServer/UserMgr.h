@@ -1,8 +1,7 @@
 #pragma once
 #include"Singleton.h"
-#include<unordered_map>
 #include<memory>
-#include<mutex>
+#include"SessionRegistry.h"
 
 class CSession;
 
@@ -18,6 +17,7 @@ class CSession;
 //   - 建立和维护用户ID与会话的映射关系
 //   - 提供根据用户ID获取会话的方法
 //   - 支持会话的添加和删除
+//   - 映射表按 uid 分片（SessionRegistry），查询只拿分片共享锁
 class UserMgr : public Singleton<UserMgr>
 {
     friend class Singleton<UserMgr>;  // 允许Singleton访问私有构造函数
@@ -39,19 +39,21 @@ public:
     //   建立用户ID与会话的映射关系
     void SetUserSession(int uid, std::shared_ptr<CSession> session);
 
-    // 移除用户会话
+    // 移除用户会话（仅当映射仍指向 session 时）
     // 参数：
     //   - uid: 用户ID
-    // 作用：
-    //   清除用户ID与会话的映射关系
-    void RmvUserSession(int uid);
+    //   - session: 正在关闭的会话
+    // 返回值：
+    //   删除了映射返回true；用户已在其他连接上重新登录时返回false，保留新会话
+    bool RmvUserSession(int uid, const CSession* session);
+
+    // 在线用户数
+    std::size_t OnlineCount() const;
 
 private:
     UserMgr();
 
-    std::mutex _session_mtx;
-
-    // 用户ID到会话的映射表
-    std::unordered_map<int, std::shared_ptr<CSession>> _uid_to_session;
+    // 用户ID到会话的映射表（分片）
+    SessionRegistry<CSession> _uid_to_session;
 };
 
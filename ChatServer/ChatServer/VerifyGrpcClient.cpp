@@ -69,7 +69,7 @@ std::unique_ptr<VerifyService::Stub> RPConPool::getConnection()
 
     // 如果已停止，返回nullptr
     if (b_stop_) {
-        std::cerr << "[RPConPool] getConnection: pool stopped!" << std::endl;
+        LOG_ERROR << "[RPConPool] getConnection: pool stopped!";
         return nullptr;
     }
 
@@ -77,8 +77,8 @@ std::unique_ptr<VerifyService::Stub> RPConPool::getConnection()
     auto context = std::move(_connections.front());
     _connections.pop();
 
-    std::cout << "[RPConPool] Connection acquired, remaining pool size = "
-        << _connections.size() << std::endl;
+    LOG_DEBUG << "[RPConPool] Connection acquired, remaining pool size = "
+        << _connections.size();
 
     return context;
 }
@@ -88,13 +88,13 @@ void RPConPool::returnConnection(std::unique_ptr<VerifyService::Stub> context)
 {
     std::lock_guard<std::mutex> lock(_mutex);
     if (b_stop_) {
-        std::cerr << "[RPConPool] returnConnection: pool stopped, discard connection" << std::endl;
+        LOG_ERROR << "[RPConPool] returnConnection: pool stopped, discard connection";
         return;
     }
 
     _connections.push(std::move(context));
-    std::cout << "[RPConPool] Connection returned, pool size = "
-        << _connections.size() << std::endl;
+    LOG_DEBUG << "[RPConPool] Connection returned, pool size = "
+        << _connections.size();
 
     _cv.notify_one();
 }
@@ -72,7 +72,7 @@ class VerifyGrpcClient : public Singleton<VerifyGrpcClient>
 public:
     // 获取验证码（当前未使用）
     GetVerifyRsp GetVerifyCode(const std::string& email) {
-        std::cout << "[VerifyGrpcClient] Start GetVerifyCode, email = " << email << std::endl;
+        LOG_INFO << "[VerifyGrpcClient] Start GetVerifyCode, email = " << email;
 
         GetVerifyRsp reply;
         ClientContext context;
@@ -81,13 +81,13 @@ public:
 
         auto stub = pool_->getConnection();
         if (!stub) {
-            std::cerr << "[VerifyGrpcClient] Failed to get stub from pool!" << std::endl;
+            LOG_ERROR << "[VerifyGrpcClient] Failed to get stub from pool!";
             reply.set_error(ErrorCodes::RPCFailed);
             reply.set_email(email);
             return reply;
         }
 
-        std::cout << "[VerifyGrpcClient] Sending gRPC request..." << std::endl;
+        LOG_INFO << "[VerifyGrpcClient] Sending gRPC request...";
 
         Status status = stub->GetVerifyCode(&context, request, &reply);
 
@@ -95,17 +95,16 @@ public:
         pool_->returnConnection(std::move(stub));
 
         if (!status.ok()) {
-            std::cerr << "[VerifyGrpcClient] gRPC调用失败: "
+            LOG_ERROR << "[VerifyGrpcClient] gRPC调用失败: "
                 << status.error_message()
-                << " (code " << status.error_code() << ")" << std::endl;
+                << " (code " << status.error_code() << ")";
             reply.set_error(ErrorCodes::RPCFailed);
             reply.set_email(email);
         }
         else {
-            std::cout << "[VerifyGrpcClient] gRPC调用成功, reply.error = "
+            LOG_INFO << "[VerifyGrpcClient] gRPC调用成功, reply.error = "
                 << reply.error() << " , email = "
-                << reply.email() << " , verifycode = "
-                << std::endl;
+                << reply.email() << " , verifycode = ";
         }
 
         return reply;
@@ -5,12 +5,14 @@
 #include<memory>
 #include<iostream>
 #include"Singleton.h"
+#include"Logger.h"
 #include<functional>
 #include<map>
 #include<unordered_map>
 #include<json/json.h>
 #include<json/value.h>
 #include<json/reader.h>
+#include "JsonUtil.h"
 #include<boost/filesystem.hpp>
 #include<boost/property_tree/ptree.hpp>
 #include<boost/property_tree/ini_parser.hpp>
@@ -38,7 +40,9 @@ enum ErrorCodes {
     RPCGetFailed = 1010,
     UidInvalid = 1011,
     TokenInvalid = 1012,
-    RecipientOffline = 1020       // ��Ϣ���շ�����
+    RecipientOffline = 1020,      // ��Ϣ���շ�����
+    ServerBusy = 1021,            // 服务繁忙（后台队列已满，客户端稍后重试）
+    MsgTooLarge = 1022            // 消息过长（入库后单条放不进一帧离线消息）
 };
 
 enum MSG_IDS {
@@ -57,11 +61,20 @@ enum MSG_IDS {
     ID_NOTIFY_TEXT_CHAT_MSG_REQ = 1019,
     ID_NOTIFY_TEXT_CHAT_MSG_RSP = 1024,
     ID_GET_OFFLINE_MSG_REQ = 1023,
+    ID_CODEC_NEGOTIATE_REQ = 1025,   // 协商消息体编码（请求和响应本身始终是 JSON）
+    ID_CODEC_NEGOTIATE_RSP = 1026,
+    ID_NOTIFY_OFFLINE_MSG_BATCH = 1027,  // 离线消息批量下发（按库内 id 分页）
 
     ID_NOTIFY_ADD_FRIEND_REQ = 1021,
     ID_NOTIFY_FRIEND_REPLY = 1022
 };
 
+// 客户端 TCP 消息体编码：老客户端为 JSON，协商后可切换为 protobuf（消息定义见 message.proto）
+enum class WireCodec : uint8_t {
+    Json = 0,
+    Protobuf = 1
+};
+
 class Defer {
 public:
     // ����һ��lambda����ʽ����ָ��
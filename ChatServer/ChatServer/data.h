@@ -27,4 +27,12 @@ struct ApplyInfo {
     std::string _nick;
     int _sex;
     int _status;
-};
\ No newline at end of file
+};
+
+// 待写入 messages 表的一条聊天消息
+struct ChatMsgRow {
+    int from_uid;
+    int to_uid;
+    std::string payload;
+    long long msg_id = 0;  // 服务端消息 ID（MsgIdGenerator），写入唯一列 messages.msg_id；0 时写 NULL
+};
@@ -194,6 +194,7 @@ static const char* ChatService_method_names[] = {
   "/message.ChatService/SearchFriend",
   "/message.ChatService/GetFriendRequests",
   "/message.ChatService/GetMyFriends",
+  "/message.ChatService/PeerStream",
 };
 
 std::unique_ptr< ChatService::Stub> ChatService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -211,6 +212,7 @@ ChatService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channe
   , rpcmethod_SearchFriend_(ChatService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetFriendRequests_(ChatService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetMyFriends_(ChatService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_PeerStream_(ChatService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
   {}
 
 ::grpc::Status ChatService::Stub::NotifyAddFriend(::grpc::ClientContext* context, const ::message::AddFriendReq& request, ::message::AddFriendRsp* response) {
@@ -397,6 +399,22 @@ void ChatService::Stub::async::GetMyFriends(::grpc::ClientContext* context, cons
   return result;
 }
 
+::grpc::ClientReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* ChatService::Stub::PeerStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::message::PeerFrame, ::message::PeerFrame>::Create(channel_.get(), rpcmethod_PeerStream_, context);
+}
+
+void ChatService::Stub::async::PeerStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::message::PeerFrame,::message::PeerFrame>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::message::PeerFrame,::message::PeerFrame>::Create(stub_->channel_.get(), stub_->rpcmethod_PeerStream_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* ChatService::Stub::AsyncPeerStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::message::PeerFrame, ::message::PeerFrame>::Create(channel_.get(), cq, rpcmethod_PeerStream_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* ChatService::Stub::PrepareAsyncPeerStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::message::PeerFrame, ::message::PeerFrame>::Create(channel_.get(), cq, rpcmethod_PeerStream_, context, false, nullptr);
+}
+
 ChatService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ChatService_method_names[0],
@@ -478,6 +496,16 @@ ChatService::Service::Service() {
              ::message::GetMyFriendsRsp* resp) {
                return service->GetMyFriends(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ChatService_method_names[8],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< ChatService::Service, ::message::PeerFrame, ::message::PeerFrame>(
+          [](ChatService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::message::PeerFrame,
+             ::message::PeerFrame>* stream) {
+               return service->PeerStream(ctx, stream);
+             }, this)));
 }
 
 ChatService::Service::~Service() {
@@ -539,6 +567,12 @@ ChatService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status ChatService::Service::PeerStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace message
 
@@ -662,6 +662,15 @@ class ChatService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::GetMyFriendsRsp>> PrepareAsyncGetMyFriends(::grpc::ClientContext* context, const ::message::GetMyFriendsReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::GetMyFriendsRsp>>(PrepareAsyncGetMyFriendsRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::message::PeerFrame, ::message::PeerFrame>> PeerStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::message::PeerFrame, ::message::PeerFrame>>(PeerStreamRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::message::PeerFrame, ::message::PeerFrame>> AsyncPeerStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::message::PeerFrame, ::message::PeerFrame>>(AsyncPeerStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::message::PeerFrame, ::message::PeerFrame>> PrepareAsyncPeerStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::message::PeerFrame, ::message::PeerFrame>>(PrepareAsyncPeerStreamRaw(context, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -681,6 +690,7 @@ class ChatService final {
       virtual void GetFriendRequests(::grpc::ClientContext* context, const ::message::GetFriendRequestsReq* request, ::message::GetFriendRequestsRsp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetMyFriends(::grpc::ClientContext* context, const ::message::GetMyFriendsReq* request, ::message::GetMyFriendsRsp* response, std::function<void(::grpc::Status)>) = 0;
       virtual void GetMyFriends(::grpc::ClientContext* context, const ::message::GetMyFriendsReq* request, ::message::GetMyFriendsRsp* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void PeerStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::message::PeerFrame,::message::PeerFrame>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -702,6 +712,9 @@ class ChatService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::GetFriendRequestsRsp>* PrepareAsyncGetFriendRequestsRaw(::grpc::ClientContext* context, const ::message::GetFriendRequestsReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::GetMyFriendsRsp>* AsyncGetMyFriendsRaw(::grpc::ClientContext* context, const ::message::GetMyFriendsReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::GetMyFriendsRsp>* PrepareAsyncGetMyFriendsRaw(::grpc::ClientContext* context, const ::message::GetMyFriendsReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::message::PeerFrame, ::message::PeerFrame>* PeerStreamRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::message::PeerFrame, ::message::PeerFrame>* AsyncPeerStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::message::PeerFrame, ::message::PeerFrame>* PrepareAsyncPeerStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -762,6 +775,15 @@ class ChatService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::GetMyFriendsRsp>> PrepareAsyncGetMyFriends(::grpc::ClientContext* context, const ::message::GetMyFriendsReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::GetMyFriendsRsp>>(PrepareAsyncGetMyFriendsRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::message::PeerFrame, ::message::PeerFrame>> PeerStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::message::PeerFrame, ::message::PeerFrame>>(PeerStreamRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::message::PeerFrame, ::message::PeerFrame>> AsyncPeerStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::message::PeerFrame, ::message::PeerFrame>>(AsyncPeerStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::message::PeerFrame, ::message::PeerFrame>> PrepareAsyncPeerStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::message::PeerFrame, ::message::PeerFrame>>(PrepareAsyncPeerStreamRaw(context, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -781,6 +803,7 @@ class ChatService final {
       void GetFriendRequests(::grpc::ClientContext* context, const ::message::GetFriendRequestsReq* request, ::message::GetFriendRequestsRsp* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetMyFriends(::grpc::ClientContext* context, const ::message::GetMyFriendsReq* request, ::message::GetMyFriendsRsp* response, std::function<void(::grpc::Status)>) override;
       void GetMyFriends(::grpc::ClientContext* context, const ::message::GetMyFriendsReq* request, ::message::GetMyFriendsRsp* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void PeerStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::message::PeerFrame,::message::PeerFrame>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -808,6 +831,9 @@ class ChatService final {
     ::grpc::ClientAsyncResponseReader< ::message::GetFriendRequestsRsp>* PrepareAsyncGetFriendRequestsRaw(::grpc::ClientContext* context, const ::message::GetFriendRequestsReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::message::GetMyFriendsRsp>* AsyncGetMyFriendsRaw(::grpc::ClientContext* context, const ::message::GetMyFriendsReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::message::GetMyFriendsRsp>* PrepareAsyncGetMyFriendsRaw(::grpc::ClientContext* context, const ::message::GetMyFriendsReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* PeerStreamRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* AsyncPeerStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* PrepareAsyncPeerStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_NotifyAddFriend_;
     const ::grpc::internal::RpcMethod rpcmethod_ReplyAddFriend_;
     const ::grpc::internal::RpcMethod rpcmethod_SendChatMsg_;
@@ -816,6 +842,7 @@ class ChatService final {
     const ::grpc::internal::RpcMethod rpcmethod_SearchFriend_;
     const ::grpc::internal::RpcMethod rpcmethod_GetFriendRequests_;
     const ::grpc::internal::RpcMethod rpcmethod_GetMyFriends_;
+    const ::grpc::internal::RpcMethod rpcmethod_PeerStream_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -831,6 +858,7 @@ class ChatService final {
     virtual ::grpc::Status SearchFriend(::grpc::ServerContext* context, const ::message::SearchFriendReq* request, ::message::SearchFriendRsp* response);
     virtual ::grpc::Status GetFriendRequests(::grpc::ServerContext* context, const ::message::GetFriendRequestsReq* request, ::message::GetFriendRequestsRsp* response);
     virtual ::grpc::Status GetMyFriends(::grpc::ServerContext* context, const ::message::GetMyFriendsReq* request, ::message::GetMyFriendsRsp* response);
+    virtual ::grpc::Status PeerStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* stream);
   };
   template <class BaseClass>
   class WithAsyncMethod_NotifyAddFriend : public BaseClass {
@@ -992,7 +1020,27 @@ class ChatService final {
       ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_NotifyAddFriend<WithAsyncMethod_ReplyAddFriend<WithAsyncMethod_SendChatMsg<WithAsyncMethod_NotifyAuthFriend<WithAsyncMethod_NotifyTextChatMsg<WithAsyncMethod_SearchFriend<WithAsyncMethod_GetFriendRequests<WithAsyncMethod_GetMyFriends<Service > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_PeerStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_PeerStream() {
+      ::grpc::Service::MarkMethodAsync(8);
+    }
+    ~WithAsyncMethod_PeerStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PeerStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPeerStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(8, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_NotifyAddFriend<WithAsyncMethod_ReplyAddFriend<WithAsyncMethod_SendChatMsg<WithAsyncMethod_NotifyAuthFriend<WithAsyncMethod_NotifyTextChatMsg<WithAsyncMethod_SearchFriend<WithAsyncMethod_GetFriendRequests<WithAsyncMethod_GetMyFriends<WithAsyncMethod_PeerStream<Service > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_NotifyAddFriend : public BaseClass {
    private:
@@ -1209,7 +1257,30 @@ class ChatService final {
     virtual ::grpc::ServerUnaryReactor* GetMyFriends(
       ::grpc::CallbackServerContext* /*context*/, const ::message::GetMyFriendsReq* /*request*/, ::message::GetMyFriendsRsp* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_NotifyAddFriend<WithCallbackMethod_ReplyAddFriend<WithCallbackMethod_SendChatMsg<WithCallbackMethod_NotifyAuthFriend<WithCallbackMethod_NotifyTextChatMsg<WithCallbackMethod_SearchFriend<WithCallbackMethod_GetFriendRequests<WithCallbackMethod_GetMyFriends<Service > > > > > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_PeerStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_PeerStream() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackBidiHandler< ::message::PeerFrame, ::message::PeerFrame>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->PeerStream(context); }));
+    }
+    ~WithCallbackMethod_PeerStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PeerStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::message::PeerFrame, ::message::PeerFrame>* PeerStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  typedef WithCallbackMethod_NotifyAddFriend<WithCallbackMethod_ReplyAddFriend<WithCallbackMethod_SendChatMsg<WithCallbackMethod_NotifyAuthFriend<WithCallbackMethod_NotifyTextChatMsg<WithCallbackMethod_SearchFriend<WithCallbackMethod_GetFriendRequests<WithCallbackMethod_GetMyFriends<WithCallbackMethod_PeerStream<Service > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_NotifyAddFriend : public BaseClass {
@@ -1348,6 +1419,23 @@ class ChatService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_PeerStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_PeerStream() {
+      ::grpc::Service::MarkMethodGeneric(8);
+    }
+    ~WithGenericMethod_PeerStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PeerStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_NotifyAddFriend : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1508,6 +1596,26 @@ class ChatService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_PeerStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_PeerStream() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_PeerStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PeerStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPeerStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(8, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_NotifyAddFriend : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1684,6 +1792,29 @@ class ChatService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_PeerStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_PeerStream() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->PeerStream(context); }));
+    }
+    ~WithRawCallbackMethod_PeerStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PeerStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::message::PeerFrame, ::message::PeerFrame>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* PeerStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_NotifyAddFriend : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
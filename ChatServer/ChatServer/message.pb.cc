@@ -230,8 +230,10 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR TextChatMsgReq::TextChatMsgReq(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.textmsgs_)*/{}
+  , /*decltype(_impl_.batch_)*/{}
   , /*decltype(_impl_.fromuid_)*/0
   , /*decltype(_impl_.touid_)*/0
+  , /*decltype(_impl_.msg_id_)*/int64_t{0}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TextChatMsgReqDefaultTypeInternal {
   PROTOBUF_CONSTEXPR TextChatMsgReqDefaultTypeInternal()
@@ -259,8 +261,10 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR TextChatMsgRsp::TextChatMsgRsp(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.textmsgs_)*/{}
+  , /*decltype(_impl_.batch_)*/{}
   , /*decltype(_impl_.error_)*/0
   , /*decltype(_impl_.fromuid_)*/0
+  , /*decltype(_impl_.msg_id_)*/int64_t{0}
   , /*decltype(_impl_.touid_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TextChatMsgRspDefaultTypeInternal {
@@ -392,8 +396,85 @@ struct GetMyFriendsRspDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetMyFriendsRspDefaultTypeInternal _GetMyFriendsRsp_default_instance_;
+PROTOBUF_CONSTEXPR ChatLoginRsp::ChatLoginRsp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.user_)*/nullptr
+  , /*decltype(_impl_.error_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChatLoginRspDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChatLoginRspDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChatLoginRspDefaultTypeInternal() {}
+  union {
+    ChatLoginRsp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChatLoginRspDefaultTypeInternal _ChatLoginRsp_default_instance_;
+PROTOBUF_CONSTEXPR GetOfflineMsgReq::GetOfflineMsgReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetOfflineMsgReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetOfflineMsgReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetOfflineMsgReqDefaultTypeInternal() {}
+  union {
+    GetOfflineMsgReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetOfflineMsgReqDefaultTypeInternal _GetOfflineMsgReq_default_instance_;
+PROTOBUF_CONSTEXPR OfflineMsgAck::OfflineMsgAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.inbox_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.max_msg_id_)*/int64_t{0}
+  , /*decltype(_impl_.uid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OfflineMsgAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OfflineMsgAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OfflineMsgAckDefaultTypeInternal() {}
+  union {
+    OfflineMsgAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OfflineMsgAckDefaultTypeInternal _OfflineMsgAck_default_instance_;
+PROTOBUF_CONSTEXPR OfflineMsgBatch::OfflineMsgBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msgs_)*/{}
+  , /*decltype(_impl_.inbox_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_)*/0
+  , /*decltype(_impl_.more_)*/false
+  , /*decltype(_impl_.last_id_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OfflineMsgBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OfflineMsgBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OfflineMsgBatchDefaultTypeInternal() {}
+  union {
+    OfflineMsgBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OfflineMsgBatchDefaultTypeInternal _OfflineMsgBatch_default_instance_;
+PROTOBUF_CONSTEXPR PeerFrame::PeerFrame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msgs_)*/{}
+  , /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.from_server_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.epoch_)*/int64_t{0}
+  , /*decltype(_impl_.seq_)*/int64_t{0}
+  , /*decltype(_impl_.ack_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PeerFrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PeerFrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PeerFrameDefaultTypeInternal() {}
+  union {
+    PeerFrame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PeerFrameDefaultTypeInternal _PeerFrame_default_instance_;
 }  // namespace message
-static ::_pb::Metadata file_level_metadata_message_2eproto[25];
+static ::_pb::Metadata file_level_metadata_message_2eproto[30];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_message_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_message_2eproto = nullptr;
 
@@ -529,6 +610,8 @@ const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::message::TextChatMsgReq, _impl_.fromuid_),
   PROTOBUF_FIELD_OFFSET(::message::TextChatMsgReq, _impl_.touid_),
   PROTOBUF_FIELD_OFFSET(::message::TextChatMsgReq, _impl_.textmsgs_),
+  PROTOBUF_FIELD_OFFSET(::message::TextChatMsgReq, _impl_.msg_id_),
+  PROTOBUF_FIELD_OFFSET(::message::TextChatMsgReq, _impl_.batch_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::message::TextChatData, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -547,6 +630,8 @@ const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::message::TextChatMsgRsp, _impl_.fromuid_),
   PROTOBUF_FIELD_OFFSET(::message::TextChatMsgRsp, _impl_.touid_),
   PROTOBUF_FIELD_OFFSET(::message::TextChatMsgRsp, _impl_.textmsgs_),
+  PROTOBUF_FIELD_OFFSET(::message::TextChatMsgRsp, _impl_.msg_id_),
+  PROTOBUF_FIELD_OFFSET(::message::TextChatMsgRsp, _impl_.batch_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::message::SearchFriendReq, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -619,6 +704,53 @@ const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::message::GetMyFriendsRsp, _impl_.error_),
   PROTOBUF_FIELD_OFFSET(::message::GetMyFriendsRsp, _impl_.friends_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::message::ChatLoginRsp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::message::ChatLoginRsp, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::message::ChatLoginRsp, _impl_.user_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::message::GetOfflineMsgReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::message::GetOfflineMsgReq, _impl_.uid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::message::OfflineMsgAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::message::OfflineMsgAck, _impl_.uid_),
+  PROTOBUF_FIELD_OFFSET(::message::OfflineMsgAck, _impl_.max_msg_id_),
+  PROTOBUF_FIELD_OFFSET(::message::OfflineMsgAck, _impl_.inbox_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::message::OfflineMsgBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::message::OfflineMsgBatch, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::message::OfflineMsgBatch, _impl_.msgs_),
+  PROTOBUF_FIELD_OFFSET(::message::OfflineMsgBatch, _impl_.last_id_),
+  PROTOBUF_FIELD_OFFSET(::message::OfflineMsgBatch, _impl_.more_),
+  PROTOBUF_FIELD_OFFSET(::message::OfflineMsgBatch, _impl_.inbox_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::message::PeerFrame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::message::PeerFrame, _impl_.from_server_),
+  PROTOBUF_FIELD_OFFSET(::message::PeerFrame, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::message::PeerFrame, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::message::PeerFrame, _impl_.msgs_),
+  PROTOBUF_FIELD_OFFSET(::message::PeerFrame, _impl_.ack_),
+  PROTOBUF_FIELD_OFFSET(::message::PeerFrame, _impl_.results_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::message::GetVerifyReq)},
@@ -636,16 +768,21 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 105, -1, -1, sizeof(::message::AuthFriendReq)},
   { 113, -1, -1, sizeof(::message::AuthFriendRsp)},
   { 122, -1, -1, sizeof(::message::TextChatMsgReq)},
-  { 131, -1, -1, sizeof(::message::TextChatData)},
-  { 139, -1, -1, sizeof(::message::TextChatMsgRsp)},
-  { 149, -1, -1, sizeof(::message::SearchFriendReq)},
-  { 157, -1, -1, sizeof(::message::SearchFriendRsp)},
-  { 165, -1, -1, sizeof(::message::UserInfo)},
-  { 178, -1, -1, sizeof(::message::GetFriendRequestsReq)},
-  { 185, -1, -1, sizeof(::message::GetFriendRequestsRsp)},
-  { 193, -1, -1, sizeof(::message::ApplyInfo)},
-  { 206, -1, -1, sizeof(::message::GetMyFriendsReq)},
-  { 213, -1, -1, sizeof(::message::GetMyFriendsRsp)},
+  { 133, -1, -1, sizeof(::message::TextChatData)},
+  { 141, -1, -1, sizeof(::message::TextChatMsgRsp)},
+  { 153, -1, -1, sizeof(::message::SearchFriendReq)},
+  { 161, -1, -1, sizeof(::message::SearchFriendRsp)},
+  { 169, -1, -1, sizeof(::message::UserInfo)},
+  { 182, -1, -1, sizeof(::message::GetFriendRequestsReq)},
+  { 189, -1, -1, sizeof(::message::GetFriendRequestsRsp)},
+  { 197, -1, -1, sizeof(::message::ApplyInfo)},
+  { 210, -1, -1, sizeof(::message::GetMyFriendsReq)},
+  { 217, -1, -1, sizeof(::message::GetMyFriendsRsp)},
+  { 225, -1, -1, sizeof(::message::ChatLoginRsp)},
+  { 233, -1, -1, sizeof(::message::GetOfflineMsgReq)},
+  { 240, -1, -1, sizeof(::message::OfflineMsgAck)},
+  { 249, -1, -1, sizeof(::message::OfflineMsgBatch)},
+  { 260, -1, -1, sizeof(::message::PeerFrame)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -674,6 +811,11 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::message::_ApplyInfo_default_instance_._instance,
   &::message::_GetMyFriendsReq_default_instance_._instance,
   &::message::_GetMyFriendsRsp_default_instance_._instance,
+  &::message::_ChatLoginRsp_default_instance_._instance,
+  &::message::_GetOfflineMsgReq_default_instance_._instance,
+  &::message::_OfflineMsgAck_default_instance_._instance,
+  &::message::_OfflineMsgBatch_default_instance_._instance,
+  &::message::_PeerFrame_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_message_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -698,53 +840,68 @@ const char descriptor_table_protodef_message_2eproto[] PROTOBUF_SECTION_VARIABLE
   "\030\003 \001(\005\"/\n\rAuthFriendReq\022\017\n\007fromuid\030\001 \001(\005"
   "\022\r\n\005touid\030\002 \001(\005\">\n\rAuthFriendRsp\022\r\n\005erro"
   "r\030\001 \001(\005\022\017\n\007fromuid\030\002 \001(\005\022\r\n\005touid\030\003 \001(\005\""
-  "Y\n\016TextChatMsgReq\022\017\n\007fromuid\030\001 \001(\005\022\r\n\005to"
-  "uid\030\002 \001(\005\022\'\n\010textmsgs\030\003 \003(\0132\025.message.Te"
-  "xtChatData\"1\n\014TextChatData\022\r\n\005msgid\030\001 \001("
-  "\t\022\022\n\nmsgcontent\030\002 \001(\t\"h\n\016TextChatMsgRsp\022"
-  "\r\n\005error\030\001 \001(\005\022\017\n\007fromuid\030\002 \001(\005\022\r\n\005touid"
-  "\030\003 \001(\005\022\'\n\010textmsgs\030\004 \003(\0132\025.message.TextC"
-  "hatData\"/\n\017SearchFriendReq\022\013\n\003uid\030\001 \001(\005\022"
-  "\017\n\007keyword\030\002 \001(\t\"B\n\017SearchFriendRsp\022\r\n\005e"
-  "rror\030\001 \001(\005\022 \n\005users\030\002 \003(\0132\021.message.User"
-  "Info\"k\n\010UserInfo\022\013\n\003uid\030\001 \001(\005\022\014\n\004name\030\002 "
-  "\001(\t\022\r\n\005email\030\003 \001(\t\022\014\n\004nick\030\004 \001(\t\022\014\n\004icon"
-  "\030\005 \001(\t\022\013\n\003sex\030\006 \001(\005\022\014\n\004desc\030\007 \001(\t\"#\n\024Get"
-  "FriendRequestsReq\022\013\n\003uid\030\001 \001(\005\"K\n\024GetFri"
-  "endRequestsRsp\022\r\n\005error\030\001 \001(\005\022$\n\010request"
-  "s\030\002 \003(\0132\022.message.ApplyInfo\"m\n\tApplyInfo"
-  "\022\013\n\003uid\030\001 \001(\005\022\014\n\004name\030\002 \001(\t\022\014\n\004desc\030\003 \001("
-  "\t\022\014\n\004icon\030\004 \001(\t\022\014\n\004nick\030\005 \001(\t\022\013\n\003sex\030\006 \001"
-  "(\005\022\016\n\006status\030\007 \001(\005\"\036\n\017GetMyFriendsReq\022\013\n"
-  "\003uid\030\001 \001(\005\"D\n\017GetMyFriendsRsp\022\r\n\005error\030\001"
-  " \001(\005\022\"\n\007friends\030\002 \003(\0132\021.message.UserInfo"
-  "2P\n\rVerifyService\022\?\n\rGetVerifyCode\022\025.mes"
-  "sage.GetVerifyReq\032\025.message.GetVerifyRsp"
-  "\"\0002\207\001\n\rStatusService\022G\n\rGetChatServer\022\031."
-  "message.GetChatServerReq\032\031.message.GetCh"
-  "atServerRsp\"\000\022-\n\005Login\022\021.message.LoginRe"
-  "q\032\021.message.LoginRsp2\311\004\n\013ChatService\022A\n\017"
-  "NotifyAddFriend\022\025.message.AddFriendReq\032\025"
-  ".message.AddFriendRsp\"\000\022D\n\016ReplyAddFrien"
-  "d\022\027.message.ReplyFriendReq\032\027.message.Rep"
-  "lyFriendRsp\"\000\022A\n\013SendChatMsg\022\027.message.S"
-  "endChatMsgReq\032\027.message.SendChatMsgRsp\"\000"
-  "\022D\n\020NotifyAuthFriend\022\026.message.AuthFrien"
-  "dReq\032\026.message.AuthFriendRsp\"\000\022G\n\021Notify"
-  "TextChatMsg\022\027.message.TextChatMsgReq\032\027.m"
-  "essage.TextChatMsgRsp\"\000\022D\n\014SearchFriend\022"
-  "\030.message.SearchFriendReq\032\030.message.Sear"
-  "chFriendRsp\"\000\022S\n\021GetFriendRequests\022\035.mes"
-  "sage.GetFriendRequestsReq\032\035.message.GetF"
-  "riendRequestsRsp\"\000\022D\n\014GetMyFriends\022\030.mes"
-  "sage.GetMyFriendsReq\032\030.message.GetMyFrie"
-  "ndsRsp\"\000b\006proto3"
+  "\221\001\n\016TextChatMsgReq\022\017\n\007fromuid\030\001 \001(\005\022\r\n\005t"
+  "ouid\030\002 \001(\005\022\'\n\010textmsgs\030\003 \003(\0132\025.message.T"
+  "extChatData\022\016\n\006msg_id\030\004 \001(\003\022&\n\005batch\030\005 \003"
+  "(\0132\027.message.TextChatMsgReq\"1\n\014TextChatD"
+  "ata\022\r\n\005msgid\030\001 \001(\t\022\022\n\nmsgcontent\030\002 \001(\t\"\240"
+  "\001\n\016TextChatMsgRsp\022\r\n\005error\030\001 \001(\005\022\017\n\007from"
+  "uid\030\002 \001(\005\022\r\n\005touid\030\003 \001(\005\022\'\n\010textmsgs\030\004 \003"
+  "(\0132\025.message.TextChatData\022\016\n\006msg_id\030\005 \001("
+  "\003\022&\n\005batch\030\006 \003(\0132\027.message.TextChatMsgRs"
+  "p\"/\n\017SearchFriendReq\022\013\n\003uid\030\001 \001(\005\022\017\n\007key"
+  "word\030\002 \001(\t\"B\n\017SearchFriendRsp\022\r\n\005error\030\001"
+  " \001(\005\022 \n\005users\030\002 \003(\0132\021.message.UserInfo\"k"
+  "\n\010UserInfo\022\013\n\003uid\030\001 \001(\005\022\014\n\004name\030\002 \001(\t\022\r\n"
+  "\005email\030\003 \001(\t\022\014\n\004nick\030\004 \001(\t\022\014\n\004icon\030\005 \001(\t"
+  "\022\013\n\003sex\030\006 \001(\005\022\014\n\004desc\030\007 \001(\t\"#\n\024GetFriend"
+  "RequestsReq\022\013\n\003uid\030\001 \001(\005\"K\n\024GetFriendReq"
+  "uestsRsp\022\r\n\005error\030\001 \001(\005\022$\n\010requests\030\002 \003("
+  "\0132\022.message.ApplyInfo\"m\n\tApplyInfo\022\013\n\003ui"
+  "d\030\001 \001(\005\022\014\n\004name\030\002 \001(\t\022\014\n\004desc\030\003 \001(\t\022\014\n\004i"
+  "con\030\004 \001(\t\022\014\n\004nick\030\005 \001(\t\022\013\n\003sex\030\006 \001(\005\022\016\n\006"
+  "status\030\007 \001(\005\"\036\n\017GetMyFriendsReq\022\013\n\003uid\030\001"
+  " \001(\005\"D\n\017GetMyFriendsRsp\022\r\n\005error\030\001 \001(\005\022\""
+  "\n\007friends\030\002 \003(\0132\021.message.UserInfo\">\n\014Ch"
+  "atLoginRsp\022\r\n\005error\030\001 \001(\005\022\037\n\004user\030\002 \001(\0132"
+  "\021.message.UserInfo\"\037\n\020GetOfflineMsgReq\022\013"
+  "\n\003uid\030\001 \001(\005\"B\n\rOfflineMsgAck\022\013\n\003uid\030\001 \001("
+  "\005\022\022\n\nmax_msg_id\030\002 \001(\003\022\020\n\010inbox_id\030\003 \001(\t\""
+  "x\n\017OfflineMsgBatch\022\r\n\005error\030\001 \001(\005\022%\n\004msg"
+  "s\030\002 \003(\0132\027.message.TextChatMsgRsp\022\017\n\007last"
+  "_id\030\003 \001(\003\022\014\n\004more\030\004 \001(\010\022\020\n\010inbox_id\030\005 \001("
+  "\t\"\232\001\n\tPeerFrame\022\023\n\013from_server\030\001 \001(\t\022\r\n\005"
+  "epoch\030\002 \001(\003\022\013\n\003seq\030\003 \001(\003\022%\n\004msgs\030\004 \003(\0132\027"
+  ".message.TextChatMsgReq\022\013\n\003ack\030\005 \001(\003\022(\n\007"
+  "results\030\006 \003(\0132\027.message.TextChatMsgRsp2P"
+  "\n\rVerifyService\022\?\n\rGetVerifyCode\022\025.messa"
+  "ge.GetVerifyReq\032\025.message.GetVerifyRsp\"\000"
+  "2\207\001\n\rStatusService\022G\n\rGetChatServer\022\031.me"
+  "ssage.GetChatServerReq\032\031.message.GetChat"
+  "ServerRsp\"\000\022-\n\005Login\022\021.message.LoginReq\032"
+  "\021.message.LoginRsp2\205\005\n\013ChatService\022A\n\017No"
+  "tifyAddFriend\022\025.message.AddFriendReq\032\025.m"
+  "essage.AddFriendRsp\"\000\022D\n\016ReplyAddFriend\022"
+  "\027.message.ReplyFriendReq\032\027.message.Reply"
+  "FriendRsp\"\000\022A\n\013SendChatMsg\022\027.message.Sen"
+  "dChatMsgReq\032\027.message.SendChatMsgRsp\"\000\022D"
+  "\n\020NotifyAuthFriend\022\026.message.AuthFriendR"
+  "eq\032\026.message.AuthFriendRsp\"\000\022G\n\021NotifyTe"
+  "xtChatMsg\022\027.message.TextChatMsgReq\032\027.mes"
+  "sage.TextChatMsgRsp\"\000\022D\n\014SearchFriend\022\030."
+  "message.SearchFriendReq\032\030.message.Search"
+  "FriendRsp\"\000\022S\n\021GetFriendRequests\022\035.messa"
+  "ge.GetFriendRequestsReq\032\035.message.GetFri"
+  "endRequestsRsp\"\000\022D\n\014GetMyFriends\022\030.messa"
+  "ge.GetMyFriendsReq\032\030.message.GetMyFriend"
+  "sRsp\"\000\022:\n\nPeerStream\022\022.message.PeerFrame"
+  "\032\022.message.PeerFrame\"\000(\0010\001b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_message_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_message_2eproto = {
-    false, false, 2456, descriptor_table_protodef_message_2eproto,
+    false, false, 3074, descriptor_table_protodef_message_2eproto,
     "message.proto",
-    &descriptor_table_message_2eproto_once, nullptr, 0, 25,
+    &descriptor_table_message_2eproto_once, nullptr, 0, 30,
     schemas, file_default_instances, TableStruct_message_2eproto::offsets,
     file_level_metadata_message_2eproto, file_level_enum_descriptors_message_2eproto,
     file_level_service_descriptors_message_2eproto,
@@ -4220,14 +4377,16 @@ TextChatMsgReq::TextChatMsgReq(const TextChatMsgReq& from)
   TextChatMsgReq* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.textmsgs_){from._impl_.textmsgs_}
+    , decltype(_impl_.batch_){from._impl_.batch_}
     , decltype(_impl_.fromuid_){}
     , decltype(_impl_.touid_){}
+    , decltype(_impl_.msg_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::memcpy(&_impl_.fromuid_, &from._impl_.fromuid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.touid_) -
-    reinterpret_cast<char*>(&_impl_.fromuid_)) + sizeof(_impl_.touid_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.msg_id_) -
+    reinterpret_cast<char*>(&_impl_.fromuid_)) + sizeof(_impl_.msg_id_));
   // @@protoc_insertion_point(copy_constructor:message.TextChatMsgReq)
 }
 
@@ -4237,8 +4396,10 @@ inline void TextChatMsgReq::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.textmsgs_){arena}
+    , decltype(_impl_.batch_){arena}
     , decltype(_impl_.fromuid_){0}
     , decltype(_impl_.touid_){0}
+    , decltype(_impl_.msg_id_){int64_t{0}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -4255,6 +4416,7 @@ TextChatMsgReq::~TextChatMsgReq() {
 inline void TextChatMsgReq::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.textmsgs_.~RepeatedPtrField();
+  _impl_.batch_.~RepeatedPtrField();
 }
 
 void TextChatMsgReq::SetCachedSize(int size) const {
@@ -4268,9 +4430,10 @@ void TextChatMsgReq::Clear() {
   (void) cached_has_bits;
 
   _impl_.textmsgs_.Clear();
+  _impl_.batch_.Clear();
   ::memset(&_impl_.fromuid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.touid_) -
-      reinterpret_cast<char*>(&_impl_.fromuid_)) + sizeof(_impl_.touid_));
+      reinterpret_cast<char*>(&_impl_.msg_id_) -
+      reinterpret_cast<char*>(&_impl_.fromuid_)) + sizeof(_impl_.msg_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -4309,6 +4472,27 @@ const char* TextChatMsgReq::_InternalParse(const char* ptr, ::_pbi::ParseContext
         } else
           goto handle_unusual;
         continue;
+      // int64 msg_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.msg_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .message.TextChatMsgReq batch = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_batch(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4358,6 +4542,20 @@ uint8_t* TextChatMsgReq::_InternalSerialize(
         InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // int64 msg_id = 4;
+  if (this->_internal_msg_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_msg_id(), target);
+  }
+
+  // repeated .message.TextChatMsgReq batch = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_batch_size()); i < n; i++) {
+    const auto& repfield = this->_internal_batch(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4381,6 +4579,13 @@ size_t TextChatMsgReq::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated .message.TextChatMsgReq batch = 5;
+  total_size += 1UL * this->_internal_batch_size();
+  for (const auto& msg : this->_impl_.batch_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   // int32 fromuid = 1;
   if (this->_internal_fromuid() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_fromuid());
@@ -4391,6 +4596,11 @@ size_t TextChatMsgReq::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_touid());
   }
 
+  // int64 msg_id = 4;
+  if (this->_internal_msg_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_msg_id());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -4410,12 +4620,16 @@ void TextChatMsgReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const :
   (void) cached_has_bits;
 
   _this->_impl_.textmsgs_.MergeFrom(from._impl_.textmsgs_);
+  _this->_impl_.batch_.MergeFrom(from._impl_.batch_);
   if (from._internal_fromuid() != 0) {
     _this->_internal_set_fromuid(from._internal_fromuid());
   }
   if (from._internal_touid() != 0) {
     _this->_internal_set_touid(from._internal_touid());
   }
+  if (from._internal_msg_id() != 0) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -4434,9 +4648,10 @@ void TextChatMsgReq::InternalSwap(TextChatMsgReq* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.textmsgs_.InternalSwap(&other->_impl_.textmsgs_);
+  _impl_.batch_.InternalSwap(&other->_impl_.batch_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.touid_)
-      + sizeof(TextChatMsgReq::_impl_.touid_)
+      PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.msg_id_)
+      + sizeof(TextChatMsgReq::_impl_.msg_id_)
       - PROTOBUF_FIELD_OFFSET(TextChatMsgReq, _impl_.fromuid_)>(
           reinterpret_cast<char*>(&_impl_.fromuid_),
           reinterpret_cast<char*>(&other->_impl_.fromuid_));
@@ -4718,8 +4933,10 @@ TextChatMsgRsp::TextChatMsgRsp(const TextChatMsgRsp& from)
   TextChatMsgRsp* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.textmsgs_){from._impl_.textmsgs_}
+    , decltype(_impl_.batch_){from._impl_.batch_}
     , decltype(_impl_.error_){}
     , decltype(_impl_.fromuid_){}
+    , decltype(_impl_.msg_id_){}
     , decltype(_impl_.touid_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
@@ -4736,8 +4953,10 @@ inline void TextChatMsgRsp::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.textmsgs_){arena}
+    , decltype(_impl_.batch_){arena}
     , decltype(_impl_.error_){0}
     , decltype(_impl_.fromuid_){0}
+    , decltype(_impl_.msg_id_){int64_t{0}}
     , decltype(_impl_.touid_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
@@ -4755,6 +4974,7 @@ TextChatMsgRsp::~TextChatMsgRsp() {
 inline void TextChatMsgRsp::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.textmsgs_.~RepeatedPtrField();
+  _impl_.batch_.~RepeatedPtrField();
 }
 
 void TextChatMsgRsp::SetCachedSize(int size) const {
@@ -4768,6 +4988,7 @@ void TextChatMsgRsp::Clear() {
   (void) cached_has_bits;
 
   _impl_.textmsgs_.Clear();
+  _impl_.batch_.Clear();
   ::memset(&_impl_.error_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&_impl_.touid_) -
       reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.touid_));
@@ -4817,6 +5038,27 @@ const char* TextChatMsgRsp::_InternalParse(const char* ptr, ::_pbi::ParseContext
         } else
           goto handle_unusual;
         continue;
+      // int64 msg_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.msg_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .message.TextChatMsgRsp batch = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_batch(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4872,6 +5114,20 @@ uint8_t* TextChatMsgRsp::_InternalSerialize(
         InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // int64 msg_id = 5;
+  if (this->_internal_msg_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_msg_id(), target);
+  }
+
+  // repeated .message.TextChatMsgRsp batch = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_batch_size()); i < n; i++) {
+    const auto& repfield = this->_internal_batch(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4895,6 +5151,13 @@ size_t TextChatMsgRsp::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated .message.TextChatMsgRsp batch = 6;
+  total_size += 1UL * this->_internal_batch_size();
+  for (const auto& msg : this->_impl_.batch_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   // int32 error = 1;
   if (this->_internal_error() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_error());
@@ -4905,6 +5168,11 @@ size_t TextChatMsgRsp::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_fromuid());
   }
 
+  // int64 msg_id = 5;
+  if (this->_internal_msg_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_msg_id());
+  }
+
   // int32 touid = 3;
   if (this->_internal_touid() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_touid());
@@ -4929,12 +5197,16 @@ void TextChatMsgRsp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const :
   (void) cached_has_bits;
 
   _this->_impl_.textmsgs_.MergeFrom(from._impl_.textmsgs_);
+  _this->_impl_.batch_.MergeFrom(from._impl_.batch_);
   if (from._internal_error() != 0) {
     _this->_internal_set_error(from._internal_error());
   }
   if (from._internal_fromuid() != 0) {
     _this->_internal_set_fromuid(from._internal_fromuid());
   }
+  if (from._internal_msg_id() != 0) {
+    _this->_internal_set_msg_id(from._internal_msg_id());
+  }
   if (from._internal_touid() != 0) {
     _this->_internal_set_touid(from._internal_touid());
   }
@@ -4956,6 +5228,7 @@ void TextChatMsgRsp::InternalSwap(TextChatMsgRsp* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.textmsgs_.InternalSwap(&other->_impl_.textmsgs_);
+  _impl_.batch_.InternalSwap(&other->_impl_.batch_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(TextChatMsgRsp, _impl_.touid_)
       + sizeof(TextChatMsgRsp::_impl_.touid_)
@@ -7092,66 +7365,1407 @@ void GetMyFriendsRsp::InternalSwap(GetMyFriendsRsp* other) {
       file_level_metadata_message_2eproto[24]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace message
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::message::GetVerifyReq*
-Arena::CreateMaybeMessage< ::message::GetVerifyReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::GetVerifyReq >(arena);
-}
-template<> PROTOBUF_NOINLINE ::message::GetVerifyRsp*
-Arena::CreateMaybeMessage< ::message::GetVerifyRsp >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::GetVerifyRsp >(arena);
-}
-template<> PROTOBUF_NOINLINE ::message::GetChatServerReq*
-Arena::CreateMaybeMessage< ::message::GetChatServerReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::GetChatServerReq >(arena);
-}
-template<> PROTOBUF_NOINLINE ::message::GetChatServerRsp*
-Arena::CreateMaybeMessage< ::message::GetChatServerRsp >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::GetChatServerRsp >(arena);
-}
-template<> PROTOBUF_NOINLINE ::message::LoginReq*
-Arena::CreateMaybeMessage< ::message::LoginReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::LoginReq >(arena);
-}
-template<> PROTOBUF_NOINLINE ::message::LoginRsp*
-Arena::CreateMaybeMessage< ::message::LoginRsp >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::LoginRsp >(arena);
+// ===================================================================
+
+class ChatLoginRsp::_Internal {
+ public:
+  static const ::message::UserInfo& user(const ChatLoginRsp* msg);
+};
+
+const ::message::UserInfo&
+ChatLoginRsp::_Internal::user(const ChatLoginRsp* msg) {
+  return *msg->_impl_.user_;
 }
-template<> PROTOBUF_NOINLINE ::message::AddFriendReq*
-Arena::CreateMaybeMessage< ::message::AddFriendReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::AddFriendReq >(arena);
+ChatLoginRsp::ChatLoginRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:message.ChatLoginRsp)
 }
-template<> PROTOBUF_NOINLINE ::message::AddFriendRsp*
-Arena::CreateMaybeMessage< ::message::AddFriendRsp >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::AddFriendRsp >(arena);
+ChatLoginRsp::ChatLoginRsp(const ChatLoginRsp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChatLoginRsp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.error_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_user()) {
+    _this->_impl_.user_ = new ::message::UserInfo(*from._impl_.user_);
+  }
+  _this->_impl_.error_ = from._impl_.error_;
+  // @@protoc_insertion_point(copy_constructor:message.ChatLoginRsp)
 }
-template<> PROTOBUF_NOINLINE ::message::ReplyFriendReq*
-Arena::CreateMaybeMessage< ::message::ReplyFriendReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::ReplyFriendReq >(arena);
+
+inline void ChatLoginRsp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.error_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-template<> PROTOBUF_NOINLINE ::message::ReplyFriendRsp*
-Arena::CreateMaybeMessage< ::message::ReplyFriendRsp >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::ReplyFriendRsp >(arena);
+
+ChatLoginRsp::~ChatLoginRsp() {
+  // @@protoc_insertion_point(destructor:message.ChatLoginRsp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::message::SendChatMsgReq*
-Arena::CreateMaybeMessage< ::message::SendChatMsgReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::SendChatMsgReq >(arena);
+
+inline void ChatLoginRsp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.user_;
 }
-template<> PROTOBUF_NOINLINE ::message::SendChatMsgRsp*
-Arena::CreateMaybeMessage< ::message::SendChatMsgRsp >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::SendChatMsgRsp >(arena);
+
+void ChatLoginRsp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::message::AuthFriendReq*
-Arena::CreateMaybeMessage< ::message::AuthFriendReq >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::AuthFriendReq >(arena);
+
+void ChatLoginRsp::Clear() {
+// @@protoc_insertion_point(message_clear_start:message.ChatLoginRsp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+  _impl_.error_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::message::AuthFriendRsp*
-Arena::CreateMaybeMessage< ::message::AuthFriendRsp >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::message::AuthFriendRsp >(arena);
+
+const char* ChatLoginRsp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 error = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.error_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .message.UserInfo user = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-template<> PROTOBUF_NOINLINE ::message::TextChatMsgReq*
+
+uint8_t* ChatLoginRsp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:message.ChatLoginRsp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 error = 1;
+  if (this->_internal_error() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_error(), target);
+  }
+
+  // .message.UserInfo user = 2;
+  if (this->_internal_has_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::user(this),
+        _Internal::user(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:message.ChatLoginRsp)
+  return target;
+}
+
+size_t ChatLoginRsp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:message.ChatLoginRsp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .message.UserInfo user = 2;
+  if (this->_internal_has_user()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.user_);
+  }
+
+  // int32 error = 1;
+  if (this->_internal_error() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_error());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChatLoginRsp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChatLoginRsp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChatLoginRsp::GetClassData() const { return &_class_data_; }
+
+
+void ChatLoginRsp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChatLoginRsp*>(&to_msg);
+  auto& from = static_cast<const ChatLoginRsp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:message.ChatLoginRsp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_user()) {
+    _this->_internal_mutable_user()->::message::UserInfo::MergeFrom(
+        from._internal_user());
+  }
+  if (from._internal_error() != 0) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChatLoginRsp::CopyFrom(const ChatLoginRsp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:message.ChatLoginRsp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChatLoginRsp::IsInitialized() const {
+  return true;
+}
+
+void ChatLoginRsp::InternalSwap(ChatLoginRsp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ChatLoginRsp, _impl_.error_)
+      + sizeof(ChatLoginRsp::_impl_.error_)
+      - PROTOBUF_FIELD_OFFSET(ChatLoginRsp, _impl_.user_)>(
+          reinterpret_cast<char*>(&_impl_.user_),
+          reinterpret_cast<char*>(&other->_impl_.user_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChatLoginRsp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[25]);
+}
+
+// ===================================================================
+
+class GetOfflineMsgReq::_Internal {
+ public:
+};
+
+GetOfflineMsgReq::GetOfflineMsgReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:message.GetOfflineMsgReq)
+}
+GetOfflineMsgReq::GetOfflineMsgReq(const GetOfflineMsgReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetOfflineMsgReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.uid_ = from._impl_.uid_;
+  // @@protoc_insertion_point(copy_constructor:message.GetOfflineMsgReq)
+}
+
+inline void GetOfflineMsgReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GetOfflineMsgReq::~GetOfflineMsgReq() {
+  // @@protoc_insertion_point(destructor:message.GetOfflineMsgReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetOfflineMsgReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void GetOfflineMsgReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetOfflineMsgReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:message.GetOfflineMsgReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetOfflineMsgReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 uid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.uid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetOfflineMsgReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:message.GetOfflineMsgReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 uid = 1;
+  if (this->_internal_uid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_uid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:message.GetOfflineMsgReq)
+  return target;
+}
+
+size_t GetOfflineMsgReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:message.GetOfflineMsgReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 uid = 1;
+  if (this->_internal_uid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_uid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetOfflineMsgReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetOfflineMsgReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetOfflineMsgReq::GetClassData() const { return &_class_data_; }
+
+
+void GetOfflineMsgReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetOfflineMsgReq*>(&to_msg);
+  auto& from = static_cast<const GetOfflineMsgReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:message.GetOfflineMsgReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_uid() != 0) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetOfflineMsgReq::CopyFrom(const GetOfflineMsgReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:message.GetOfflineMsgReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetOfflineMsgReq::IsInitialized() const {
+  return true;
+}
+
+void GetOfflineMsgReq::InternalSwap(GetOfflineMsgReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.uid_, other->_impl_.uid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetOfflineMsgReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[26]);
+}
+
+// ===================================================================
+
+class OfflineMsgAck::_Internal {
+ public:
+};
+
+OfflineMsgAck::OfflineMsgAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:message.OfflineMsgAck)
+}
+OfflineMsgAck::OfflineMsgAck(const OfflineMsgAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OfflineMsgAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.inbox_id_){}
+    , decltype(_impl_.max_msg_id_){}
+    , decltype(_impl_.uid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.inbox_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.inbox_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_inbox_id().empty()) {
+    _this->_impl_.inbox_id_.Set(from._internal_inbox_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.max_msg_id_, &from._impl_.max_msg_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.uid_) -
+    reinterpret_cast<char*>(&_impl_.max_msg_id_)) + sizeof(_impl_.uid_));
+  // @@protoc_insertion_point(copy_constructor:message.OfflineMsgAck)
+}
+
+inline void OfflineMsgAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.inbox_id_){}
+    , decltype(_impl_.max_msg_id_){int64_t{0}}
+    , decltype(_impl_.uid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.inbox_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.inbox_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+OfflineMsgAck::~OfflineMsgAck() {
+  // @@protoc_insertion_point(destructor:message.OfflineMsgAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OfflineMsgAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.inbox_id_.Destroy();
+}
+
+void OfflineMsgAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OfflineMsgAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:message.OfflineMsgAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.inbox_id_.ClearToEmpty();
+  ::memset(&_impl_.max_msg_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.uid_) -
+      reinterpret_cast<char*>(&_impl_.max_msg_id_)) + sizeof(_impl_.uid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OfflineMsgAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 uid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.uid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 max_msg_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_msg_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string inbox_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_inbox_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "message.OfflineMsgAck.inbox_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OfflineMsgAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:message.OfflineMsgAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 uid = 1;
+  if (this->_internal_uid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_uid(), target);
+  }
+
+  // int64 max_msg_id = 2;
+  if (this->_internal_max_msg_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_max_msg_id(), target);
+  }
+
+  // string inbox_id = 3;
+  if (!this->_internal_inbox_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_inbox_id().data(), static_cast<int>(this->_internal_inbox_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "message.OfflineMsgAck.inbox_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_inbox_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:message.OfflineMsgAck)
+  return target;
+}
+
+size_t OfflineMsgAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:message.OfflineMsgAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string inbox_id = 3;
+  if (!this->_internal_inbox_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_inbox_id());
+  }
+
+  // int64 max_msg_id = 2;
+  if (this->_internal_max_msg_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_max_msg_id());
+  }
+
+  // int32 uid = 1;
+  if (this->_internal_uid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_uid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OfflineMsgAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OfflineMsgAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OfflineMsgAck::GetClassData() const { return &_class_data_; }
+
+
+void OfflineMsgAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OfflineMsgAck*>(&to_msg);
+  auto& from = static_cast<const OfflineMsgAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:message.OfflineMsgAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_inbox_id().empty()) {
+    _this->_internal_set_inbox_id(from._internal_inbox_id());
+  }
+  if (from._internal_max_msg_id() != 0) {
+    _this->_internal_set_max_msg_id(from._internal_max_msg_id());
+  }
+  if (from._internal_uid() != 0) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OfflineMsgAck::CopyFrom(const OfflineMsgAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:message.OfflineMsgAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OfflineMsgAck::IsInitialized() const {
+  return true;
+}
+
+void OfflineMsgAck::InternalSwap(OfflineMsgAck* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.inbox_id_, lhs_arena,
+      &other->_impl_.inbox_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OfflineMsgAck, _impl_.uid_)
+      + sizeof(OfflineMsgAck::_impl_.uid_)
+      - PROTOBUF_FIELD_OFFSET(OfflineMsgAck, _impl_.max_msg_id_)>(
+          reinterpret_cast<char*>(&_impl_.max_msg_id_),
+          reinterpret_cast<char*>(&other->_impl_.max_msg_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OfflineMsgAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[27]);
+}
+
+// ===================================================================
+
+class OfflineMsgBatch::_Internal {
+ public:
+};
+
+OfflineMsgBatch::OfflineMsgBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:message.OfflineMsgBatch)
+}
+OfflineMsgBatch::OfflineMsgBatch(const OfflineMsgBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OfflineMsgBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msgs_){from._impl_.msgs_}
+    , decltype(_impl_.inbox_id_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.more_){}
+    , decltype(_impl_.last_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.inbox_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.inbox_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_inbox_id().empty()) {
+    _this->_impl_.inbox_id_.Set(from._internal_inbox_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.error_, &from._impl_.error_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_id_) -
+    reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.last_id_));
+  // @@protoc_insertion_point(copy_constructor:message.OfflineMsgBatch)
+}
+
+inline void OfflineMsgBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msgs_){arena}
+    , decltype(_impl_.inbox_id_){}
+    , decltype(_impl_.error_){0}
+    , decltype(_impl_.more_){false}
+    , decltype(_impl_.last_id_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.inbox_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.inbox_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+OfflineMsgBatch::~OfflineMsgBatch() {
+  // @@protoc_insertion_point(destructor:message.OfflineMsgBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OfflineMsgBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msgs_.~RepeatedPtrField();
+  _impl_.inbox_id_.Destroy();
+}
+
+void OfflineMsgBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OfflineMsgBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:message.OfflineMsgBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.msgs_.Clear();
+  _impl_.inbox_id_.ClearToEmpty();
+  ::memset(&_impl_.error_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.last_id_) -
+      reinterpret_cast<char*>(&_impl_.error_)) + sizeof(_impl_.last_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OfflineMsgBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 error = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.error_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .message.TextChatMsgRsp msgs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_msgs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 last_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.last_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool more = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.more_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string inbox_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_inbox_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "message.OfflineMsgBatch.inbox_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OfflineMsgBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:message.OfflineMsgBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 error = 1;
+  if (this->_internal_error() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_error(), target);
+  }
+
+  // repeated .message.TextChatMsgRsp msgs = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_msgs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_msgs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int64 last_id = 3;
+  if (this->_internal_last_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_last_id(), target);
+  }
+
+  // bool more = 4;
+  if (this->_internal_more() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_more(), target);
+  }
+
+  // string inbox_id = 5;
+  if (!this->_internal_inbox_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_inbox_id().data(), static_cast<int>(this->_internal_inbox_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "message.OfflineMsgBatch.inbox_id");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_inbox_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:message.OfflineMsgBatch)
+  return target;
+}
+
+size_t OfflineMsgBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:message.OfflineMsgBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .message.TextChatMsgRsp msgs = 2;
+  total_size += 1UL * this->_internal_msgs_size();
+  for (const auto& msg : this->_impl_.msgs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string inbox_id = 5;
+  if (!this->_internal_inbox_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_inbox_id());
+  }
+
+  // int32 error = 1;
+  if (this->_internal_error() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_error());
+  }
+
+  // bool more = 4;
+  if (this->_internal_more() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int64 last_id = 3;
+  if (this->_internal_last_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_last_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OfflineMsgBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OfflineMsgBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OfflineMsgBatch::GetClassData() const { return &_class_data_; }
+
+
+void OfflineMsgBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OfflineMsgBatch*>(&to_msg);
+  auto& from = static_cast<const OfflineMsgBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:message.OfflineMsgBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.msgs_.MergeFrom(from._impl_.msgs_);
+  if (!from._internal_inbox_id().empty()) {
+    _this->_internal_set_inbox_id(from._internal_inbox_id());
+  }
+  if (from._internal_error() != 0) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_more() != 0) {
+    _this->_internal_set_more(from._internal_more());
+  }
+  if (from._internal_last_id() != 0) {
+    _this->_internal_set_last_id(from._internal_last_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OfflineMsgBatch::CopyFrom(const OfflineMsgBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:message.OfflineMsgBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OfflineMsgBatch::IsInitialized() const {
+  return true;
+}
+
+void OfflineMsgBatch::InternalSwap(OfflineMsgBatch* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.msgs_.InternalSwap(&other->_impl_.msgs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.inbox_id_, lhs_arena,
+      &other->_impl_.inbox_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OfflineMsgBatch, _impl_.last_id_)
+      + sizeof(OfflineMsgBatch::_impl_.last_id_)
+      - PROTOBUF_FIELD_OFFSET(OfflineMsgBatch, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OfflineMsgBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[28]);
+}
+
+// ===================================================================
+
+class PeerFrame::_Internal {
+ public:
+};
+
+PeerFrame::PeerFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:message.PeerFrame)
+}
+PeerFrame::PeerFrame(const PeerFrame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PeerFrame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msgs_){from._impl_.msgs_}
+    , decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.from_server_){}
+    , decltype(_impl_.epoch_){}
+    , decltype(_impl_.seq_){}
+    , decltype(_impl_.ack_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.from_server_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.from_server_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_from_server().empty()) {
+    _this->_impl_.from_server_.Set(from._internal_from_server(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.epoch_, &from._impl_.epoch_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ack_) -
+    reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.ack_));
+  // @@protoc_insertion_point(copy_constructor:message.PeerFrame)
+}
+
+inline void PeerFrame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msgs_){arena}
+    , decltype(_impl_.results_){arena}
+    , decltype(_impl_.from_server_){}
+    , decltype(_impl_.epoch_){int64_t{0}}
+    , decltype(_impl_.seq_){int64_t{0}}
+    , decltype(_impl_.ack_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.from_server_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.from_server_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PeerFrame::~PeerFrame() {
+  // @@protoc_insertion_point(destructor:message.PeerFrame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PeerFrame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msgs_.~RepeatedPtrField();
+  _impl_.results_.~RepeatedPtrField();
+  _impl_.from_server_.Destroy();
+}
+
+void PeerFrame::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PeerFrame::Clear() {
+// @@protoc_insertion_point(message_clear_start:message.PeerFrame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.msgs_.Clear();
+  _impl_.results_.Clear();
+  _impl_.from_server_.ClearToEmpty();
+  ::memset(&_impl_.epoch_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ack_) -
+      reinterpret_cast<char*>(&_impl_.epoch_)) + sizeof(_impl_.ack_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PeerFrame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string from_server = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_from_server();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "message.PeerFrame.from_server"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 epoch = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 seq = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .message.TextChatMsgReq msgs = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_msgs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 ack = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .message.TextChatMsgRsp results = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PeerFrame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:message.PeerFrame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string from_server = 1;
+  if (!this->_internal_from_server().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_from_server().data(), static_cast<int>(this->_internal_from_server().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "message.PeerFrame.from_server");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_from_server(), target);
+  }
+
+  // int64 epoch = 2;
+  if (this->_internal_epoch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_epoch(), target);
+  }
+
+  // int64 seq = 3;
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_seq(), target);
+  }
+
+  // repeated .message.TextChatMsgReq msgs = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_msgs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_msgs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int64 ack = 5;
+  if (this->_internal_ack() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_ack(), target);
+  }
+
+  // repeated .message.TextChatMsgRsp results = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:message.PeerFrame)
+  return target;
+}
+
+size_t PeerFrame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:message.PeerFrame)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .message.TextChatMsgReq msgs = 4;
+  total_size += 1UL * this->_internal_msgs_size();
+  for (const auto& msg : this->_impl_.msgs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .message.TextChatMsgRsp results = 6;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string from_server = 1;
+  if (!this->_internal_from_server().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_from_server());
+  }
+
+  // int64 epoch = 2;
+  if (this->_internal_epoch() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_epoch());
+  }
+
+  // int64 seq = 3;
+  if (this->_internal_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_seq());
+  }
+
+  // int64 ack = 5;
+  if (this->_internal_ack() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ack());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PeerFrame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PeerFrame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PeerFrame::GetClassData() const { return &_class_data_; }
+
+
+void PeerFrame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PeerFrame*>(&to_msg);
+  auto& from = static_cast<const PeerFrame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:message.PeerFrame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.msgs_.MergeFrom(from._impl_.msgs_);
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (!from._internal_from_server().empty()) {
+    _this->_internal_set_from_server(from._internal_from_server());
+  }
+  if (from._internal_epoch() != 0) {
+    _this->_internal_set_epoch(from._internal_epoch());
+  }
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
+  }
+  if (from._internal_ack() != 0) {
+    _this->_internal_set_ack(from._internal_ack());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PeerFrame::CopyFrom(const PeerFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:message.PeerFrame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PeerFrame::IsInitialized() const {
+  return true;
+}
+
+void PeerFrame::InternalSwap(PeerFrame* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.msgs_.InternalSwap(&other->_impl_.msgs_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.from_server_, lhs_arena,
+      &other->_impl_.from_server_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PeerFrame, _impl_.ack_)
+      + sizeof(PeerFrame::_impl_.ack_)
+      - PROTOBUF_FIELD_OFFSET(PeerFrame, _impl_.epoch_)>(
+          reinterpret_cast<char*>(&_impl_.epoch_),
+          reinterpret_cast<char*>(&other->_impl_.epoch_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PeerFrame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[29]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace message
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::message::GetVerifyReq*
+Arena::CreateMaybeMessage< ::message::GetVerifyReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::GetVerifyReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::GetVerifyRsp*
+Arena::CreateMaybeMessage< ::message::GetVerifyRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::GetVerifyRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::GetChatServerReq*
+Arena::CreateMaybeMessage< ::message::GetChatServerReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::GetChatServerReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::GetChatServerRsp*
+Arena::CreateMaybeMessage< ::message::GetChatServerRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::GetChatServerRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::LoginReq*
+Arena::CreateMaybeMessage< ::message::LoginReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::LoginReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::LoginRsp*
+Arena::CreateMaybeMessage< ::message::LoginRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::LoginRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::AddFriendReq*
+Arena::CreateMaybeMessage< ::message::AddFriendReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::AddFriendReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::AddFriendRsp*
+Arena::CreateMaybeMessage< ::message::AddFriendRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::AddFriendRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::ReplyFriendReq*
+Arena::CreateMaybeMessage< ::message::ReplyFriendReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::ReplyFriendReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::ReplyFriendRsp*
+Arena::CreateMaybeMessage< ::message::ReplyFriendRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::ReplyFriendRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::SendChatMsgReq*
+Arena::CreateMaybeMessage< ::message::SendChatMsgReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::SendChatMsgReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::SendChatMsgRsp*
+Arena::CreateMaybeMessage< ::message::SendChatMsgRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::SendChatMsgRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::AuthFriendReq*
+Arena::CreateMaybeMessage< ::message::AuthFriendReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::AuthFriendReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::AuthFriendRsp*
+Arena::CreateMaybeMessage< ::message::AuthFriendRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::AuthFriendRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::TextChatMsgReq*
 Arena::CreateMaybeMessage< ::message::TextChatMsgReq >(Arena* arena) {
   return Arena::CreateMessageInternal< ::message::TextChatMsgReq >(arena);
 }
@@ -7195,6 +8809,26 @@ template<> PROTOBUF_NOINLINE ::message::GetMyFriendsRsp*
 Arena::CreateMaybeMessage< ::message::GetMyFriendsRsp >(Arena* arena) {
   return Arena::CreateMessageInternal< ::message::GetMyFriendsRsp >(arena);
 }
+template<> PROTOBUF_NOINLINE ::message::ChatLoginRsp*
+Arena::CreateMaybeMessage< ::message::ChatLoginRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::ChatLoginRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::GetOfflineMsgReq*
+Arena::CreateMaybeMessage< ::message::GetOfflineMsgReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::GetOfflineMsgReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::OfflineMsgAck*
+Arena::CreateMaybeMessage< ::message::OfflineMsgAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::OfflineMsgAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::OfflineMsgBatch*
+Arena::CreateMaybeMessage< ::message::OfflineMsgBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::OfflineMsgBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::message::PeerFrame*
+Arena::CreateMaybeMessage< ::message::PeerFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::message::PeerFrame >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
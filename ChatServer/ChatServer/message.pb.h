@@ -60,6 +60,9 @@ extern AuthFriendReqDefaultTypeInternal _AuthFriendReq_default_instance_;
 class AuthFriendRsp;
 struct AuthFriendRspDefaultTypeInternal;
 extern AuthFriendRspDefaultTypeInternal _AuthFriendRsp_default_instance_;
+class ChatLoginRsp;
+struct ChatLoginRspDefaultTypeInternal;
+extern ChatLoginRspDefaultTypeInternal _ChatLoginRsp_default_instance_;
 class GetChatServerReq;
 struct GetChatServerReqDefaultTypeInternal;
 extern GetChatServerReqDefaultTypeInternal _GetChatServerReq_default_instance_;
@@ -78,6 +81,9 @@ extern GetMyFriendsReqDefaultTypeInternal _GetMyFriendsReq_default_instance_;
 class GetMyFriendsRsp;
 struct GetMyFriendsRspDefaultTypeInternal;
 extern GetMyFriendsRspDefaultTypeInternal _GetMyFriendsRsp_default_instance_;
+class GetOfflineMsgReq;
+struct GetOfflineMsgReqDefaultTypeInternal;
+extern GetOfflineMsgReqDefaultTypeInternal _GetOfflineMsgReq_default_instance_;
 class GetVerifyReq;
 struct GetVerifyReqDefaultTypeInternal;
 extern GetVerifyReqDefaultTypeInternal _GetVerifyReq_default_instance_;
@@ -90,6 +96,15 @@ extern LoginReqDefaultTypeInternal _LoginReq_default_instance_;
 class LoginRsp;
 struct LoginRspDefaultTypeInternal;
 extern LoginRspDefaultTypeInternal _LoginRsp_default_instance_;
+class OfflineMsgAck;
+struct OfflineMsgAckDefaultTypeInternal;
+extern OfflineMsgAckDefaultTypeInternal _OfflineMsgAck_default_instance_;
+class OfflineMsgBatch;
+struct OfflineMsgBatchDefaultTypeInternal;
+extern OfflineMsgBatchDefaultTypeInternal _OfflineMsgBatch_default_instance_;
+class PeerFrame;
+struct PeerFrameDefaultTypeInternal;
+extern PeerFrameDefaultTypeInternal _PeerFrame_default_instance_;
 class ReplyFriendReq;
 struct ReplyFriendReqDefaultTypeInternal;
 extern ReplyFriendReqDefaultTypeInternal _ReplyFriendReq_default_instance_;
@@ -127,16 +142,21 @@ template<> ::message::AddFriendRsp* Arena::CreateMaybeMessage<::message::AddFrie
 template<> ::message::ApplyInfo* Arena::CreateMaybeMessage<::message::ApplyInfo>(Arena*);
 template<> ::message::AuthFriendReq* Arena::CreateMaybeMessage<::message::AuthFriendReq>(Arena*);
 template<> ::message::AuthFriendRsp* Arena::CreateMaybeMessage<::message::AuthFriendRsp>(Arena*);
+template<> ::message::ChatLoginRsp* Arena::CreateMaybeMessage<::message::ChatLoginRsp>(Arena*);
 template<> ::message::GetChatServerReq* Arena::CreateMaybeMessage<::message::GetChatServerReq>(Arena*);
 template<> ::message::GetChatServerRsp* Arena::CreateMaybeMessage<::message::GetChatServerRsp>(Arena*);
 template<> ::message::GetFriendRequestsReq* Arena::CreateMaybeMessage<::message::GetFriendRequestsReq>(Arena*);
 template<> ::message::GetFriendRequestsRsp* Arena::CreateMaybeMessage<::message::GetFriendRequestsRsp>(Arena*);
 template<> ::message::GetMyFriendsReq* Arena::CreateMaybeMessage<::message::GetMyFriendsReq>(Arena*);
 template<> ::message::GetMyFriendsRsp* Arena::CreateMaybeMessage<::message::GetMyFriendsRsp>(Arena*);
+template<> ::message::GetOfflineMsgReq* Arena::CreateMaybeMessage<::message::GetOfflineMsgReq>(Arena*);
 template<> ::message::GetVerifyReq* Arena::CreateMaybeMessage<::message::GetVerifyReq>(Arena*);
 template<> ::message::GetVerifyRsp* Arena::CreateMaybeMessage<::message::GetVerifyRsp>(Arena*);
 template<> ::message::LoginReq* Arena::CreateMaybeMessage<::message::LoginReq>(Arena*);
 template<> ::message::LoginRsp* Arena::CreateMaybeMessage<::message::LoginRsp>(Arena*);
+template<> ::message::OfflineMsgAck* Arena::CreateMaybeMessage<::message::OfflineMsgAck>(Arena*);
+template<> ::message::OfflineMsgBatch* Arena::CreateMaybeMessage<::message::OfflineMsgBatch>(Arena*);
+template<> ::message::PeerFrame* Arena::CreateMaybeMessage<::message::PeerFrame>(Arena*);
 template<> ::message::ReplyFriendReq* Arena::CreateMaybeMessage<::message::ReplyFriendReq>(Arena*);
 template<> ::message::ReplyFriendRsp* Arena::CreateMaybeMessage<::message::ReplyFriendRsp>(Arena*);
 template<> ::message::SearchFriendReq* Arena::CreateMaybeMessage<::message::SearchFriendReq>(Arena*);
@@ -2665,8 +2685,10 @@ class TextChatMsgReq final :
 
   enum : int {
     kTextmsgsFieldNumber = 3,
+    kBatchFieldNumber = 5,
     kFromuidFieldNumber = 1,
     kTouidFieldNumber = 2,
+    kMsgIdFieldNumber = 4,
   };
   // repeated .message.TextChatData textmsgs = 3;
   int textmsgs_size() const;
@@ -2686,6 +2708,24 @@ class TextChatMsgReq final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >&
       textmsgs() const;
 
+  // repeated .message.TextChatMsgReq batch = 5;
+  int batch_size() const;
+  private:
+  int _internal_batch_size() const;
+  public:
+  void clear_batch();
+  ::message::TextChatMsgReq* mutable_batch(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgReq >*
+      mutable_batch();
+  private:
+  const ::message::TextChatMsgReq& _internal_batch(int index) const;
+  ::message::TextChatMsgReq* _internal_add_batch();
+  public:
+  const ::message::TextChatMsgReq& batch(int index) const;
+  ::message::TextChatMsgReq* add_batch();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgReq >&
+      batch() const;
+
   // int32 fromuid = 1;
   void clear_fromuid();
   int32_t fromuid() const;
@@ -2704,6 +2744,15 @@ class TextChatMsgReq final :
   void _internal_set_touid(int32_t value);
   public:
 
+  // int64 msg_id = 4;
+  void clear_msg_id();
+  int64_t msg_id() const;
+  void set_msg_id(int64_t value);
+  private:
+  int64_t _internal_msg_id() const;
+  void _internal_set_msg_id(int64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:message.TextChatMsgReq)
  private:
   class _Internal;
@@ -2713,8 +2762,10 @@ class TextChatMsgReq final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData > textmsgs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgReq > batch_;
     int32_t fromuid_;
     int32_t touid_;
+    int64_t msg_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3013,8 +3064,10 @@ class TextChatMsgRsp final :
 
   enum : int {
     kTextmsgsFieldNumber = 4,
+    kBatchFieldNumber = 6,
     kErrorFieldNumber = 1,
     kFromuidFieldNumber = 2,
+    kMsgIdFieldNumber = 5,
     kTouidFieldNumber = 3,
   };
   // repeated .message.TextChatData textmsgs = 4;
@@ -3035,6 +3088,24 @@ class TextChatMsgRsp final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >&
       textmsgs() const;
 
+  // repeated .message.TextChatMsgRsp batch = 6;
+  int batch_size() const;
+  private:
+  int _internal_batch_size() const;
+  public:
+  void clear_batch();
+  ::message::TextChatMsgRsp* mutable_batch(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >*
+      mutable_batch();
+  private:
+  const ::message::TextChatMsgRsp& _internal_batch(int index) const;
+  ::message::TextChatMsgRsp* _internal_add_batch();
+  public:
+  const ::message::TextChatMsgRsp& batch(int index) const;
+  ::message::TextChatMsgRsp* add_batch();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >&
+      batch() const;
+
   // int32 error = 1;
   void clear_error();
   int32_t error() const;
@@ -3053,6 +3124,15 @@ class TextChatMsgRsp final :
   void _internal_set_fromuid(int32_t value);
   public:
 
+  // int64 msg_id = 5;
+  void clear_msg_id();
+  int64_t msg_id() const;
+  void set_msg_id(int64_t value);
+  private:
+  int64_t _internal_msg_id() const;
+  void _internal_set_msg_id(int64_t value);
+  public:
+
   // int32 touid = 3;
   void clear_touid();
   int32_t touid() const;
@@ -3071,8 +3151,10 @@ class TextChatMsgRsp final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData > textmsgs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp > batch_;
     int32_t error_;
     int32_t fromuid_;
+    int64_t msg_id_;
     int32_t touid_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -4516,197 +4598,1120 @@ class GetMyFriendsRsp final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class ChatLoginRsp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.ChatLoginRsp) */ {
+ public:
+  inline ChatLoginRsp() : ChatLoginRsp(nullptr) {}
+  ~ChatLoginRsp() override;
+  explicit PROTOBUF_CONSTEXPR ChatLoginRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// GetVerifyReq
+  ChatLoginRsp(const ChatLoginRsp& from);
+  ChatLoginRsp(ChatLoginRsp&& from) noexcept
+    : ChatLoginRsp() {
+    *this = ::std::move(from);
+  }
 
-// string email = 1;
-inline void GetVerifyReq::clear_email() {
-  _impl_.email_.ClearToEmpty();
-}
-inline const std::string& GetVerifyReq::email() const {
-  // @@protoc_insertion_point(field_get:message.GetVerifyReq.email)
-  return _internal_email();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetVerifyReq::set_email(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.email_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:message.GetVerifyReq.email)
-}
-inline std::string* GetVerifyReq::mutable_email() {
-  std::string* _s = _internal_mutable_email();
-  // @@protoc_insertion_point(field_mutable:message.GetVerifyReq.email)
-  return _s;
-}
-inline const std::string& GetVerifyReq::_internal_email() const {
-  return _impl_.email_.Get();
-}
-inline void GetVerifyReq::_internal_set_email(const std::string& value) {
-  
-  _impl_.email_.Set(value, GetArenaForAllocation());
-}
-inline std::string* GetVerifyReq::_internal_mutable_email() {
-  
-  return _impl_.email_.Mutable(GetArenaForAllocation());
-}
-inline std::string* GetVerifyReq::release_email() {
-  // @@protoc_insertion_point(field_release:message.GetVerifyReq.email)
-  return _impl_.email_.Release();
-}
-inline void GetVerifyReq::set_allocated_email(std::string* email) {
-  if (email != nullptr) {
-    
-  } else {
-    
+  inline ChatLoginRsp& operator=(const ChatLoginRsp& from) {
+    CopyFrom(from);
+    return *this;
   }
-  _impl_.email_.SetAllocated(email, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.email_.IsDefault()) {
-    _impl_.email_.Set("", GetArenaForAllocation());
+  inline ChatLoginRsp& operator=(ChatLoginRsp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:message.GetVerifyReq.email)
-}
 
-// -------------------------------------------------------------------
-
-// GetVerifyRsp
-
-// int32 error = 1;
-inline void GetVerifyRsp::clear_error() {
-  _impl_.error_ = 0;
-}
-inline int32_t GetVerifyRsp::_internal_error() const {
-  return _impl_.error_;
-}
-inline int32_t GetVerifyRsp::error() const {
-  // @@protoc_insertion_point(field_get:message.GetVerifyRsp.error)
-  return _internal_error();
-}
-inline void GetVerifyRsp::_internal_set_error(int32_t value) {
-  
-  _impl_.error_ = value;
-}
-inline void GetVerifyRsp::set_error(int32_t value) {
-  _internal_set_error(value);
-  // @@protoc_insertion_point(field_set:message.GetVerifyRsp.error)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChatLoginRsp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChatLoginRsp* internal_default_instance() {
+    return reinterpret_cast<const ChatLoginRsp*>(
+               &_ChatLoginRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
 
-// string email = 2;
-inline void GetVerifyRsp::clear_email() {
-  _impl_.email_.ClearToEmpty();
-}
-inline const std::string& GetVerifyRsp::email() const {
-  // @@protoc_insertion_point(field_get:message.GetVerifyRsp.email)
-  return _internal_email();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetVerifyRsp::set_email(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.email_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:message.GetVerifyRsp.email)
-}
-inline std::string* GetVerifyRsp::mutable_email() {
-  std::string* _s = _internal_mutable_email();
-  // @@protoc_insertion_point(field_mutable:message.GetVerifyRsp.email)
-  return _s;
-}
-inline const std::string& GetVerifyRsp::_internal_email() const {
-  return _impl_.email_.Get();
-}
-inline void GetVerifyRsp::_internal_set_email(const std::string& value) {
-  
-  _impl_.email_.Set(value, GetArenaForAllocation());
-}
-inline std::string* GetVerifyRsp::_internal_mutable_email() {
-  
-  return _impl_.email_.Mutable(GetArenaForAllocation());
-}
-inline std::string* GetVerifyRsp::release_email() {
-  // @@protoc_insertion_point(field_release:message.GetVerifyRsp.email)
-  return _impl_.email_.Release();
-}
-inline void GetVerifyRsp::set_allocated_email(std::string* email) {
-  if (email != nullptr) {
-    
-  } else {
-    
+  friend void swap(ChatLoginRsp& a, ChatLoginRsp& b) {
+    a.Swap(&b);
   }
-  _impl_.email_.SetAllocated(email, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.email_.IsDefault()) {
-    _impl_.email_.Set("", GetArenaForAllocation());
+  inline void Swap(ChatLoginRsp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChatLoginRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:message.GetVerifyRsp.email)
-}
 
-// string code = 3;
-inline void GetVerifyRsp::clear_code() {
-  _impl_.code_.ClearToEmpty();
-}
-inline const std::string& GetVerifyRsp::code() const {
-  // @@protoc_insertion_point(field_get:message.GetVerifyRsp.code)
-  return _internal_code();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetVerifyRsp::set_code(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:message.GetVerifyRsp.code)
-}
-inline std::string* GetVerifyRsp::mutable_code() {
-  std::string* _s = _internal_mutable_code();
-  // @@protoc_insertion_point(field_mutable:message.GetVerifyRsp.code)
-  return _s;
-}
-inline const std::string& GetVerifyRsp::_internal_code() const {
-  return _impl_.code_.Get();
-}
-inline void GetVerifyRsp::_internal_set_code(const std::string& value) {
-  
-  _impl_.code_.Set(value, GetArenaForAllocation());
-}
-inline std::string* GetVerifyRsp::_internal_mutable_code() {
-  
-  return _impl_.code_.Mutable(GetArenaForAllocation());
-}
-inline std::string* GetVerifyRsp::release_code() {
-  // @@protoc_insertion_point(field_release:message.GetVerifyRsp.code)
-  return _impl_.code_.Release();
-}
-inline void GetVerifyRsp::set_allocated_code(std::string* code) {
-  if (code != nullptr) {
-    
-  } else {
-    
+  // implements Message ----------------------------------------------
+
+  ChatLoginRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChatLoginRsp>(arena);
   }
-  _impl_.code_.SetAllocated(code, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.code_.IsDefault()) {
-    _impl_.code_.Set("", GetArenaForAllocation());
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChatLoginRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChatLoginRsp& from) {
+    ChatLoginRsp::MergeImpl(*this, from);
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:message.GetVerifyRsp.code)
-}
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// -------------------------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// GetChatServerReq
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChatLoginRsp* other);
 
-// int32 uid = 1;
-inline void GetChatServerReq::clear_uid() {
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.ChatLoginRsp";
+  }
+  protected:
+  explicit ChatLoginRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUserFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // .message.UserInfo user = 2;
+  bool has_user() const;
+  private:
+  bool _internal_has_user() const;
+  public:
+  void clear_user();
+  const ::message::UserInfo& user() const;
+  PROTOBUF_NODISCARD ::message::UserInfo* release_user();
+  ::message::UserInfo* mutable_user();
+  void set_allocated_user(::message::UserInfo* user);
+  private:
+  const ::message::UserInfo& _internal_user() const;
+  ::message::UserInfo* _internal_mutable_user();
+  public:
+  void unsafe_arena_set_allocated_user(
+      ::message::UserInfo* user);
+  ::message::UserInfo* unsafe_arena_release_user();
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.ChatLoginRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::message::UserInfo* user_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetOfflineMsgReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.GetOfflineMsgReq) */ {
+ public:
+  inline GetOfflineMsgReq() : GetOfflineMsgReq(nullptr) {}
+  ~GetOfflineMsgReq() override;
+  explicit PROTOBUF_CONSTEXPR GetOfflineMsgReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetOfflineMsgReq(const GetOfflineMsgReq& from);
+  GetOfflineMsgReq(GetOfflineMsgReq&& from) noexcept
+    : GetOfflineMsgReq() {
+    *this = ::std::move(from);
+  }
+
+  inline GetOfflineMsgReq& operator=(const GetOfflineMsgReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetOfflineMsgReq& operator=(GetOfflineMsgReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetOfflineMsgReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetOfflineMsgReq* internal_default_instance() {
+    return reinterpret_cast<const GetOfflineMsgReq*>(
+               &_GetOfflineMsgReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(GetOfflineMsgReq& a, GetOfflineMsgReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetOfflineMsgReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetOfflineMsgReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetOfflineMsgReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetOfflineMsgReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetOfflineMsgReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetOfflineMsgReq& from) {
+    GetOfflineMsgReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetOfflineMsgReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.GetOfflineMsgReq";
+  }
+  protected:
+  explicit GetOfflineMsgReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUidFieldNumber = 1,
+  };
+  // int32 uid = 1;
+  void clear_uid();
+  int32_t uid() const;
+  void set_uid(int32_t value);
+  private:
+  int32_t _internal_uid() const;
+  void _internal_set_uid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.GetOfflineMsgReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t uid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OfflineMsgAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.OfflineMsgAck) */ {
+ public:
+  inline OfflineMsgAck() : OfflineMsgAck(nullptr) {}
+  ~OfflineMsgAck() override;
+  explicit PROTOBUF_CONSTEXPR OfflineMsgAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OfflineMsgAck(const OfflineMsgAck& from);
+  OfflineMsgAck(OfflineMsgAck&& from) noexcept
+    : OfflineMsgAck() {
+    *this = ::std::move(from);
+  }
+
+  inline OfflineMsgAck& operator=(const OfflineMsgAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OfflineMsgAck& operator=(OfflineMsgAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OfflineMsgAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OfflineMsgAck* internal_default_instance() {
+    return reinterpret_cast<const OfflineMsgAck*>(
+               &_OfflineMsgAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(OfflineMsgAck& a, OfflineMsgAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OfflineMsgAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OfflineMsgAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OfflineMsgAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OfflineMsgAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OfflineMsgAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OfflineMsgAck& from) {
+    OfflineMsgAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OfflineMsgAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.OfflineMsgAck";
+  }
+  protected:
+  explicit OfflineMsgAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInboxIdFieldNumber = 3,
+    kMaxMsgIdFieldNumber = 2,
+    kUidFieldNumber = 1,
+  };
+  // string inbox_id = 3;
+  void clear_inbox_id();
+  const std::string& inbox_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_inbox_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_inbox_id();
+  PROTOBUF_NODISCARD std::string* release_inbox_id();
+  void set_allocated_inbox_id(std::string* inbox_id);
+  private:
+  const std::string& _internal_inbox_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_inbox_id(const std::string& value);
+  std::string* _internal_mutable_inbox_id();
+  public:
+
+  // int64 max_msg_id = 2;
+  void clear_max_msg_id();
+  int64_t max_msg_id() const;
+  void set_max_msg_id(int64_t value);
+  private:
+  int64_t _internal_max_msg_id() const;
+  void _internal_set_max_msg_id(int64_t value);
+  public:
+
+  // int32 uid = 1;
+  void clear_uid();
+  int32_t uid() const;
+  void set_uid(int32_t value);
+  private:
+  int32_t _internal_uid() const;
+  void _internal_set_uid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.OfflineMsgAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr inbox_id_;
+    int64_t max_msg_id_;
+    int32_t uid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OfflineMsgBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.OfflineMsgBatch) */ {
+ public:
+  inline OfflineMsgBatch() : OfflineMsgBatch(nullptr) {}
+  ~OfflineMsgBatch() override;
+  explicit PROTOBUF_CONSTEXPR OfflineMsgBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OfflineMsgBatch(const OfflineMsgBatch& from);
+  OfflineMsgBatch(OfflineMsgBatch&& from) noexcept
+    : OfflineMsgBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline OfflineMsgBatch& operator=(const OfflineMsgBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OfflineMsgBatch& operator=(OfflineMsgBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OfflineMsgBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OfflineMsgBatch* internal_default_instance() {
+    return reinterpret_cast<const OfflineMsgBatch*>(
+               &_OfflineMsgBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(OfflineMsgBatch& a, OfflineMsgBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OfflineMsgBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OfflineMsgBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OfflineMsgBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OfflineMsgBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OfflineMsgBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OfflineMsgBatch& from) {
+    OfflineMsgBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OfflineMsgBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.OfflineMsgBatch";
+  }
+  protected:
+  explicit OfflineMsgBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgsFieldNumber = 2,
+    kInboxIdFieldNumber = 5,
+    kErrorFieldNumber = 1,
+    kMoreFieldNumber = 4,
+    kLastIdFieldNumber = 3,
+  };
+  // repeated .message.TextChatMsgRsp msgs = 2;
+  int msgs_size() const;
+  private:
+  int _internal_msgs_size() const;
+  public:
+  void clear_msgs();
+  ::message::TextChatMsgRsp* mutable_msgs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >*
+      mutable_msgs();
+  private:
+  const ::message::TextChatMsgRsp& _internal_msgs(int index) const;
+  ::message::TextChatMsgRsp* _internal_add_msgs();
+  public:
+  const ::message::TextChatMsgRsp& msgs(int index) const;
+  ::message::TextChatMsgRsp* add_msgs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >&
+      msgs() const;
+
+  // string inbox_id = 5;
+  void clear_inbox_id();
+  const std::string& inbox_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_inbox_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_inbox_id();
+  PROTOBUF_NODISCARD std::string* release_inbox_id();
+  void set_allocated_inbox_id(std::string* inbox_id);
+  private:
+  const std::string& _internal_inbox_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_inbox_id(const std::string& value);
+  std::string* _internal_mutable_inbox_id();
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // bool more = 4;
+  void clear_more();
+  bool more() const;
+  void set_more(bool value);
+  private:
+  bool _internal_more() const;
+  void _internal_set_more(bool value);
+  public:
+
+  // int64 last_id = 3;
+  void clear_last_id();
+  int64_t last_id() const;
+  void set_last_id(int64_t value);
+  private:
+  int64_t _internal_last_id() const;
+  void _internal_set_last_id(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.OfflineMsgBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp > msgs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr inbox_id_;
+    int32_t error_;
+    bool more_;
+    int64_t last_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PeerFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.PeerFrame) */ {
+ public:
+  inline PeerFrame() : PeerFrame(nullptr) {}
+  ~PeerFrame() override;
+  explicit PROTOBUF_CONSTEXPR PeerFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PeerFrame(const PeerFrame& from);
+  PeerFrame(PeerFrame&& from) noexcept
+    : PeerFrame() {
+    *this = ::std::move(from);
+  }
+
+  inline PeerFrame& operator=(const PeerFrame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PeerFrame& operator=(PeerFrame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PeerFrame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PeerFrame* internal_default_instance() {
+    return reinterpret_cast<const PeerFrame*>(
+               &_PeerFrame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(PeerFrame& a, PeerFrame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PeerFrame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PeerFrame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PeerFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PeerFrame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PeerFrame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PeerFrame& from) {
+    PeerFrame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PeerFrame* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.PeerFrame";
+  }
+  protected:
+  explicit PeerFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgsFieldNumber = 4,
+    kResultsFieldNumber = 6,
+    kFromServerFieldNumber = 1,
+    kEpochFieldNumber = 2,
+    kSeqFieldNumber = 3,
+    kAckFieldNumber = 5,
+  };
+  // repeated .message.TextChatMsgReq msgs = 4;
+  int msgs_size() const;
+  private:
+  int _internal_msgs_size() const;
+  public:
+  void clear_msgs();
+  ::message::TextChatMsgReq* mutable_msgs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgReq >*
+      mutable_msgs();
+  private:
+  const ::message::TextChatMsgReq& _internal_msgs(int index) const;
+  ::message::TextChatMsgReq* _internal_add_msgs();
+  public:
+  const ::message::TextChatMsgReq& msgs(int index) const;
+  ::message::TextChatMsgReq* add_msgs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgReq >&
+      msgs() const;
+
+  // repeated .message.TextChatMsgRsp results = 6;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::message::TextChatMsgRsp* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >*
+      mutable_results();
+  private:
+  const ::message::TextChatMsgRsp& _internal_results(int index) const;
+  ::message::TextChatMsgRsp* _internal_add_results();
+  public:
+  const ::message::TextChatMsgRsp& results(int index) const;
+  ::message::TextChatMsgRsp* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >&
+      results() const;
+
+  // string from_server = 1;
+  void clear_from_server();
+  const std::string& from_server() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_from_server(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_from_server();
+  PROTOBUF_NODISCARD std::string* release_from_server();
+  void set_allocated_from_server(std::string* from_server);
+  private:
+  const std::string& _internal_from_server() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_from_server(const std::string& value);
+  std::string* _internal_mutable_from_server();
+  public:
+
+  // int64 epoch = 2;
+  void clear_epoch();
+  int64_t epoch() const;
+  void set_epoch(int64_t value);
+  private:
+  int64_t _internal_epoch() const;
+  void _internal_set_epoch(int64_t value);
+  public:
+
+  // int64 seq = 3;
+  void clear_seq();
+  int64_t seq() const;
+  void set_seq(int64_t value);
+  private:
+  int64_t _internal_seq() const;
+  void _internal_set_seq(int64_t value);
+  public:
+
+  // int64 ack = 5;
+  void clear_ack();
+  int64_t ack() const;
+  void set_ack(int64_t value);
+  private:
+  int64_t _internal_ack() const;
+  void _internal_set_ack(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.PeerFrame)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgReq > msgs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp > results_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr from_server_;
+    int64_t epoch_;
+    int64_t seq_;
+    int64_t ack_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// GetVerifyReq
+
+// string email = 1;
+inline void GetVerifyReq::clear_email() {
+  _impl_.email_.ClearToEmpty();
+}
+inline const std::string& GetVerifyReq::email() const {
+  // @@protoc_insertion_point(field_get:message.GetVerifyReq.email)
+  return _internal_email();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetVerifyReq::set_email(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.email_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.GetVerifyReq.email)
+}
+inline std::string* GetVerifyReq::mutable_email() {
+  std::string* _s = _internal_mutable_email();
+  // @@protoc_insertion_point(field_mutable:message.GetVerifyReq.email)
+  return _s;
+}
+inline const std::string& GetVerifyReq::_internal_email() const {
+  return _impl_.email_.Get();
+}
+inline void GetVerifyReq::_internal_set_email(const std::string& value) {
+  
+  _impl_.email_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetVerifyReq::_internal_mutable_email() {
+  
+  return _impl_.email_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetVerifyReq::release_email() {
+  // @@protoc_insertion_point(field_release:message.GetVerifyReq.email)
+  return _impl_.email_.Release();
+}
+inline void GetVerifyReq::set_allocated_email(std::string* email) {
+  if (email != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.email_.SetAllocated(email, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.email_.IsDefault()) {
+    _impl_.email_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.GetVerifyReq.email)
+}
+
+// -------------------------------------------------------------------
+
+// GetVerifyRsp
+
+// int32 error = 1;
+inline void GetVerifyRsp::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t GetVerifyRsp::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t GetVerifyRsp::error() const {
+  // @@protoc_insertion_point(field_get:message.GetVerifyRsp.error)
+  return _internal_error();
+}
+inline void GetVerifyRsp::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void GetVerifyRsp::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.GetVerifyRsp.error)
+}
+
+// string email = 2;
+inline void GetVerifyRsp::clear_email() {
+  _impl_.email_.ClearToEmpty();
+}
+inline const std::string& GetVerifyRsp::email() const {
+  // @@protoc_insertion_point(field_get:message.GetVerifyRsp.email)
+  return _internal_email();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetVerifyRsp::set_email(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.email_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.GetVerifyRsp.email)
+}
+inline std::string* GetVerifyRsp::mutable_email() {
+  std::string* _s = _internal_mutable_email();
+  // @@protoc_insertion_point(field_mutable:message.GetVerifyRsp.email)
+  return _s;
+}
+inline const std::string& GetVerifyRsp::_internal_email() const {
+  return _impl_.email_.Get();
+}
+inline void GetVerifyRsp::_internal_set_email(const std::string& value) {
+  
+  _impl_.email_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetVerifyRsp::_internal_mutable_email() {
+  
+  return _impl_.email_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetVerifyRsp::release_email() {
+  // @@protoc_insertion_point(field_release:message.GetVerifyRsp.email)
+  return _impl_.email_.Release();
+}
+inline void GetVerifyRsp::set_allocated_email(std::string* email) {
+  if (email != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.email_.SetAllocated(email, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.email_.IsDefault()) {
+    _impl_.email_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.GetVerifyRsp.email)
+}
+
+// string code = 3;
+inline void GetVerifyRsp::clear_code() {
+  _impl_.code_.ClearToEmpty();
+}
+inline const std::string& GetVerifyRsp::code() const {
+  // @@protoc_insertion_point(field_get:message.GetVerifyRsp.code)
+  return _internal_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetVerifyRsp::set_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.GetVerifyRsp.code)
+}
+inline std::string* GetVerifyRsp::mutable_code() {
+  std::string* _s = _internal_mutable_code();
+  // @@protoc_insertion_point(field_mutable:message.GetVerifyRsp.code)
+  return _s;
+}
+inline const std::string& GetVerifyRsp::_internal_code() const {
+  return _impl_.code_.Get();
+}
+inline void GetVerifyRsp::_internal_set_code(const std::string& value) {
+  
+  _impl_.code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetVerifyRsp::_internal_mutable_code() {
+  
+  return _impl_.code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetVerifyRsp::release_code() {
+  // @@protoc_insertion_point(field_release:message.GetVerifyRsp.code)
+  return _impl_.code_.Release();
+}
+inline void GetVerifyRsp::set_allocated_code(std::string* code) {
+  if (code != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.code_.SetAllocated(code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.GetVerifyRsp.code)
+}
+
+// -------------------------------------------------------------------
+
+// GetChatServerReq
+
+// int32 uid = 1;
+inline void GetChatServerReq::clear_uid() {
   _impl_.uid_ = 0;
 }
 inline int32_t GetChatServerReq::_internal_uid() const {
@@ -5753,6 +6758,66 @@ TextChatMsgReq::textmsgs() const {
   return _impl_.textmsgs_;
 }
 
+// int64 msg_id = 4;
+inline void TextChatMsgReq::clear_msg_id() {
+  _impl_.msg_id_ = int64_t{0};
+}
+inline int64_t TextChatMsgReq::_internal_msg_id() const {
+  return _impl_.msg_id_;
+}
+inline int64_t TextChatMsgReq::msg_id() const {
+  // @@protoc_insertion_point(field_get:message.TextChatMsgReq.msg_id)
+  return _internal_msg_id();
+}
+inline void TextChatMsgReq::_internal_set_msg_id(int64_t value) {
+  
+  _impl_.msg_id_ = value;
+}
+inline void TextChatMsgReq::set_msg_id(int64_t value) {
+  _internal_set_msg_id(value);
+  // @@protoc_insertion_point(field_set:message.TextChatMsgReq.msg_id)
+}
+
+// repeated .message.TextChatMsgReq batch = 5;
+inline int TextChatMsgReq::_internal_batch_size() const {
+  return _impl_.batch_.size();
+}
+inline int TextChatMsgReq::batch_size() const {
+  return _internal_batch_size();
+}
+inline void TextChatMsgReq::clear_batch() {
+  _impl_.batch_.Clear();
+}
+inline ::message::TextChatMsgReq* TextChatMsgReq::mutable_batch(int index) {
+  // @@protoc_insertion_point(field_mutable:message.TextChatMsgReq.batch)
+  return _impl_.batch_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgReq >*
+TextChatMsgReq::mutable_batch() {
+  // @@protoc_insertion_point(field_mutable_list:message.TextChatMsgReq.batch)
+  return &_impl_.batch_;
+}
+inline const ::message::TextChatMsgReq& TextChatMsgReq::_internal_batch(int index) const {
+  return _impl_.batch_.Get(index);
+}
+inline const ::message::TextChatMsgReq& TextChatMsgReq::batch(int index) const {
+  // @@protoc_insertion_point(field_get:message.TextChatMsgReq.batch)
+  return _internal_batch(index);
+}
+inline ::message::TextChatMsgReq* TextChatMsgReq::_internal_add_batch() {
+  return _impl_.batch_.Add();
+}
+inline ::message::TextChatMsgReq* TextChatMsgReq::add_batch() {
+  ::message::TextChatMsgReq* _add = _internal_add_batch();
+  // @@protoc_insertion_point(field_add:message.TextChatMsgReq.batch)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgReq >&
+TextChatMsgReq::batch() const {
+  // @@protoc_insertion_point(field_list:message.TextChatMsgReq.batch)
+  return _impl_.batch_;
+}
+
 // -------------------------------------------------------------------
 
 // TextChatData
@@ -5947,18 +7012,78 @@ inline const ::message::TextChatData& TextChatMsgRsp::textmsgs(int index) const
   // @@protoc_insertion_point(field_get:message.TextChatMsgRsp.textmsgs)
   return _internal_textmsgs(index);
 }
-inline ::message::TextChatData* TextChatMsgRsp::_internal_add_textmsgs() {
-  return _impl_.textmsgs_.Add();
+inline ::message::TextChatData* TextChatMsgRsp::_internal_add_textmsgs() {
+  return _impl_.textmsgs_.Add();
+}
+inline ::message::TextChatData* TextChatMsgRsp::add_textmsgs() {
+  ::message::TextChatData* _add = _internal_add_textmsgs();
+  // @@protoc_insertion_point(field_add:message.TextChatMsgRsp.textmsgs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >&
+TextChatMsgRsp::textmsgs() const {
+  // @@protoc_insertion_point(field_list:message.TextChatMsgRsp.textmsgs)
+  return _impl_.textmsgs_;
+}
+
+// int64 msg_id = 5;
+inline void TextChatMsgRsp::clear_msg_id() {
+  _impl_.msg_id_ = int64_t{0};
+}
+inline int64_t TextChatMsgRsp::_internal_msg_id() const {
+  return _impl_.msg_id_;
+}
+inline int64_t TextChatMsgRsp::msg_id() const {
+  // @@protoc_insertion_point(field_get:message.TextChatMsgRsp.msg_id)
+  return _internal_msg_id();
+}
+inline void TextChatMsgRsp::_internal_set_msg_id(int64_t value) {
+  
+  _impl_.msg_id_ = value;
+}
+inline void TextChatMsgRsp::set_msg_id(int64_t value) {
+  _internal_set_msg_id(value);
+  // @@protoc_insertion_point(field_set:message.TextChatMsgRsp.msg_id)
+}
+
+// repeated .message.TextChatMsgRsp batch = 6;
+inline int TextChatMsgRsp::_internal_batch_size() const {
+  return _impl_.batch_.size();
+}
+inline int TextChatMsgRsp::batch_size() const {
+  return _internal_batch_size();
+}
+inline void TextChatMsgRsp::clear_batch() {
+  _impl_.batch_.Clear();
+}
+inline ::message::TextChatMsgRsp* TextChatMsgRsp::mutable_batch(int index) {
+  // @@protoc_insertion_point(field_mutable:message.TextChatMsgRsp.batch)
+  return _impl_.batch_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >*
+TextChatMsgRsp::mutable_batch() {
+  // @@protoc_insertion_point(field_mutable_list:message.TextChatMsgRsp.batch)
+  return &_impl_.batch_;
+}
+inline const ::message::TextChatMsgRsp& TextChatMsgRsp::_internal_batch(int index) const {
+  return _impl_.batch_.Get(index);
+}
+inline const ::message::TextChatMsgRsp& TextChatMsgRsp::batch(int index) const {
+  // @@protoc_insertion_point(field_get:message.TextChatMsgRsp.batch)
+  return _internal_batch(index);
+}
+inline ::message::TextChatMsgRsp* TextChatMsgRsp::_internal_add_batch() {
+  return _impl_.batch_.Add();
 }
-inline ::message::TextChatData* TextChatMsgRsp::add_textmsgs() {
-  ::message::TextChatData* _add = _internal_add_textmsgs();
-  // @@protoc_insertion_point(field_add:message.TextChatMsgRsp.textmsgs)
+inline ::message::TextChatMsgRsp* TextChatMsgRsp::add_batch() {
+  ::message::TextChatMsgRsp* _add = _internal_add_batch();
+  // @@protoc_insertion_point(field_add:message.TextChatMsgRsp.batch)
   return _add;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >&
-TextChatMsgRsp::textmsgs() const {
-  // @@protoc_insertion_point(field_list:message.TextChatMsgRsp.textmsgs)
-  return _impl_.textmsgs_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >&
+TextChatMsgRsp::batch() const {
+  // @@protoc_insertion_point(field_list:message.TextChatMsgRsp.batch)
+  return _impl_.batch_;
 }
 
 // -------------------------------------------------------------------
@@ -6833,6 +7958,586 @@ GetMyFriendsRsp::friends() const {
   return _impl_.friends_;
 }
 
+// -------------------------------------------------------------------
+
+// ChatLoginRsp
+
+// int32 error = 1;
+inline void ChatLoginRsp::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t ChatLoginRsp::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t ChatLoginRsp::error() const {
+  // @@protoc_insertion_point(field_get:message.ChatLoginRsp.error)
+  return _internal_error();
+}
+inline void ChatLoginRsp::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void ChatLoginRsp::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.ChatLoginRsp.error)
+}
+
+// .message.UserInfo user = 2;
+inline bool ChatLoginRsp::_internal_has_user() const {
+  return this != internal_default_instance() && _impl_.user_ != nullptr;
+}
+inline bool ChatLoginRsp::has_user() const {
+  return _internal_has_user();
+}
+inline void ChatLoginRsp::clear_user() {
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+}
+inline const ::message::UserInfo& ChatLoginRsp::_internal_user() const {
+  const ::message::UserInfo* p = _impl_.user_;
+  return p != nullptr ? *p : reinterpret_cast<const ::message::UserInfo&>(
+      ::message::_UserInfo_default_instance_);
+}
+inline const ::message::UserInfo& ChatLoginRsp::user() const {
+  // @@protoc_insertion_point(field_get:message.ChatLoginRsp.user)
+  return _internal_user();
+}
+inline void ChatLoginRsp::unsafe_arena_set_allocated_user(
+    ::message::UserInfo* user) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.user_);
+  }
+  _impl_.user_ = user;
+  if (user) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:message.ChatLoginRsp.user)
+}
+inline ::message::UserInfo* ChatLoginRsp::release_user() {
+  
+  ::message::UserInfo* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::message::UserInfo* ChatLoginRsp::unsafe_arena_release_user() {
+  // @@protoc_insertion_point(field_release:message.ChatLoginRsp.user)
+  
+  ::message::UserInfo* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+  return temp;
+}
+inline ::message::UserInfo* ChatLoginRsp::_internal_mutable_user() {
+  
+  if (_impl_.user_ == nullptr) {
+    auto* p = CreateMaybeMessage<::message::UserInfo>(GetArenaForAllocation());
+    _impl_.user_ = p;
+  }
+  return _impl_.user_;
+}
+inline ::message::UserInfo* ChatLoginRsp::mutable_user() {
+  ::message::UserInfo* _msg = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:message.ChatLoginRsp.user)
+  return _msg;
+}
+inline void ChatLoginRsp::set_allocated_user(::message::UserInfo* user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.user_;
+  }
+  if (user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user);
+    if (message_arena != submessage_arena) {
+      user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.user_ = user;
+  // @@protoc_insertion_point(field_set_allocated:message.ChatLoginRsp.user)
+}
+
+// -------------------------------------------------------------------
+
+// GetOfflineMsgReq
+
+// int32 uid = 1;
+inline void GetOfflineMsgReq::clear_uid() {
+  _impl_.uid_ = 0;
+}
+inline int32_t GetOfflineMsgReq::_internal_uid() const {
+  return _impl_.uid_;
+}
+inline int32_t GetOfflineMsgReq::uid() const {
+  // @@protoc_insertion_point(field_get:message.GetOfflineMsgReq.uid)
+  return _internal_uid();
+}
+inline void GetOfflineMsgReq::_internal_set_uid(int32_t value) {
+  
+  _impl_.uid_ = value;
+}
+inline void GetOfflineMsgReq::set_uid(int32_t value) {
+  _internal_set_uid(value);
+  // @@protoc_insertion_point(field_set:message.GetOfflineMsgReq.uid)
+}
+
+// -------------------------------------------------------------------
+
+// OfflineMsgAck
+
+// int32 uid = 1;
+inline void OfflineMsgAck::clear_uid() {
+  _impl_.uid_ = 0;
+}
+inline int32_t OfflineMsgAck::_internal_uid() const {
+  return _impl_.uid_;
+}
+inline int32_t OfflineMsgAck::uid() const {
+  // @@protoc_insertion_point(field_get:message.OfflineMsgAck.uid)
+  return _internal_uid();
+}
+inline void OfflineMsgAck::_internal_set_uid(int32_t value) {
+  
+  _impl_.uid_ = value;
+}
+inline void OfflineMsgAck::set_uid(int32_t value) {
+  _internal_set_uid(value);
+  // @@protoc_insertion_point(field_set:message.OfflineMsgAck.uid)
+}
+
+// int64 max_msg_id = 2;
+inline void OfflineMsgAck::clear_max_msg_id() {
+  _impl_.max_msg_id_ = int64_t{0};
+}
+inline int64_t OfflineMsgAck::_internal_max_msg_id() const {
+  return _impl_.max_msg_id_;
+}
+inline int64_t OfflineMsgAck::max_msg_id() const {
+  // @@protoc_insertion_point(field_get:message.OfflineMsgAck.max_msg_id)
+  return _internal_max_msg_id();
+}
+inline void OfflineMsgAck::_internal_set_max_msg_id(int64_t value) {
+  
+  _impl_.max_msg_id_ = value;
+}
+inline void OfflineMsgAck::set_max_msg_id(int64_t value) {
+  _internal_set_max_msg_id(value);
+  // @@protoc_insertion_point(field_set:message.OfflineMsgAck.max_msg_id)
+}
+
+// string inbox_id = 3;
+inline void OfflineMsgAck::clear_inbox_id() {
+  _impl_.inbox_id_.ClearToEmpty();
+}
+inline const std::string& OfflineMsgAck::inbox_id() const {
+  // @@protoc_insertion_point(field_get:message.OfflineMsgAck.inbox_id)
+  return _internal_inbox_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OfflineMsgAck::set_inbox_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.inbox_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.OfflineMsgAck.inbox_id)
+}
+inline std::string* OfflineMsgAck::mutable_inbox_id() {
+  std::string* _s = _internal_mutable_inbox_id();
+  // @@protoc_insertion_point(field_mutable:message.OfflineMsgAck.inbox_id)
+  return _s;
+}
+inline const std::string& OfflineMsgAck::_internal_inbox_id() const {
+  return _impl_.inbox_id_.Get();
+}
+inline void OfflineMsgAck::_internal_set_inbox_id(const std::string& value) {
+  
+  _impl_.inbox_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OfflineMsgAck::_internal_mutable_inbox_id() {
+  
+  return _impl_.inbox_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OfflineMsgAck::release_inbox_id() {
+  // @@protoc_insertion_point(field_release:message.OfflineMsgAck.inbox_id)
+  return _impl_.inbox_id_.Release();
+}
+inline void OfflineMsgAck::set_allocated_inbox_id(std::string* inbox_id) {
+  if (inbox_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.inbox_id_.SetAllocated(inbox_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.inbox_id_.IsDefault()) {
+    _impl_.inbox_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.OfflineMsgAck.inbox_id)
+}
+
+// -------------------------------------------------------------------
+
+// OfflineMsgBatch
+
+// int32 error = 1;
+inline void OfflineMsgBatch::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t OfflineMsgBatch::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t OfflineMsgBatch::error() const {
+  // @@protoc_insertion_point(field_get:message.OfflineMsgBatch.error)
+  return _internal_error();
+}
+inline void OfflineMsgBatch::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void OfflineMsgBatch::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.OfflineMsgBatch.error)
+}
+
+// repeated .message.TextChatMsgRsp msgs = 2;
+inline int OfflineMsgBatch::_internal_msgs_size() const {
+  return _impl_.msgs_.size();
+}
+inline int OfflineMsgBatch::msgs_size() const {
+  return _internal_msgs_size();
+}
+inline void OfflineMsgBatch::clear_msgs() {
+  _impl_.msgs_.Clear();
+}
+inline ::message::TextChatMsgRsp* OfflineMsgBatch::mutable_msgs(int index) {
+  // @@protoc_insertion_point(field_mutable:message.OfflineMsgBatch.msgs)
+  return _impl_.msgs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >*
+OfflineMsgBatch::mutable_msgs() {
+  // @@protoc_insertion_point(field_mutable_list:message.OfflineMsgBatch.msgs)
+  return &_impl_.msgs_;
+}
+inline const ::message::TextChatMsgRsp& OfflineMsgBatch::_internal_msgs(int index) const {
+  return _impl_.msgs_.Get(index);
+}
+inline const ::message::TextChatMsgRsp& OfflineMsgBatch::msgs(int index) const {
+  // @@protoc_insertion_point(field_get:message.OfflineMsgBatch.msgs)
+  return _internal_msgs(index);
+}
+inline ::message::TextChatMsgRsp* OfflineMsgBatch::_internal_add_msgs() {
+  return _impl_.msgs_.Add();
+}
+inline ::message::TextChatMsgRsp* OfflineMsgBatch::add_msgs() {
+  ::message::TextChatMsgRsp* _add = _internal_add_msgs();
+  // @@protoc_insertion_point(field_add:message.OfflineMsgBatch.msgs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >&
+OfflineMsgBatch::msgs() const {
+  // @@protoc_insertion_point(field_list:message.OfflineMsgBatch.msgs)
+  return _impl_.msgs_;
+}
+
+// int64 last_id = 3;
+inline void OfflineMsgBatch::clear_last_id() {
+  _impl_.last_id_ = int64_t{0};
+}
+inline int64_t OfflineMsgBatch::_internal_last_id() const {
+  return _impl_.last_id_;
+}
+inline int64_t OfflineMsgBatch::last_id() const {
+  // @@protoc_insertion_point(field_get:message.OfflineMsgBatch.last_id)
+  return _internal_last_id();
+}
+inline void OfflineMsgBatch::_internal_set_last_id(int64_t value) {
+  
+  _impl_.last_id_ = value;
+}
+inline void OfflineMsgBatch::set_last_id(int64_t value) {
+  _internal_set_last_id(value);
+  // @@protoc_insertion_point(field_set:message.OfflineMsgBatch.last_id)
+}
+
+// bool more = 4;
+inline void OfflineMsgBatch::clear_more() {
+  _impl_.more_ = false;
+}
+inline bool OfflineMsgBatch::_internal_more() const {
+  return _impl_.more_;
+}
+inline bool OfflineMsgBatch::more() const {
+  // @@protoc_insertion_point(field_get:message.OfflineMsgBatch.more)
+  return _internal_more();
+}
+inline void OfflineMsgBatch::_internal_set_more(bool value) {
+  
+  _impl_.more_ = value;
+}
+inline void OfflineMsgBatch::set_more(bool value) {
+  _internal_set_more(value);
+  // @@protoc_insertion_point(field_set:message.OfflineMsgBatch.more)
+}
+
+// string inbox_id = 5;
+inline void OfflineMsgBatch::clear_inbox_id() {
+  _impl_.inbox_id_.ClearToEmpty();
+}
+inline const std::string& OfflineMsgBatch::inbox_id() const {
+  // @@protoc_insertion_point(field_get:message.OfflineMsgBatch.inbox_id)
+  return _internal_inbox_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OfflineMsgBatch::set_inbox_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.inbox_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.OfflineMsgBatch.inbox_id)
+}
+inline std::string* OfflineMsgBatch::mutable_inbox_id() {
+  std::string* _s = _internal_mutable_inbox_id();
+  // @@protoc_insertion_point(field_mutable:message.OfflineMsgBatch.inbox_id)
+  return _s;
+}
+inline const std::string& OfflineMsgBatch::_internal_inbox_id() const {
+  return _impl_.inbox_id_.Get();
+}
+inline void OfflineMsgBatch::_internal_set_inbox_id(const std::string& value) {
+  
+  _impl_.inbox_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OfflineMsgBatch::_internal_mutable_inbox_id() {
+  
+  return _impl_.inbox_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OfflineMsgBatch::release_inbox_id() {
+  // @@protoc_insertion_point(field_release:message.OfflineMsgBatch.inbox_id)
+  return _impl_.inbox_id_.Release();
+}
+inline void OfflineMsgBatch::set_allocated_inbox_id(std::string* inbox_id) {
+  if (inbox_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.inbox_id_.SetAllocated(inbox_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.inbox_id_.IsDefault()) {
+    _impl_.inbox_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.OfflineMsgBatch.inbox_id)
+}
+
+// -------------------------------------------------------------------
+
+// PeerFrame
+
+// string from_server = 1;
+inline void PeerFrame::clear_from_server() {
+  _impl_.from_server_.ClearToEmpty();
+}
+inline const std::string& PeerFrame::from_server() const {
+  // @@protoc_insertion_point(field_get:message.PeerFrame.from_server)
+  return _internal_from_server();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PeerFrame::set_from_server(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.from_server_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.PeerFrame.from_server)
+}
+inline std::string* PeerFrame::mutable_from_server() {
+  std::string* _s = _internal_mutable_from_server();
+  // @@protoc_insertion_point(field_mutable:message.PeerFrame.from_server)
+  return _s;
+}
+inline const std::string& PeerFrame::_internal_from_server() const {
+  return _impl_.from_server_.Get();
+}
+inline void PeerFrame::_internal_set_from_server(const std::string& value) {
+  
+  _impl_.from_server_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PeerFrame::_internal_mutable_from_server() {
+  
+  return _impl_.from_server_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PeerFrame::release_from_server() {
+  // @@protoc_insertion_point(field_release:message.PeerFrame.from_server)
+  return _impl_.from_server_.Release();
+}
+inline void PeerFrame::set_allocated_from_server(std::string* from_server) {
+  if (from_server != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.from_server_.SetAllocated(from_server, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.from_server_.IsDefault()) {
+    _impl_.from_server_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.PeerFrame.from_server)
+}
+
+// int64 epoch = 2;
+inline void PeerFrame::clear_epoch() {
+  _impl_.epoch_ = int64_t{0};
+}
+inline int64_t PeerFrame::_internal_epoch() const {
+  return _impl_.epoch_;
+}
+inline int64_t PeerFrame::epoch() const {
+  // @@protoc_insertion_point(field_get:message.PeerFrame.epoch)
+  return _internal_epoch();
+}
+inline void PeerFrame::_internal_set_epoch(int64_t value) {
+  
+  _impl_.epoch_ = value;
+}
+inline void PeerFrame::set_epoch(int64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:message.PeerFrame.epoch)
+}
+
+// int64 seq = 3;
+inline void PeerFrame::clear_seq() {
+  _impl_.seq_ = int64_t{0};
+}
+inline int64_t PeerFrame::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline int64_t PeerFrame::seq() const {
+  // @@protoc_insertion_point(field_get:message.PeerFrame.seq)
+  return _internal_seq();
+}
+inline void PeerFrame::_internal_set_seq(int64_t value) {
+  
+  _impl_.seq_ = value;
+}
+inline void PeerFrame::set_seq(int64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:message.PeerFrame.seq)
+}
+
+// repeated .message.TextChatMsgReq msgs = 4;
+inline int PeerFrame::_internal_msgs_size() const {
+  return _impl_.msgs_.size();
+}
+inline int PeerFrame::msgs_size() const {
+  return _internal_msgs_size();
+}
+inline void PeerFrame::clear_msgs() {
+  _impl_.msgs_.Clear();
+}
+inline ::message::TextChatMsgReq* PeerFrame::mutable_msgs(int index) {
+  // @@protoc_insertion_point(field_mutable:message.PeerFrame.msgs)
+  return _impl_.msgs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgReq >*
+PeerFrame::mutable_msgs() {
+  // @@protoc_insertion_point(field_mutable_list:message.PeerFrame.msgs)
+  return &_impl_.msgs_;
+}
+inline const ::message::TextChatMsgReq& PeerFrame::_internal_msgs(int index) const {
+  return _impl_.msgs_.Get(index);
+}
+inline const ::message::TextChatMsgReq& PeerFrame::msgs(int index) const {
+  // @@protoc_insertion_point(field_get:message.PeerFrame.msgs)
+  return _internal_msgs(index);
+}
+inline ::message::TextChatMsgReq* PeerFrame::_internal_add_msgs() {
+  return _impl_.msgs_.Add();
+}
+inline ::message::TextChatMsgReq* PeerFrame::add_msgs() {
+  ::message::TextChatMsgReq* _add = _internal_add_msgs();
+  // @@protoc_insertion_point(field_add:message.PeerFrame.msgs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgReq >&
+PeerFrame::msgs() const {
+  // @@protoc_insertion_point(field_list:message.PeerFrame.msgs)
+  return _impl_.msgs_;
+}
+
+// int64 ack = 5;
+inline void PeerFrame::clear_ack() {
+  _impl_.ack_ = int64_t{0};
+}
+inline int64_t PeerFrame::_internal_ack() const {
+  return _impl_.ack_;
+}
+inline int64_t PeerFrame::ack() const {
+  // @@protoc_insertion_point(field_get:message.PeerFrame.ack)
+  return _internal_ack();
+}
+inline void PeerFrame::_internal_set_ack(int64_t value) {
+  
+  _impl_.ack_ = value;
+}
+inline void PeerFrame::set_ack(int64_t value) {
+  _internal_set_ack(value);
+  // @@protoc_insertion_point(field_set:message.PeerFrame.ack)
+}
+
+// repeated .message.TextChatMsgRsp results = 6;
+inline int PeerFrame::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int PeerFrame::results_size() const {
+  return _internal_results_size();
+}
+inline void PeerFrame::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::message::TextChatMsgRsp* PeerFrame::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:message.PeerFrame.results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >*
+PeerFrame::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:message.PeerFrame.results)
+  return &_impl_.results_;
+}
+inline const ::message::TextChatMsgRsp& PeerFrame::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::message::TextChatMsgRsp& PeerFrame::results(int index) const {
+  // @@protoc_insertion_point(field_get:message.PeerFrame.results)
+  return _internal_results(index);
+}
+inline ::message::TextChatMsgRsp* PeerFrame::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::message::TextChatMsgRsp* PeerFrame::add_results() {
+  ::message::TextChatMsgRsp* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:message.PeerFrame.results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatMsgRsp >&
+PeerFrame::results() const {
+  // @@protoc_insertion_point(field_list:message.PeerFrame.results)
+  return _impl_.results_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -6884,6 +8589,16 @@ GetMyFriendsRsp::friends() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
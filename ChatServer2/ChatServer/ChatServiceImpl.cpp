@@ -45,7 +45,7 @@ Status ChatServiceImpl::NotifyAddFriend(ServerContext* context, const AddFriendR
     rtvalue["name"] = request->name();
     rtvalue["desc"] = request->desc();
 
-    std::string return_str = rtvalue.toStyledString();
+    std::string return_str = ToCompactJson(rtvalue);
 
     // [FriendNotify]
     std::cout << "[FriendNotify][Chat][gRPC] send TCP notify uid=" << touid
@@ -106,7 +106,7 @@ Status ChatServiceImpl::NotifyTextChatMsg(ServerContext* context, const TextChat
     }
     rtvalue["text_array"] = text_array;
 
-    std::string return_str = rtvalue.toStyledString();
+    std::string return_str = ToCompactJson(rtvalue);
     std::cout << "[TextChat][gRPC] send TCP 1019 to uid=" << touid
               << " body_len=" << return_str.size() << std::endl;
     session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
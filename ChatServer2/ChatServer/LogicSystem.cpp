@@ -99,7 +99,7 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const short& m
 	bool success = RedisMgr::GetInstance()->Get(token_key, token_value);
 	if (!success) {
 		rtvalue["error"] = ErrorCodes::UidInvalid;
-		std::string return_str = rtvalue.toStyledString();
+		std::string return_str = ToCompactJson(rtvalue);
 		std::cout << "[LoginHandler TEST] send before return, body=" << return_str
 			<< " msgid=" << MSG_CHAT_LOGIN_RSP << std::endl;
 		session->Send(return_str, MSG_CHAT_LOGIN_RSP);
@@ -108,7 +108,7 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const short& m
 	// 验证token是否匹配
 	if (token_value != token) {
 		rtvalue["error"] = ErrorCodes::TokenInvalid;
-		std::string return_str = rtvalue.toStyledString();
+		std::string return_str = ToCompactJson(rtvalue);
 		std::cout << "[LoginHandler TEST] send before return, body=" << return_str
 			<< " msgid=" << MSG_CHAT_LOGIN_RSP << std::endl;
 		session->Send(return_str, MSG_CHAT_LOGIN_RSP);
@@ -123,7 +123,7 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const short& m
 	bool b_base = GetBaseInfo(base_key, uid, user_info);
 	if (!b_base) {
 		rtvalue["error"] = ErrorCodes::UidInvalid;
-		std::string return_str = rtvalue.toStyledString();
+		std::string return_str = ToCompactJson(rtvalue);
 		std::cout << "[LoginHandler TEST] send before return, body=" << return_str
 			<< " msgid=" << MSG_CHAT_LOGIN_RSP << std::endl;
 		session->Send(return_str, MSG_CHAT_LOGIN_RSP);
@@ -161,7 +161,7 @@ void LogicSystem::LoginHandler(std::shared_ptr<CSession> session, const short& m
 	UserMgr::GetInstance()->SetUserSession(uid, session);
 
 	// 统一返回统一发送成功包
-	std::string return_str = rtvalue.toStyledString();
+	std::string return_str = ToCompactJson(rtvalue);
 	std::cout << "[LoginHandler TEST] send success, uid=" << uid
 		<< " body=" << return_str << " msgid=" << MSG_CHAT_LOGIN_RSP << std::endl;
 	session->Send(return_str, MSG_CHAT_LOGIN_RSP);
@@ -188,10 +188,10 @@ void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short
 	rtvalue["touid"] = touid;
 
 	// 统一构造用于下发和持久化的 JSON 文本
-	std::string notify_str_cache = rtvalue.toStyledString();
+	std::string notify_str_cache = ToCompactJson(rtvalue);
 
 	Defer defer([this, &rtvalue, session]() {
-		std::string return_str = rtvalue.toStyledString();
+		std::string return_str = ToCompactJson(rtvalue);
 		session->Send(return_str, ID_TEXT_CHAT_MSG_RSP);
 		});
 
@@ -370,7 +370,7 @@ bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<Use
 		redis_root["desc"] = userinfo->desc; // 空值
 		redis_root["sex"] = userinfo->sex;   // 0
 		redis_root["icon"] = userinfo->icon; // 空值
-		RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
+		RedisMgr::GetInstance()->Set(base_key, ToCompactJson(redis_root));
 	}
 	return true;
 }
@@ -60,7 +60,7 @@ LogicSystem::LogicSystem() {
         if (!parse_success) {
             std::cout << "Failed to parse Json data!" << std::endl;
             root["error"] = ErrorCodes::Error_Json;
-            std::string jsonstr = root.toStyledString();
+            std::string jsonstr = ToCompactJson(root);
             beast::ostream(connection->_response.body()) << jsonstr;
 
             //      д ??   
@@ -72,7 +72,7 @@ LogicSystem::LogicSystem() {
         if (!src_root.isMember("email")) {
             std::cout << "Failed to parse Json data!" << std::endl;
             root["error"] = ErrorCodes::Error_Json;
-            std::string jsonstr = root.toStyledString();
+            std::string jsonstr = ToCompactJson(root);
             beast::ostream(connection->_response.body()) << jsonstr;
 
             //      д ??   
@@ -87,7 +87,7 @@ LogicSystem::LogicSystem() {
 
         root["error"] = rsp.error();
         root["email"] = src_root["email"];
-        std::string jsonstr = root.toStyledString();
+        std::string jsonstr = ToCompactJson(root);
         beast::ostream(connection->_response.body()) << jsonstr;
 
         //      д ??   
@@ -107,7 +107,7 @@ LogicSystem::LogicSystem() {
         if (!parse_success) {
             std::cout << "Failed to parse JSON data!" << std::endl;
             root["error"] = ErrorCodes::Error_Json;
-            std::string jsonstr = root.toStyledString();
+            std::string jsonstr = ToCompactJson(root);
             beast::ostream(connection->_response.body()) << jsonstr;
 
             connection->_response.set(http::field::content_type, "application/json");
@@ -123,7 +123,7 @@ LogicSystem::LogicSystem() {
         if (pwd != confirm) {
             std::cout << "password err " << std::endl;
             root["error"] = ErrorCodes::PasswdErr;
-            std::string jsonstr = root.toStyledString();
+            std::string jsonstr = ToCompactJson(root);
             beast::ostream(connection->_response.body()) << jsonstr;
 
             connection->_response.set(http::field::content_type, "application/json");
@@ -137,7 +137,7 @@ LogicSystem::LogicSystem() {
         if (!b_get_verify) {
             std::cout << " get verify code expired" << std::endl;
             root["error"] = ErrorCodes::VerifyExpired;
-            std::string jsonstr = root.toStyledString();
+            std::string jsonstr = ToCompactJson(root);
             beast::ostream(connection->_response.body()) << jsonstr;
 
             //      д ??   
@@ -149,7 +149,7 @@ LogicSystem::LogicSystem() {
         if (verify_code != src_root["verifycode"].asString()) {
             std::cout << " verify code error" << std::endl;
             root["error"] = ErrorCodes::VerifyCodeErr;
-            std::string jsonstr = root.toStyledString();
+            std::string jsonstr = ToCompactJson(root);
             beast::ostream(connection->_response.body()) << jsonstr;
 
             //      д ??   
@@ -166,7 +166,7 @@ LogicSystem::LogicSystem() {
         if (uid == 0 || uid == -1) {
             std::cout << " user or email exist" << std::endl;
             root["error"] = ErrorCodes::UserExist;
-            std::string jsonstr = root.toStyledString();
+            std::string jsonstr = ToCompactJson(root);
             beast::ostream(connection->_response.body()) << jsonstr;
 
             connection->_response.set(http::field::content_type, "application/json");
@@ -181,7 +181,7 @@ LogicSystem::LogicSystem() {
         //root["passwd"] = pwd;
         root["confirm"] = confirm;
         root["verifycode"] = src_root["verifycode"].asString();
-        std::string jsonstr = root.toStyledString();
+        std::string jsonstr = ToCompactJson(root);
         beast::ostream(connection->_response.body()) << jsonstr;
 
         connection->_response.set(http::field::content_type, "application/json");
@@ -199,7 +199,7 @@ LogicSystem::LogicSystem() {
         Json::Value src_root;
         if (!reader.parse(body_str, src_root)) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -212,7 +212,7 @@ LogicSystem::LogicSystem() {
 
         if (email.empty() || pwd_plain.empty() || verifycode.empty()) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -222,13 +222,13 @@ LogicSystem::LogicSystem() {
         bool b_get_verify = RedisMgr::GetInstance()->Get(CODEPREFIX + email, verify_code);
         if (!b_get_verify) {
             root["error"] = ErrorCodes::VerifyExpired;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
         if (verify_code != verifycode) {
             root["error"] = ErrorCodes::VerifyCodeErr;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -238,7 +238,7 @@ LogicSystem::LogicSystem() {
         if (!b_up) {
             std::cout << " update pwd failed" << std::endl;
             root["error"] = ErrorCodes::PasswdUpFailed;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -246,7 +246,7 @@ LogicSystem::LogicSystem() {
         std::cout << "succeed to update password (by email) for " << email << std::endl;
         root["error"] = 0;
         root["email"] = email;
-        std::string jsonstr = root.toStyledString();
+        std::string jsonstr = ToCompactJson(root);
         beast::ostream(connection->_response.body()) << jsonstr;
         connection->WriteResponse();
         return true;
@@ -263,7 +263,7 @@ LogicSystem::LogicSystem() {
         if (!reader.parse(body_str, src_root)) {
             std::cout << "Failed to parse JSON data!" << std::endl;
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -301,7 +301,7 @@ LogicSystem::LogicSystem() {
 
         if (identifier.empty() || pwd_plain.empty()) {
             root["error"] = ErrorCodes::PasswdInvalid;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -312,7 +312,7 @@ LogicSystem::LogicSystem() {
         if (!pwd_valid) {
             std::cout << " user pwd not match" << std::endl;
             root["error"] = ErrorCodes::PasswdInvalid;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -324,7 +324,7 @@ LogicSystem::LogicSystem() {
                 << ", reply.error=" << reply.error()
                 << ", host='" << reply.host() << "' port='" << reply.port() << "'\n";
             root["error"] = ErrorCodes::RPCGetFailed; //    ?    NoChatServer
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -345,7 +345,7 @@ LogicSystem::LogicSystem() {
             redis_root["desc"] = "";
             redis_root["sex"] = 0;
             redis_root["icon"] = "";
-            RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
+            RedisMgr::GetInstance()->Set(base_key, ToCompactJson(redis_root));
         }
         catch (...) {
             // 忽略缓存失败，不影响登录主流程
@@ -357,7 +357,7 @@ LogicSystem::LogicSystem() {
         root["token"] = reply.token();
         root["host"] = reply.host();
         root["port"] = reply.port();
-        beast::ostream(connection->_response.body()) << root.toStyledString();
+        beast::ostream(connection->_response.body()) << ToCompactJson(root);
         connection->WriteResponse();
         return true;
         });
@@ -373,7 +373,7 @@ LogicSystem::LogicSystem() {
         Json::Value src_root;
         if (!reader.parse(body_str, src_root)) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -383,7 +383,7 @@ LogicSystem::LogicSystem() {
 
         if (uid <= 0 || keyword.empty()) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -412,7 +412,7 @@ LogicSystem::LogicSystem() {
         root["users"] = usersArray;
         std::cout << "[LogicSystem] 返回 " << usersArray.size() << " 个用户的JSON响应" << std::endl;
 
-        beast::ostream(connection->_response.body()) << root.toStyledString();
+        beast::ostream(connection->_response.body()) << ToCompactJson(root);
         connection->WriteResponse();
         return true;
         });
@@ -428,7 +428,7 @@ LogicSystem::LogicSystem() {
         Json::Value src_root;
         if (!reader.parse(body_str, src_root)) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -436,7 +436,7 @@ LogicSystem::LogicSystem() {
         int uid = src_root.get("uid", 0).asInt();
         if (uid <= 0) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -459,7 +459,7 @@ LogicSystem::LogicSystem() {
         }
         root["requests"] = requestsArray;
 
-        beast::ostream(connection->_response.body()) << root.toStyledString();
+        beast::ostream(connection->_response.body()) << ToCompactJson(root);
         connection->WriteResponse();
         return true;
         });
@@ -475,7 +475,7 @@ LogicSystem::LogicSystem() {
         Json::Value src_root;
         if (!reader.parse(body_str, src_root)) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -483,7 +483,7 @@ LogicSystem::LogicSystem() {
         int uid = src_root.get("uid", 0).asInt();
         if (uid <= 0) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -506,7 +506,7 @@ LogicSystem::LogicSystem() {
         }
         root["friends"] = friendsArray;
 
-        beast::ostream(connection->_response.body()) << root.toStyledString();
+        beast::ostream(connection->_response.body()) << ToCompactJson(root);
         connection->WriteResponse();
         return true;
         });
@@ -522,7 +522,7 @@ LogicSystem::LogicSystem() {
         Json::Value src_root;
         if (!reader.parse(body_str, src_root)) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -536,7 +536,7 @@ LogicSystem::LogicSystem() {
 
         if (fromUid <= 0 || toUid <= 0 || fromUid == toUid) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -544,7 +544,7 @@ LogicSystem::LogicSystem() {
         // 检查是否已经是好友
         if (MysqlMgr::GetInstance()->IsFriend(fromUid, toUid)) {
             root["error"] = ErrorCodes::UserExist; // 已经是好友
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -564,13 +564,13 @@ LogicSystem::LogicSystem() {
         ev["desc"] = desc;
         ev["error"] = root["error"].asInt();
         {
-            auto payload = ev.toStyledString();
+            auto payload = ToCompactJson(ev);
             std::cout << "[FriendNotify][Gate] publish channel=friend.apply payload=" << payload << std::endl;
             bool pubok = RedisMgr::GetInstance()->Publish("friend.apply", payload);
             std::cout << "[FriendNotify][Gate] publish friend.apply result=" << std::boolalpha << pubok << std::endl;
         }
 
-        beast::ostream(connection->_response.body()) << root.toStyledString();
+        beast::ostream(connection->_response.body()) << ToCompactJson(root);
         connection->WriteResponse();
         return true;
         });
@@ -586,7 +586,7 @@ LogicSystem::LogicSystem() {
         Json::Value src_root;
         if (!reader.parse(body_str, src_root)) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -600,7 +600,7 @@ LogicSystem::LogicSystem() {
 
         if (fromUid <= 0 || toUid <= 0) {
             root["error"] = ErrorCodes::Error_Json;
-            beast::ostream(connection->_response.body()) << root.toStyledString();
+            beast::ostream(connection->_response.body()) << ToCompactJson(root);
             connection->WriteResponse();
             return true;
         }
@@ -620,13 +620,13 @@ LogicSystem::LogicSystem() {
         ev["agree"] = agree;
         ev["error"] = root["error"].asInt();
         {
-            auto payload = ev.toStyledString();
+            auto payload = ToCompactJson(ev);
             std::cout << "[FriendNotify][Gate] publish channel=friend.reply payload=" << payload << std::endl;
             bool pubok = RedisMgr::GetInstance()->Publish("friend.reply", payload);
             std::cout << "[FriendNotify][Gate] publish friend.reply result=" << std::boolalpha << pubok << std::endl;
         }
 
-        beast::ostream(connection->_response.body()) << root.toStyledString();
+        beast::ostream(connection->_response.body()) << ToCompactJson(root);
         connection->WriteResponse();
         return true;
         });
@@ -11,6 +11,7 @@
 #include<json/json.h>
 #include<json/value.h>
 #include<json/reader.h>
+#include "JsonUtil.h"
 #include<boost/filesystem.hpp>
 #include<boost/property_tree/ptree.hpp>
 #include<boost/property_tree/ini_parser.hpp>
@@ -0,0 +1,401 @@
+// ChatMsgWriter 测试与写入吞吐基准
+// 1. 攒够 N 条就写：消息按提交顺序入库，每批不超过 BatchRows，每条消息的 future 都完成
+// 2. 不足一批时等 FlushIntervalMs 后写入
+// 3. 整批失败后逐条重试，只有坏的那条失败
+// 4. 字节数上限、排队上限（满了 Submit 返回 false），Stop 写完剩余消息
+// 5. 本机 MySQL 写入吞吐：原来的每条一个 INSERT（AsyncDBPool 多线程并发）对比攒批多行 INSERT
+//    （需要 -DWITH_MYSQL 编译并在命令行给出连接参数，会创建并删除 messages_bench 表）
+//
+// 编译（以下为同一条命令）：
+//   g++ -std=c++17 -O2 -pthread -I../ChatServer/ChatServer bench_chat_msg_writer.cpp
+//       ../ChatServer/ChatServer/Logger.cpp -o bench_chat_msg_writer
+//       带 MySQL 基准：再加 -DWITH_MYSQL -lmysqlcppconn
+// 运行：./bench_chat_msg_writer [tcp://127.0.0.1:3306 user passwd schema [messages] [db_threads]]
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <atomic>
+#include <thread>
+
+#include "ChatMsgWriter.h"
+#ifdef WITH_MYSQL
+#include <mysql_driver.h>
+#include <cppconn/prepared_statement.h>
+#include <cppconn/resultset.h>
+#include <cppconn/statement.h>
+#include <cppconn/exception.h>
+#include "TaskExecutor.h"
+#endif
+
+// 记录每批写入的假 sink，可以在第一批时卡住写入线程
+class RecordingSink {
+public:
+    bool WriteBatch(const std::vector<ChatMsgRow>& rows) {
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            _started = true;
+            _cond.notify_all();
+            _cond.wait(lock, [this] { return _open; });
+            _batch_sizes.push_back(rows.size());
+            for (const auto& row : rows) {
+                _from_uids.push_back(row.from_uid);
+            }
+        }
+        return !_fail_batches;
+    }
+
+    bool WriteRow(const ChatMsgRow& row) {
+        std::lock_guard<std::mutex> lock(_mtx);
+        ++_row_writes;
+        return row.payload != "bad";
+    }
+
+    ChatMsgWriter::BatchSink Batch() { return [this](const std::vector<ChatMsgRow>& rows) { return WriteBatch(rows); }; }
+    ChatMsgWriter::RowSink Row() { return [this](const ChatMsgRow& row) { return WriteRow(row); }; }
+
+    void Close() { std::lock_guard<std::mutex> lock(_mtx); _open = false; }
+    void Open() {
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _open = true;
+        }
+        _cond.notify_all();
+    }
+    void WaitStarted() {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _cond.wait(lock, [this] { return _started; });
+    }
+
+    std::vector<std::size_t> BatchSizes() { std::lock_guard<std::mutex> lock(_mtx); return _batch_sizes; }
+    std::vector<int> FromUids() { std::lock_guard<std::mutex> lock(_mtx); return _from_uids; }
+    int RowWrites() { std::lock_guard<std::mutex> lock(_mtx); return _row_writes; }
+
+    bool _fail_batches = false;
+
+private:
+    std::mutex _mtx;
+    std::condition_variable _cond;
+    bool _open = true;
+    bool _started = false;
+    std::vector<std::size_t> _batch_sizes;
+    std::vector<int> _from_uids;
+    int _row_writes = 0;
+};
+
+ChatMsgRow MakeRow(int from_uid, const std::string& payload = "{\"text\":\"hello\"}") {
+    return ChatMsgRow{ from_uid, 10000 + from_uid, payload };
+}
+
+void TestBatchBySize() {
+    std::cout << "\n=== Test 1: Flush every BatchRows, in order ===" << std::endl;
+    RecordingSink sink;
+    ChatMsgWriter::Options options;
+    options.batch_rows = 100;
+    options.flush_ms = 1000;
+    ChatMsgWriter writer(options, sink.Batch(), sink.Row());
+
+    const int count = 1000;
+    std::vector<std::future<bool>> dones(count);
+    for (int i = 0; i < count; ++i) {
+        assert(writer.Submit(MakeRow(i), &dones[i]));
+    }
+    for (auto& done : dones) {
+        assert(done.get());
+    }
+
+    std::vector<int> uids = sink.FromUids();
+    assert(uids.size() == static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        assert(uids[i] == i);
+    }
+    for (std::size_t size : sink.BatchSizes()) {
+        assert(size <= options.batch_rows);
+    }
+    ChatMsgWriter::Stats stats = writer.Snapshot();
+    assert(stats.submitted == static_cast<uint64_t>(count) && stats.written == static_cast<uint64_t>(count));
+    assert(stats.failed == 0 && stats.pending == 0);
+    std::cout << "batches: " << stats.batches << ", avg rows: " << stats.avg_batch_rows << std::endl;
+    std::cout << "✓ Test 1 passed" << std::endl;
+}
+
+void TestFlushInterval() {
+    std::cout << "\n=== Test 2: Partial batch flushed after FlushIntervalMs ===" << std::endl;
+    RecordingSink sink;
+    ChatMsgWriter::Options options;
+    options.batch_rows = 100;
+    options.flush_ms = 30;
+    ChatMsgWriter writer(options, sink.Batch(), sink.Row());
+
+    auto start = std::chrono::steady_clock::now();
+    std::future<bool> last;
+    writer.Submit(MakeRow(1));
+    writer.Submit(MakeRow(2));
+    writer.Submit(MakeRow(3), &last);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    assert(sink.BatchSizes().empty());
+
+    assert(last.wait_for(std::chrono::seconds(2)) == std::future_status::ready && last.get());
+    double waited_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    assert(sink.BatchSizes() == std::vector<std::size_t>({ 3 }));
+    assert(waited_ms >= 25);
+    std::cout << "3 rows written after " << waited_ms << " ms" << std::endl;
+    std::cout << "✓ Test 2 passed" << std::endl;
+}
+
+void TestFallback() {
+    std::cout << "\n=== Test 3: Failed batch retried row by row ===" << std::endl;
+    RecordingSink sink;
+    sink._fail_batches = true;
+    ChatMsgWriter::Options options;
+    options.batch_rows = 3;
+    options.flush_ms = 1000;
+    ChatMsgWriter writer(options, sink.Batch(), sink.Row());
+
+    std::future<bool> a, b, c;
+    writer.Submit(MakeRow(1), &a);
+    writer.Submit(MakeRow(2, "bad"), &b);
+    writer.Submit(MakeRow(3), &c);
+    assert(a.get() && !b.get() && c.get());
+    assert(sink.RowWrites() == 3);
+
+    ChatMsgWriter::Stats stats = writer.Snapshot();
+    assert(stats.batches == 1 && stats.fallback_batches == 1);
+    assert(stats.written == 2 && stats.failed == 1);
+    std::cout << "✓ Test 3 passed" << std::endl;
+}
+
+void TestLimitsAndStop() {
+    std::cout << "\n=== Test 4: Byte limit, queue capacity and Stop ===" << std::endl;
+    RecordingSink sink;
+    ChatMsgWriter::Options options;
+    options.batch_rows = 100;
+    options.flush_ms = 0;
+    options.batch_bytes = 10;
+    options.capacity = 3;
+    ChatMsgWriter writer(options, sink.Batch(), sink.Row());
+
+    // 第一批卡在写入中，之后的消息只能排队
+    sink.Close();
+    std::future<bool> first;
+    assert(writer.Submit(MakeRow(0, "123456"), &first));
+    sink.WaitStarted();
+
+    std::vector<std::future<bool>> dones(3);
+    for (int i = 0; i < 3; ++i) {
+        assert(writer.Submit(MakeRow(i + 1, "123456"), &dones[i]));
+    }
+    std::future<bool> rejected;
+    assert(!writer.Submit(MakeRow(4, "123456"), &rejected));
+    assert(!rejected.valid());
+    assert(writer.Snapshot().rejected == 1 && writer.Snapshot().pending == 3);
+
+    // 放行后 Stop 写完排队的消息；每条 6 字节、上限 10 字节，每批一条
+    sink.Open();
+    writer.Stop();
+    assert(first.get());
+    for (auto& done : dones) {
+        assert(done.get());
+    }
+    assert(sink.BatchSizes() == std::vector<std::size_t>({ 1, 1, 1, 1 }));
+    assert(!writer.Submit(MakeRow(5)));
+    std::cout << "✓ Test 4 passed" << std::endl;
+}
+
+#ifdef WITH_MYSQL
+// 与 MysqlDao::SaveChatMessage / SaveChatMessages 相同的语句（主键用自增列，不带服务端消息 ID）
+#define BENCH_INSERT_ROW "INSERT INTO messages_bench (from_uid, to_uid, payload, status, create_time) VALUES (?, ?, ?, 0, NOW())"
+
+class BenchConnPool {
+public:
+    BenchConnPool(const std::string& url, const std::string& user, const std::string& pass, const std::string& schema, int size) {
+        sql::mysql::MySQL_Driver* driver = sql::mysql::get_mysql_driver_instance();
+        for (int i = 0; i < size; ++i) {
+            std::unique_ptr<sql::Connection> con(driver->connect(url, user, pass));
+            con->setSchema(schema);
+            _idle.push_back(std::move(con));
+        }
+    }
+
+    std::unique_ptr<sql::Connection> Get() {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _cond.wait(lock, [this] { return !_idle.empty(); });
+        std::unique_ptr<sql::Connection> con = std::move(_idle.back());
+        _idle.pop_back();
+        return con;
+    }
+
+    void Put(std::unique_ptr<sql::Connection> con) {
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _idle.push_back(std::move(con));
+        }
+        _cond.notify_one();
+    }
+
+private:
+    std::mutex _mtx;
+    std::condition_variable _cond;
+    std::vector<std::unique_ptr<sql::Connection>> _idle;
+};
+
+void Execute(BenchConnPool& pool, const std::string& sql) {
+    std::unique_ptr<sql::Connection> con = pool.Get();
+    std::unique_ptr<sql::Statement> stmt(con->createStatement());
+    stmt->execute(sql);
+    pool.Put(std::move(con));
+}
+
+long long CountRows(BenchConnPool& pool) {
+    std::unique_ptr<sql::Connection> con = pool.Get();
+    std::unique_ptr<sql::Statement> stmt(con->createStatement());
+    std::unique_ptr<sql::ResultSet> res(stmt->executeQuery("SELECT COUNT(*) AS c FROM messages_bench"));
+    long long count = res->next() ? res->getInt64("c") : -1;
+    pool.Put(std::move(con));
+    return count;
+}
+
+bool InsertRows(BenchConnPool& pool, const std::vector<ChatMsgRow>& rows) {
+    std::string sql = "INSERT INTO messages_bench (from_uid, to_uid, payload, status, create_time) VALUES ";
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        if (i) sql += ",";
+        sql += "(?, ?, ?, 0, NOW())";
+    }
+    std::unique_ptr<sql::Connection> con = pool.Get();
+    bool ok = true;
+    try {
+        std::unique_ptr<sql::PreparedStatement> pstmt(con->prepareStatement(sql));
+        unsigned int index = 1;
+        for (const auto& row : rows) {
+            pstmt->setInt(index++, row.from_uid);
+            pstmt->setInt(index++, row.to_uid);
+            pstmt->setString(index++, row.payload);
+        }
+        pstmt->execute();
+    }
+    catch (sql::SQLException& e) {
+        std::cerr << "batch insert failed: " << e.what() << std::endl;
+        ok = false;
+    }
+    pool.Put(std::move(con));
+    return ok;
+}
+
+bool InsertRow(BenchConnPool& pool, const ChatMsgRow& row) {
+    std::unique_ptr<sql::Connection> con = pool.Get();
+    bool ok = true;
+    try {
+        std::unique_ptr<sql::PreparedStatement> pstmt(con->prepareStatement(BENCH_INSERT_ROW));
+        pstmt->setInt(1, row.from_uid);
+        pstmt->setInt(2, row.to_uid);
+        pstmt->setString(3, row.payload);
+        pstmt->execute();
+    }
+    catch (sql::SQLException& e) {
+        std::cerr << "insert failed: " << e.what() << std::endl;
+        ok = false;
+    }
+    pool.Put(std::move(con));
+    return ok;
+}
+
+// 8 个生产者（模拟逻辑线程）并发提交，返回每秒写入条数
+template <typename SubmitFn, typename DrainFn>
+double RunProducers(int messages, SubmitFn submit, DrainFn drain) {
+    const int producers = 8;
+    std::string payload(200, 'x');  // 接近一条 JSON 文本消息的长度
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = p; i < messages; i += producers) {
+                while (!submit(ChatMsgRow{ i, 10000 + i % 1000, payload })) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    drain();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return messages / seconds;
+}
+
+void TestMysqlThroughput(int argc, char* argv[]) {
+    std::cout << "\n=== Test 5: MySQL ingest, per-row INSERT vs group commit ===" << std::endl;
+    if (argc < 5) {
+        std::cout << "skipped (usage: " << argv[0] << " tcp://127.0.0.1:3306 user passwd schema [messages] [db_threads])" << std::endl;
+        return;
+    }
+    int messages = argc > 5 ? std::stoi(argv[5]) : 50000;
+    int db_threads = argc > 6 ? std::stoi(argv[6]) : 8;
+
+    BenchConnPool pool(argv[1], argv[2], argv[3], argv[4], db_threads);
+    Execute(pool, "DROP TABLE IF EXISTS messages_bench");
+    Execute(pool, "CREATE TABLE messages_bench (id BIGINT AUTO_INCREMENT PRIMARY KEY, from_uid INT NOT NULL, "
+        "to_uid INT NOT NULL, payload TEXT NOT NULL, status TINYINT NOT NULL DEFAULT 0, create_time DATETIME NOT NULL, "
+        "KEY idx_to_status (to_uid, status)) ENGINE=InnoDB");
+
+    // 原实现：每条消息一个 AsyncDBPool 任务、一个 INSERT
+    double per_row;
+    {
+        TaskExecutor executor(db_threads, "bench_db");
+        per_row = RunProducers(messages,
+            [&](ChatMsgRow row) {
+                return executor.Post([&pool, row]() { InsertRow(pool, row); });
+            },
+            [&]() { executor.Stop(); });
+    }
+    assert(CountRows(pool) == messages);
+    Execute(pool, "TRUNCATE TABLE messages_bench");
+
+    double batched;
+    ChatMsgWriter::Stats stats;
+    {
+        ChatMsgWriter writer(ChatMsgWriter::Options(),
+            [&pool](const std::vector<ChatMsgRow>& rows) { return InsertRows(pool, rows); },
+            [&pool](const ChatMsgRow& row) { return InsertRow(pool, row); });
+        batched = RunProducers(messages,
+            [&](ChatMsgRow row) { return writer.Submit(std::move(row)); },
+            [&]() { writer.Stop(); });
+        stats = writer.Snapshot();
+    }
+    assert(CountRows(pool) == messages);
+    assert(stats.failed == 0);
+    Execute(pool, "DROP TABLE messages_bench");
+
+    std::cout << "per-row INSERT (" << db_threads << " threads): " << static_cast<long long>(per_row) << " msgs/s" << std::endl;
+    std::cout << "group commit:             " << static_cast<long long>(batched) << " msgs/s ("
+        << batched / per_row << "x, avg " << stats.avg_batch_rows << " rows/batch, avg "
+        << stats.avg_flush_ms << " ms/batch)" << std::endl;
+    assert(batched > per_row);
+    std::cout << "✓ Test 5 passed" << std::endl;
+}
+#endif
+
+int main(int argc, char* argv[]) {
+    std::cout << "========== ChatMsgWriter Tests ==========" << std::endl;
+
+    TestBatchBySize();
+    TestFlushInterval();
+    TestFallback();
+    TestLimitsAndStop();
+#ifdef WITH_MYSQL
+    TestMysqlThroughput(argc, argv);
+#else
+    (void)argc;
+    (void)argv;
+    std::cout << "\n(MySQL benchmark not built, compile with -DWITH_MYSQL -lmysqlcppconn)" << std::endl;
+#endif
+
+    std::cout << "\n========== All Tests Passed! ==========" << std::endl;
+    return 0;
+}
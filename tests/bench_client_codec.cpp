@@ -0,0 +1,226 @@
+// 客户端消息体编码基准测试：JSON 对比 protobuf
+// 1. 两种编码往返后内容一致，入库的 JSON 能转换成 protobuf 下发
+// 2. 对文本消息的请求解码 + 回包编码，统计每条消息的字节数和 CPU 耗时
+// 3. 离线消息批量帧在两种编码下都能解析出原消息，坏数据不影响同帧其他消息；收件箱游标随确认带回；出错时的结束帧
+// 4. 按 OfflineFrameEnds 切出的帧编码后不超过客户端的 4096 字节上限（游标、inbox_id 取最长），超长的单条能识别出来
+//
+// 编译（以下为同一条命令）：
+//   g++ -std=c++17 -O2 -pthread -I../ChatServer/ChatServer bench_client_codec.cpp
+//       ../ChatServer/ChatServer/ClientCodec.cpp ../ChatServer/ChatServer/message.pb.cc
+//       ../ChatServer/ChatServer/Logger.cpp -ljsoncpp -lprotobuf -o bench_client_codec
+// 运行：./bench_client_codec [iterations] [content_bytes]
+
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "ClientCodec.h"
+#include "OfflineSync.h"
+
+message::TextChatMsgReq MakeTextChat(std::size_t content_bytes) {
+    message::TextChatMsgReq req;
+    req.set_fromuid(1001);
+    req.set_touid(1002);
+    auto* msg = req.add_textmsgs();
+    msg->set_msgid("1760659200123");
+    msg->set_msgcontent(std::string(content_bytes, 'a'));
+    return req;
+}
+
+// 客户端发出的请求：protobuf 为 TextChatMsgReq，JSON 与 ChatClient 发出的一致（没有 error 字段）
+std::string EncodeRequest(WireCodec codec, const message::TextChatMsgReq& req) {
+    if (codec == WireCodec::Protobuf) {
+        return req.SerializeAsString();
+    }
+    Json::Value root;
+    root["fromuid"] = req.fromuid();
+    root["touid"] = req.touid();
+    for (const auto& msg : req.textmsgs()) {
+        Json::Value element;
+        element["content"] = msg.msgcontent();
+        element["msgid"] = msg.msgid();
+        root["text_array"].append(element);
+    }
+    return root.toStyledString();
+}
+
+void TestRoundTrip() {
+    std::cout << "\n=== Test 1: Round trip in both codecs ===" << std::endl;
+    message::TextChatMsgReq req = MakeTextChat(16);
+
+    for (WireCodec codec : { WireCodec::Json, WireCodec::Protobuf }) {
+        message::TextChatMsgReq decoded;
+        assert(ClientCodec::DecodeTextChatMsg(codec, EncodeRequest(codec, req), decoded));
+        assert(decoded.fromuid() == 1001 && decoded.touid() == 1002);
+        assert(decoded.textmsgs_size() == 1);
+        assert(decoded.textmsgs(0).msgid() == req.textmsgs(0).msgid());
+        assert(decoded.textmsgs(0).msgcontent() == req.textmsgs(0).msgcontent());
+    }
+
+    // 入库的 JSON 转成 protobuf 下发，错误码和内容保持不变
+    std::string stored = ClientCodec::EncodeTextChatMsg(WireCodec::Json, ErrorCodes::Success, req);
+    std::string converted;
+    assert(ClientCodec::ConvertStoredTextChat(WireCodec::Protobuf, stored, converted));
+    message::TextChatMsgRsp rsp;
+    assert(rsp.ParseFromString(converted));
+    assert(rsp.error() == ErrorCodes::Success && rsp.textmsgs(0).msgcontent() == req.textmsgs(0).msgcontent());
+    assert(!ClientCodec::ConvertStoredTextChat(WireCodec::Protobuf, "not json", converted));
+
+    // 协商
+    WireCodec codec = WireCodec::Json;
+    assert(ClientCodec::ParseCodecName("protobuf", codec) && codec == WireCodec::Protobuf);
+    assert(!ClientCodec::ParseCodecName("msgpack", codec) && codec == WireCodec::Protobuf);
+    std::cout << "✓ Test 1 passed" << std::endl;
+}
+
+struct CodecResult {
+    std::size_t request_bytes;
+    std::size_t response_bytes;
+    double ns_per_msg;
+};
+
+// 每条消息：解码请求 + 编码回包，与 DealChatTextMsg 对一条消息做的编解码一致
+CodecResult RunCodec(WireCodec codec, const message::TextChatMsgReq& req, int iterations) {
+    std::string request = EncodeRequest(codec, req);
+    std::size_t response_bytes = 0;
+    std::size_t checksum = 0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        message::TextChatMsgReq decoded;
+        ClientCodec::DecodeTextChatMsg(codec, request, decoded);
+        std::string response = ClientCodec::EncodeTextChatMsg(codec, ErrorCodes::Success, decoded);
+        response_bytes = response.size();
+        checksum += response.size();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    assert(checksum == response_bytes * iterations);
+
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return { request.size(), response_bytes, ns / iterations };
+}
+
+void TestThroughput(int iterations, std::size_t content_bytes) {
+    std::cout << "\n=== Test 2: Bytes and CPU per message (content=" << content_bytes << " bytes) ===" << std::endl;
+    message::TextChatMsgReq req = MakeTextChat(content_bytes);
+
+    CodecResult json = RunCodec(WireCodec::Json, req, iterations);
+    CodecResult pb = RunCodec(WireCodec::Protobuf, req, iterations);
+
+    std::cout << "json:     request=" << json.request_bytes << " B response=" << json.response_bytes
+              << " B cpu=" << json.ns_per_msg << " ns/msg" << std::endl;
+    std::cout << "protobuf: request=" << pb.request_bytes << " B response=" << pb.response_bytes
+              << " B cpu=" << pb.ns_per_msg << " ns/msg" << std::endl;
+    std::cout << "bytes saved=" << 100.0 * (1.0 - static_cast<double>(pb.response_bytes) / json.response_bytes)
+              << "% speedup=" << json.ns_per_msg / pb.ns_per_msg << "x" << std::endl;
+
+    assert(pb.request_bytes < json.request_bytes);
+    assert(pb.response_bytes < json.response_bytes);
+    std::cout << "✓ Test 2 passed" << std::endl;
+}
+
+void TestOfflineBatch() {
+    std::cout << "\n=== Test 3: Offline message batch frame ===" << std::endl;
+    std::vector<std::string> stored;
+    for (int i = 0; i < 5; ++i) {
+        message::TextChatMsgReq req = MakeTextChat(8);
+        req.set_fromuid(2000 + i);
+        stored.push_back(ClientCodec::EncodeTextChatMsg(WireCodec::Json, ErrorCodes::Success, req));
+    }
+    stored[2] = "not json";
+
+    // JSON：取 [1, 2)，入库的 JSON 原样拼接
+    std::string json = ClientCodec::EncodeOfflineMsgBatch(WireCodec::Json, stored, 1, 2, 42, true);
+    Json::Value root;
+    Json::Reader reader;
+    assert(reader.parse(json, root));
+    assert(root["error"].asInt() == ErrorCodes::Success && root["last_id"].asInt64() == 42 && root["more"].asBool());
+    assert(root["msgs"].size() == 1 && root["msgs"][0]["fromuid"].asInt() == 2001);
+
+    // protobuf：坏数据跳过，其余顺序不变
+    std::string pb = ClientCodec::EncodeOfflineMsgBatch(WireCodec::Protobuf, stored, 1, 5, 1LL << 40, false);
+    message::OfflineMsgBatch batch;
+    assert(batch.ParseFromString(pb));
+    assert(batch.last_id() == (1LL << 40) && !batch.more());
+    assert(batch.msgs_size() == 3);
+    assert(batch.msgs(0).fromuid() == 2001 && batch.msgs(1).fromuid() == 2003 && batch.msgs(2).fromuid() == 2004);
+    assert(batch.msgs(0).textmsgs(0).msgcontent() == std::string(8, 'a'));
+
+    // 收件箱帧带 inbox_id，确认时原样带回
+    std::string inbox = ClientCodec::EncodeOfflineMsgBatch(WireCodec::Json, stored, 0, 1, 0, true, "1760659200123-7");
+    assert(reader.parse(inbox, root) && root["inbox_id"].asString() == "1760659200123-7");
+    int uid = 0;
+    long long max_msg_id = -1;
+    std::string inbox_id;
+    assert(ClientCodec::DecodeOfflineMsgAck(WireCodec::Json, "{\"uid\":1002,\"max_msg_id\":0,\"inbox_id\":\"1760659200123-7\"}",
+        uid, max_msg_id, inbox_id));
+    assert(uid == 1002 && max_msg_id == 0 && inbox_id == "1760659200123-7");
+    assert(ClientCodec::DecodeOfflineMsgAck(WireCodec::Json, "{\"uid\":1002,\"max_msg_id\":42}", uid, max_msg_id, inbox_id));
+    assert(max_msg_id == 42 && inbox_id.empty());
+
+    // 空帧（没有未读消息）
+    assert(reader.parse(ClientCodec::EncodeOfflineMsgBatch(WireCodec::Json, stored, 0, 0, 0, false), root));
+    assert(root["msgs"].isArray() && root["msgs"].empty() && !root["more"].asBool());
+
+    // 出错的结束帧
+    assert(reader.parse(ClientCodec::EncodeOfflineMsgError(WireCodec::Json, ErrorCodes::MsgTooLarge), root));
+    assert(root["error"].asInt() == ErrorCodes::MsgTooLarge && root["msgs"].empty() && !root["more"].asBool());
+    message::OfflineMsgBatch err_batch;
+    assert(err_batch.ParseFromString(ClientCodec::EncodeOfflineMsgError(WireCodec::Protobuf, ErrorCodes::RPCFailed)));
+    assert(err_batch.error() == ErrorCodes::RPCFailed && err_batch.msgs_size() == 0 && !err_batch.more());
+    std::cout << "✓ Test 3 passed" << std::endl;
+}
+
+void TestOfflineFrameSize() {
+    std::cout << "\n=== Test 4: Offline frame fits client buffer ===" << std::endl;
+    // 长短交错，让每帧都尽量贴近上限；中文内容入库时会被转义，JSON 比原文长
+    std::vector<std::string> stored;
+    for (int i = 0; i < 300; ++i) {
+        message::TextChatMsgReq req = MakeTextChat(static_cast<std::size_t>((i * 397) % 1500));
+        if (i % 3 == 0) {
+            req.mutable_textmsgs(0)->set_msgcontent(std::string(150, 'a') + "\xe4\xbd\xa0\xe5\xa5\xbd");
+        }
+        req.set_msg_id((1LL << 53) - 1);
+        stored.push_back(ClientCodec::EncodeTextChatMsg(WireCodec::Json, ErrorCodes::Success, req));
+    }
+    // 单条就超过一帧：发送时拒绝，离线下发截到它之前
+    stored.push_back(ClientCodec::EncodeTextChatMsg(WireCodec::Json, ErrorCodes::Success, MakeTextChat(OFFLINE_FRAME_MAX_BYTES)));
+    assert(!OfflinePayloadFits(stored.back()) && FirstOversizedOffline(stored) == stored.size() - 1);
+    stored.pop_back();
+
+    const long long last_id = 9223372036854775807LL;
+    const std::string inbox_id = "18446744073709551615-18446744073709551615";
+    std::size_t frames = 0;
+    std::size_t largest = 0;
+    std::size_t begin = 0;
+    for (std::size_t end : OfflineFrameEnds(stored)) {
+        for (WireCodec codec : { WireCodec::Json, WireCodec::Protobuf }) {
+            std::string frame = ClientCodec::EncodeOfflineMsgBatch(codec, stored, begin, end, last_id, true, inbox_id);
+            assert(frame.size() <= OFFLINE_FRAME_MAX_BYTES);
+            largest = std::max(largest, frame.size());
+        }
+        ++frames;
+        begin = end;
+    }
+    assert(begin == stored.size());
+    std::cout << "frames=" << frames << " largest=" << largest << " bytes (limit " << OFFLINE_FRAME_MAX_BYTES << ")" << std::endl;
+    std::cout << "✓ Test 4 passed" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int iterations = argc > 1 ? std::stoi(argv[1]) : 200000;
+    std::size_t content_bytes = argc > 2 ? std::stoul(argv[2]) : 32;
+
+    std::cout << "========== ClientCodec Benchmark ==========" << std::endl;
+
+    TestRoundTrip();
+    TestThroughput(iterations, content_bytes);
+    TestOfflineBatch();
+    TestOfflineFrameSize();
+
+    std::cout << "\n========== All Tests Passed! ==========" << std::endl;
+    return 0;
+}
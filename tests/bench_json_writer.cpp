@@ -0,0 +1,138 @@
+// JSON 序列化基准测试：toStyledString 对比 StreamWriterBuilder（无缩进）和 ToCompactJson
+// 1. ToCompactJson 的输出能被解析回与原 Value 相等的结果（含转义、中文、嵌套数组）
+// 2. 登录回包、文本消息回包两种形状下，每次序列化的字节数和耗时
+//
+// 编译：g++ -std=c++17 -O2 -I../ChatServer/ChatServer bench_json_writer.cpp -ljsoncpp -o bench_json_writer
+// 运行：./bench_json_writer [iterations]
+
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "JsonUtil.h"
+
+// 与 LogicSystem::LoginTokenChecked 的回包字段一致
+Json::Value MakeLoginRsp() {
+    Json::Value rtvalue;
+    rtvalue["error"] = 0;
+    rtvalue["uid"] = 1001;
+    rtvalue["pwd"] = "5f4dcc3b5aa765d61d8327deb882cf99";
+    rtvalue["name"] = "kirito";
+    rtvalue["email"] = "kirito@example.com";
+    rtvalue["nick"] = "桐人";
+    rtvalue["desc"] = "hello world";
+    rtvalue["sex"] = 1;
+    rtvalue["icon"] = ":/res/head_1.jpg";
+    return rtvalue;
+}
+
+// 与 DealChatTextMsg 的回包 / 通知一致
+Json::Value MakeTextChatRsp(int messages) {
+    Json::Value rtvalue;
+    rtvalue["error"] = 0;
+    rtvalue["fromuid"] = 1001;
+    rtvalue["touid"] = 1002;
+    for (int i = 0; i < messages; ++i) {
+        Json::Value element;
+        element["content"] = "今天晚上一起吃饭吗？ see you at 7pm";
+        element["msgid"] = std::to_string(1760659200123LL + i);
+        rtvalue["text_array"].append(element);
+    }
+    return rtvalue;
+}
+
+void TestRoundTrip() {
+    std::cout << "\n=== Test 1: Compact output parses back to the same value ===" << std::endl;
+    Json::Value value = MakeTextChatRsp(2);
+    value["quote"] = "a \"b\" \\c\n\t\x01";
+    value["empty_array"] = Json::Value(Json::arrayValue);
+    value["empty_object"] = Json::Value(Json::objectValue);
+    value["nested"]["flag"] = true;
+    value["nested"]["none"] = Json::Value();
+    value["nested"]["neg"] = -42;
+    value["nested"]["big"] = Json::UInt64(18446744073709551615ULL);
+    value["nested"]["pi"] = 3.14159;
+
+    std::string compact = ToCompactJson(value);
+    assert(compact.find('\n') == std::string::npos);
+    assert(compact.find("\\u0001") != std::string::npos);
+    assert(compact.find("今天晚上") != std::string::npos);
+
+    Json::Reader reader;
+    Json::Value parsed;
+    assert(reader.parse(compact, parsed));
+    assert(parsed == value);
+
+    // 与原来的 toStyledString 输出解析结果相同
+    Json::Value styled;
+    assert(reader.parse(value.toStyledString(), styled));
+    assert(styled == parsed);
+
+    assert(ToCompactJson(Json::Value(Json::objectValue)) == "{}");
+    assert(ToCompactJson(MakeTextChatRsp(0)) == "{\"error\":0,\"fromuid\":1001,\"touid\":1002}");
+    std::cout << "✓ Test 1 passed" << std::endl;
+}
+
+struct WriterResult {
+    std::size_t bytes;
+    double ns_per_op;
+};
+
+WriterResult Run(const std::function<std::string(const Json::Value&)>& write, const Json::Value& value, int iterations) {
+    std::size_t bytes = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        bytes = write(value).size();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return { bytes, std::chrono::duration<double, std::nano>(end - start).count() / iterations };
+}
+
+void Compare(const std::string& name, const Json::Value& value, int iterations) {
+    Json::StreamWriterBuilder builder;
+    builder["indentation"] = "";
+    builder["emitUTF8"] = true;
+    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+
+    WriterResult styled = Run([](const Json::Value& v) { return v.toStyledString(); }, value, iterations);
+    WriterResult stream = Run([&](const Json::Value& v) {
+        std::ostringstream oss;
+        writer->write(v, &oss);
+        return oss.str();
+        }, value, iterations);
+    WriterResult compact = Run([](const Json::Value& v) { return ToCompactJson(v); }, value, iterations);
+
+    std::cout << name << std::endl;
+    std::cout << "  toStyledString:      " << styled.bytes << " B " << styled.ns_per_op << " ns" << std::endl;
+    std::cout << "  StreamWriterBuilder: " << stream.bytes << " B " << stream.ns_per_op << " ns" << std::endl;
+    std::cout << "  ToCompactJson:       " << compact.bytes << " B " << compact.ns_per_op << " ns"
+              << " (size -" << 100.0 * (1.0 - static_cast<double>(compact.bytes) / styled.bytes) << "%, "
+              << styled.ns_per_op / compact.ns_per_op << "x faster)" << std::endl;
+
+    assert(compact.bytes < styled.bytes);
+    assert(compact.ns_per_op < styled.ns_per_op);
+}
+
+void TestThroughput(int iterations) {
+    std::cout << "\n=== Test 2: Bytes and time per serialization ===" << std::endl;
+    Compare("login rsp", MakeLoginRsp(), iterations);
+    Compare("text chat rsp (1 msg)", MakeTextChatRsp(1), iterations);
+    Compare("text chat rsp (10 msgs)", MakeTextChatRsp(10), iterations);
+    std::cout << "✓ Test 2 passed" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int iterations = argc > 1 ? std::stoi(argv[1]) : 200000;
+
+    std::cout << "========== JSON Writer Benchmark ==========" << std::endl;
+
+    TestRoundTrip();
+    TestThroughput(iterations);
+
+    std::cout << "\n========== All Tests Passed! ==========" << std::endl;
+    return 0;
+}
@@ -0,0 +1,112 @@
+// LogicSystem 多工作线程分发基准测试
+// 对比 1/2/4/8/16 个 LogicWorker 时的消息吞吐（msgs/sec），并校验同一会话内的消息顺序
+//
+// 编译（以下为同一条命令）：
+//   g++ -std=c++17 -O2 -pthread -I../ChatServer/ChatServer bench_logic_dispatch.cpp
+//       ../ChatServer/ChatServer/Logger.cpp -o bench_logic_dispatch
+// 运行：./bench_logic_dispatch [sessions] [msgs_per_session] [handler_us]
+//   handler_us 模拟处理函数中一次阻塞的 Redis/gRPC 往返耗时（微秒）
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <atomic>
+#include <thread>
+
+#include "LogicWorker.h"
+
+// 模拟 LogicNode：只保留分发需要的会话 ID 和会话内序号
+struct MockNode {
+    int session;
+    int seq;
+};
+
+struct BenchResult {
+    double msgs_per_sec;
+    double elapsed_ms;
+};
+
+BenchResult RunDispatch(size_t worker_count, int sessions, int msgs_per_session, int handler_us) {
+    // 每个会话只会被一个工作线程访问，不需要加锁
+    std::vector<int> last_seq(sessions, -1);
+    std::atomic<int> done(0);
+    std::atomic<bool> order_ok(true);
+    const int total = sessions * msgs_per_session;
+
+    std::vector<std::unique_ptr<LogicWorker<MockNode>>> workers;
+    for (size_t i = 0; i < worker_count; ++i) {
+        workers.emplace_back(new LogicWorker<MockNode>([&](MockNode& node) {
+            if (node.seq != last_seq[node.session] + 1) {
+                order_ok = false;
+            }
+            last_seq[node.session] = node.seq;
+            if (handler_us > 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(handler_us));
+            }
+            done.fetch_add(1, std::memory_order_relaxed);
+        }));
+    }
+
+    // 与 LogicSystem::PostMsgToQue 一致：按会话 ID 哈希选择工作线程
+    std::vector<std::string> session_ids;
+    for (int s = 0; s < sessions; ++s) {
+        session_ids.push_back("session-" + std::to_string(s));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < msgs_per_session; ++m) {
+        for (int s = 0; s < sessions; ++s) {
+            size_t idx = std::hash<std::string>()(session_ids[s]) % workers.size();
+            workers[idx]->Post(MockNode{ s, m });
+        }
+    }
+    while (done.load(std::memory_order_relaxed) < total) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    for (auto& worker : workers) {
+        worker->Stop();
+    }
+
+    assert(order_ok);
+    for (int s = 0; s < sessions; ++s) {
+        assert(last_seq[s] == msgs_per_session - 1);
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    return BenchResult{ total / (ms / 1000.0), ms };
+}
+
+int main(int argc, char* argv[]) {
+    int sessions = argc > 1 ? std::atoi(argv[1]) : 256;
+    int msgs_per_session = argc > 2 ? std::atoi(argv[2]) : 40;
+    int handler_us = argc > 3 ? std::atoi(argv[3]) : 50;
+
+    std::cout << "========== LogicSystem Dispatch Benchmark ==========" << std::endl;
+    std::cout << "sessions=" << sessions << " msgs/session=" << msgs_per_session
+              << " handler=" << handler_us << "us" << std::endl;
+
+    double baseline = 0;
+    for (size_t workers : { 1, 2, 4, 8, 16 }) {
+        BenchResult r = RunDispatch(workers, sessions, msgs_per_session, handler_us);
+        if (workers == 1) {
+            baseline = r.msgs_per_sec;
+        }
+        std::cout << "workers=" << workers
+                  << "  elapsed=" << r.elapsed_ms << " ms"
+                  << "  throughput=" << static_cast<long long>(r.msgs_per_sec) << " msgs/sec"
+                  << "  speedup=" << r.msgs_per_sec / baseline << "x" << std::endl;
+    }
+
+    // 纯分发开销：处理函数不阻塞
+    BenchResult raw = RunDispatch(4, sessions, msgs_per_session * 50, 0);
+    std::cout << "dispatch only (4 workers, no-op handler): "
+              << static_cast<long long>(raw.msgs_per_sec) << " msgs/sec" << std::endl;
+
+    std::cout << "\n========== Per-session order preserved ==========" << std::endl;
+    return 0;
+}
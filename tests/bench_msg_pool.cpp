@@ -0,0 +1,152 @@
+// MsgPool 内存池测试
+// 1. 验证稳态下（预热之后）跨线程分配/释放不再向系统申请内存（mallocs 不增长）
+// 2. 对比 MsgPool 与 new[]/delete[] 的分配吞吐
+//
+// 编译：g++ -std=c++17 -O2 -pthread -I../ChatServer/ChatServer bench_msg_pool.cpp -o bench_msg_pool
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <cstring>
+
+#include "MsgPool.h"
+
+// 模拟聊天热路径：逻辑线程分配发送缓冲区，IO 线程写完后释放
+struct Handoff {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::pair<char*, size_t>> queue;
+    bool done = false;
+};
+
+template <typename AllocFn, typename FreeFn>
+double RunCrossThread(int rounds, int burst, AllocFn alloc, FreeFn release) {
+    Handoff handoff;
+    std::thread consumer([&]() {
+        for (;;) {
+            std::unique_lock<std::mutex> lock(handoff.mutex);
+            handoff.cv.wait(lock, [&] { return handoff.done || !handoff.queue.empty(); });
+            if (handoff.queue.empty() && handoff.done) {
+                break;
+            }
+            auto item = handoff.queue.front();
+            handoff.queue.pop_front();
+            bool drained = handoff.queue.empty();
+            lock.unlock();
+            release(item.first, item.second);
+            if (drained) {
+                handoff.cv.notify_all();
+            }
+        }
+    });
+
+    // 模拟登录回包、聊天消息、离线批量消息等不同大小
+    const size_t sizes[] = { 40, 180, 700, 1500, 2052 };
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        for (int i = 0; i < burst; ++i) {
+            size_t size = sizes[i % 5];
+            char* data = alloc(size);
+            data[0] = static_cast<char>(i);
+            data[size - 1] = '\0';
+            {
+                std::lock_guard<std::mutex> lock(handoff.mutex);
+                handoff.queue.emplace_back(data, size);
+            }
+            handoff.cv.notify_one();
+        }
+        // 等待本轮写完再开始下一轮，积压上限与 MAX_SENDQUE 流控类似
+        std::unique_lock<std::mutex> lock(handoff.mutex);
+        handoff.cv.wait(lock, [&] { return handoff.queue.empty(); });
+    }
+    {
+        std::lock_guard<std::mutex> lock(handoff.mutex);
+        handoff.done = true;
+    }
+    handoff.cv.notify_one();
+    consumer.join();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+char* PoolAlloc(size_t size) {
+    return static_cast<char*>(MsgPool::Allocate(size));
+}
+
+void PoolFree(char* p, size_t size) {
+    MsgPool::Deallocate(p, size);
+}
+
+char* HeapAlloc(size_t size) {
+    return new char[size]();
+}
+
+void HeapFree(char* p, size_t) {
+    delete[] p;
+}
+
+void TestSizeClasses() {
+    std::cout << "\n=== Test 1: Size classes ===" << std::endl;
+    assert(MsgPool::ClassOf(1) == 0);
+    assert(MsgPool::ClassOf(64) == 0);
+    assert(MsgPool::ClassOf(65) == 1);
+    assert(MsgPool::ClassOf(2052) == 4);
+    assert(MsgPool::ClassOf(16384) == 5);
+    assert(MsgPool::ClassOf(16385) == -1);
+
+    // 超过最大级别的请求直接走系统分配
+    MsgPool::Stats before = MsgPool::GetStats();
+    void* big = MsgPool::Allocate(64 * 1024);
+    MsgPool::Deallocate(big, 64 * 1024);
+    MsgPool::Stats after = MsgPool::GetStats();
+    assert(after.mallocs == before.mallocs + 1);
+    assert(after.frees == before.frees + 1);
+    std::cout << "✓ Test 1 passed" << std::endl;
+}
+
+void TestSteadyStateNoMalloc() {
+    std::cout << "\n=== Test 2: Zero steady-state mallocs ===" << std::endl;
+
+    // 预热：让线程本地缓存和中心链表里积累足够的块
+    RunCrossThread(20, 2000, PoolAlloc, PoolFree);
+    MsgPool::Stats warm = MsgPool::GetStats();
+    std::cout << "after warmup: pool_hits=" << warm.pool_hits << " mallocs=" << warm.mallocs
+              << " frees=" << warm.frees << std::endl;
+
+    RunCrossThread(200, 2000, PoolAlloc, PoolFree);
+    MsgPool::Stats steady = MsgPool::GetStats();
+    std::cout << "after steady: pool_hits=" << steady.pool_hits << " mallocs=" << steady.mallocs
+              << " frees=" << steady.frees << std::endl;
+
+    std::cout << "steady-state mallocs: " << steady.mallocs - warm.mallocs << std::endl;
+    assert(steady.mallocs == warm.mallocs);
+    std::cout << "✓ Test 2 passed" << std::endl;
+}
+
+void TestThroughput() {
+    std::cout << "\n=== Test 3: Throughput (cross-thread alloc/free) ===" << std::endl;
+    const int rounds = 200;
+    const int burst = 2000;
+    double heap_ms = RunCrossThread(rounds, burst, HeapAlloc, HeapFree);
+    double pool_ms = RunCrossThread(rounds, burst, PoolAlloc, PoolFree);
+    double total = static_cast<double>(rounds) * burst;
+    std::cout << "new[]/delete[]: " << heap_ms << " ms (" << static_cast<long long>(total / heap_ms * 1000) << " ops/sec)" << std::endl;
+    std::cout << "MsgPool:        " << pool_ms << " ms (" << static_cast<long long>(total / pool_ms * 1000) << " ops/sec)" << std::endl;
+    std::cout << "✓ Test 3 passed" << std::endl;
+}
+
+int main() {
+    std::cout << "========== MsgPool Tests ==========" << std::endl;
+
+    TestSizeClasses();
+    TestSteadyStateNoMalloc();
+    TestThroughput();
+
+    std::cout << "\n========== All Tests Passed! ==========" << std::endl;
+    return 0;
+}
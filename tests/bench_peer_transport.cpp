@@ -0,0 +1,341 @@
+// 跨服文本消息通道基准：单次调用（ChatPeerLink，NotifyTextChatMsg 合批）对比长连接（ChatPeerStream，PeerStream 双向流）
+// 两个本机进程：接收方进程跑 ChatService（按 ChatServiceImpl 的协议回包和确认，不下发到用户会话），
+// 发送方进程用真实的 ChatGrpcClient，[PeerServer] Transport 分别为 unary / stream
+// 1. 吞吐：连续发送，未完成的消息保持在 CHAT_PEER_MAX_PENDING 以下，统计每秒完成的消息数
+// 2. 延迟：按固定速率发送，统计入队到回调的 p50 / p99
+// 3. 长连接断开重连：发送过程中重启接收方，未确认的帧重连后重发，所有消息都回调
+// 4. 对方未升级（与 ChatServer2 相同：不认识 batch 字段，没有 PeerStream）：两种通道都退回逐条单次调用，所有消息都成功
+//
+// 编译（以下为同一条命令）：
+//   g++ -std=c++17 -O2 -pthread -I../ChatServer/ChatServer bench_peer_transport.cpp
+//       ../ChatServer/ChatServer/ChatGrpcClient.cpp ../ChatServer/ChatServer/ConfigMgr.cpp
+//       ../ChatServer/ChatServer/Logger.cpp ../ChatServer/ChatServer/message.pb.cc
+//       ../ChatServer/ChatServer/message.grpc.pb.cc
+//       -lgrpc++ -lgrpc -lgpr -lprotobuf -ljsoncpp -lboost_filesystem -labsl_synchronization -o bench_peer_transport
+// 运行：./bench_peer_transport [messages] [rate_per_sec]
+//       （在临时目录中生成 config_chat1.ini 并在其中运行，端口 50991）
+
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <grpcpp/grpcpp.h>
+#include "ChatGrpcClient.h"
+#include "Logger.h"
+
+static const char* kReceiverAddr = "127.0.0.1:50991";
+
+using Clock = std::chrono::steady_clock;
+
+// 接收方：协议与 ChatServiceImpl 相同（batch 按下标回包，PeerStream 握手 + 逐帧确认 + 按 seq 去重）
+class BenchReceiver final : public ChatService::Service {
+public:
+    Status NotifyTextChatMsg(grpc::ServerContext*, const TextChatMsgReq* request, TextChatMsgRsp* response) override {
+        response->set_error(ErrorCodes::Success);
+        if (request->batch_size() > 0) {
+            for (const auto& item : request->batch()) {
+                Deliver(item, response->add_batch());
+            }
+            return Status::OK;
+        }
+        Deliver(*request, response);
+        return Status::OK;
+    }
+
+    Status PeerStream(grpc::ServerContext*, grpc::ServerReaderWriter<PeerFrame, PeerFrame>* stream) override {
+        PeerFrame hello;
+        if (!stream->Read(&hello)) {
+            return Status::OK;
+        }
+        long long applied = 0;
+        PeerFrame reply;
+        reply.set_ack(applied);
+        stream->Write(reply);
+        PeerFrame frame;
+        while (stream->Read(&frame)) {
+            PeerFrame ack;
+            ack.set_ack(frame.seq());
+            if (frame.seq() > applied) {
+                for (const auto& msg : frame.msgs()) {
+                    Deliver(msg, ack.add_results());
+                }
+                applied = frame.seq();
+            }
+            if (!stream->Write(ack)) {
+                break;
+            }
+        }
+        return Status::OK;
+    }
+
+private:
+    static void Deliver(const TextChatMsgReq& req, TextChatMsgRsp* rsp) {
+        rsp->set_error(ErrorCodes::Success);
+        rsp->set_fromuid(req.fromuid());
+        rsp->set_touid(req.touid());
+        rsp->set_msg_id(req.msg_id());
+    }
+};
+
+// 未升级的接收方：与 ChatServer2 的 NotifyTextChatMsg 相同，只看单条字段（batch 请求的 touid 为 0，按离线回包），
+// 不实现 PeerStream（UNIMPLEMENTED）
+class LegacyReceiver final : public ChatService::Service {
+public:
+    Status NotifyTextChatMsg(grpc::ServerContext*, const TextChatMsgReq* request, TextChatMsgRsp* response) override {
+        response->set_error(request->touid() == 0 ? ErrorCodes::RecipientOffline : ErrorCodes::Success);
+        response->set_fromuid(request->fromuid());
+        response->set_touid(request->touid());
+        return Status::OK;
+    }
+};
+
+[[noreturn]] void RunReceiver(bool legacy) {
+    BenchReceiver service;
+    LegacyReceiver legacy_service;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(kReceiverAddr, grpc::InsecureServerCredentials());
+    if (legacy) {
+        builder.RegisterService(&legacy_service);
+    }
+    else {
+        builder.RegisterService(&service);
+    }
+    std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+    if (!server) {
+        std::cerr << "receiver: listen failed on " << kReceiverAddr << std::endl;
+        _exit(1);
+    }
+    server->Wait();
+    _exit(0);
+}
+
+pid_t StartReceiver(bool legacy = false) {
+    pid_t pid = fork();
+    if (pid == 0) {
+        RunReceiver(legacy);
+    }
+    // 等接收方监听（发送方 wait_for_ready，这里只是让首个结果不含启动时间）
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    return pid;
+}
+
+void StopReceiver(pid_t pid) {
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+}
+
+void WriteConfig(const std::string& transport) {
+    std::ofstream out("config_chat1.ini");
+    out << "[SelfServer]\nName = chatserver1\n"
+        << "[PeerServer]\nServers = chatserver2\nTransport = " << transport << "\n"
+        << "[ChatServer2]\nName = chatserver2\nHost = 127.0.0.1\nRPCPort = 50991\n";
+}
+
+TextChatMsgReq MakeMsg(long long id) {
+    TextChatMsgReq req;
+    req.set_fromuid(1001);
+    req.set_touid(2000 + static_cast<int>(id % 1000));
+    req.set_msg_id(id);
+    TextChatData* data = req.add_textmsgs();
+    data->set_msgid("client-" + std::to_string(id));
+    data->set_msgcontent(std::string(64, 'x'));
+    return req;
+}
+
+struct LoadResult {
+    double msgs_per_sec = 0;
+    double p50_us = 0;
+    double p99_us = 0;
+    long long failed = 0;
+};
+
+// 连续发送 n 条，未完成的不超过 window 条
+LoadResult Throughput(ChatGrpcClient* client, long long n, long long window) {
+    std::atomic<long long> done{ 0 };
+    std::atomic<long long> failed{ 0 };
+    auto start = Clock::now();
+    for (long long i = 0; i < n; ++i) {
+        while (i - done.load(std::memory_order_acquire) >= window) {
+            std::this_thread::yield();
+        }
+        client->NotifyTextChatMsgAsync("chatserver2", MakeMsg(i + 1), [&done, &failed](const TextChatMsgRsp& rsp) {
+            if (rsp.error() != ErrorCodes::Success) {
+                failed.fetch_add(1, std::memory_order_relaxed);
+            }
+            done.fetch_add(1, std::memory_order_release);
+        });
+    }
+    while (done.load(std::memory_order_acquire) < n) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    double sec = std::chrono::duration<double>(Clock::now() - start).count();
+    LoadResult result;
+    result.msgs_per_sec = n / sec;
+    result.failed = failed.load();
+    return result;
+}
+
+// 按固定速率发送 n 条，统计入队到回调的延迟
+LoadResult Latency(ChatGrpcClient* client, long long n, long long rate) {
+    std::vector<Clock::time_point> sent(n);
+    std::vector<double> lat_us(n, 0);
+    std::atomic<long long> done{ 0 };
+    std::atomic<long long> failed{ 0 };
+    auto interval = std::chrono::nanoseconds(1000000000LL / rate);
+    auto start = Clock::now();
+    for (long long i = 0; i < n; ++i) {
+        auto due = start + interval * i;
+        while (Clock::now() < due) {
+            std::this_thread::yield();
+        }
+        sent[i] = Clock::now();
+        client->NotifyTextChatMsgAsync("chatserver2", MakeMsg(i + 1),
+            [i, &sent, &lat_us, &done, &failed](const TextChatMsgRsp& rsp) {
+                lat_us[i] = std::chrono::duration<double, std::micro>(Clock::now() - sent[i]).count();
+                if (rsp.error() != ErrorCodes::Success) {
+                    failed.fetch_add(1, std::memory_order_relaxed);
+                }
+                done.fetch_add(1, std::memory_order_release);
+            });
+    }
+    while (done.load(std::memory_order_acquire) < n) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    std::sort(lat_us.begin(), lat_us.end());
+    LoadResult result;
+    result.p50_us = lat_us[n / 2];
+    result.p99_us = lat_us[std::min<long long>(n - 1, n * 99 / 100)];
+    result.failed = failed.load();
+    return result;
+}
+
+// 发送方进程：配置已写好，ChatGrpcClient 按 Transport 建立通道
+[[noreturn]] void RunSender(const std::string& transport, long long messages, long long rate) {
+    Logger::Inst().SetLevel(LogLevel::Error);
+    ChatGrpcClient* client = ChatGrpcClient::GetInstance().get();
+    Throughput(client, 1000, 1000);  // 预热：建立连接
+
+    LoadResult tp = Throughput(client, messages, CHAT_PEER_MAX_PENDING / 2);
+    LoadResult lat = Latency(client, std::min<long long>(messages, rate * 2), rate);
+    std::cout << transport << ": throughput=" << static_cast<long long>(tp.msgs_per_sec) << " msg/s"
+              << " | @" << rate << " msg/s p50=" << lat.p50_us << "us p99=" << lat.p99_us << "us"
+              << " | failed=" << tp.failed + lat.failed << std::endl;
+    assert(tp.failed == 0 && lat.failed == 0);
+    std::cout.flush();
+    _exit(0);
+}
+
+// 长连接续传：按固定速率发送，期间父进程重启接收方，所有消息最终都成功回调
+[[noreturn]] void RunResumeCheck(long long n, long long rate) {
+    Logger::Inst().SetLevel(LogLevel::Error);
+    ChatGrpcClient* client = ChatGrpcClient::GetInstance().get();
+    std::atomic<long long> done{ 0 };
+    std::atomic<long long> failed{ 0 };
+    auto interval = std::chrono::nanoseconds(1000000000LL / rate);
+    auto start = Clock::now();
+    for (long long i = 0; i < n; ++i) {
+        auto due = start + interval * i;
+        while (Clock::now() < due) {
+            std::this_thread::yield();
+        }
+        client->NotifyTextChatMsgAsync("chatserver2", MakeMsg(i + 1), [&done, &failed](const TextChatMsgRsp& rsp) {
+            if (rsp.error() != ErrorCodes::Success) {
+                failed.fetch_add(1, std::memory_order_relaxed);
+            }
+            done.fetch_add(1, std::memory_order_release);
+        });
+    }
+    auto deadline = Clock::now() + std::chrono::seconds(20);
+    while (done.load() < n && Clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::cout << "resume: callbacks=" << done.load() << "/" << n << " failed=" << failed.load() << std::endl;
+    _exit(done.load() == n && failed.load() == 0 ? 0 : 1);
+}
+
+// 对方未升级：连续发送 n 条（排队中会合批，首个批量请求发现对方不支持后逐条重发），全部成功回调
+[[noreturn]] void RunLegacyCheck(const std::string& transport, long long n) {
+    Logger::Inst().SetLevel(LogLevel::Error);
+    ChatGrpcClient* client = ChatGrpcClient::GetInstance().get();
+    LoadResult tp = Throughput(client, n, n);
+    std::cout << transport << " -> legacy peer: throughput=" << static_cast<long long>(tp.msgs_per_sec) << " msg/s"
+              << " | failed=" << tp.failed << std::endl;
+    std::cout.flush();
+    _exit(tp.failed == 0 ? 0 : 1);
+}
+
+int WaitChild(pid_t pid) {
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+int main(int argc, char* argv[]) {
+    long long messages = argc > 1 ? std::atoll(argv[1]) : 200000;
+    long long rate = argc > 2 ? std::atoll(argv[2]) : 20000;
+
+    // ConfigMgr 从当前目录读 config_chat1.ini，在临时目录中运行，不覆盖源码目录中的配置
+    char dir[] = "/tmp/bench_peer_transport_XXXXXX";
+    if (mkdtemp(dir) == nullptr || chdir(dir) != 0) {
+        std::cerr << "cannot create work dir" << std::endl;
+        return 1;
+    }
+
+    std::cout << "========== Cross-server Transport Benchmark ==========" << std::endl;
+    std::cout << "messages=" << messages << " latency_rate=" << rate << " msg/s" << std::endl;
+
+    // 父进程不初始化 gRPC，接收方和每个发送方都是 fork 出来的独立进程
+    pid_t receiver = StartReceiver();
+    for (const char* transport : { "unary", "stream" }) {
+        WriteConfig(transport);
+        pid_t sender = fork();
+        if (sender == 0) {
+            RunSender(transport, messages, rate);
+        }
+        assert(WaitChild(sender) == 0);
+    }
+    StopReceiver(receiver);
+
+    std::cout << "\n========== Stream resume after receiver restart ==========" << std::endl;
+    WriteConfig("stream");
+    receiver = StartReceiver();
+    pid_t sender = fork();
+    if (sender == 0) {
+        RunResumeCheck(10000, 5000);
+    }
+    // 发送进行到一半时重启接收方
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    StopReceiver(receiver);
+    receiver = StartReceiver();
+    int rc = WaitChild(sender);
+    StopReceiver(receiver);
+    assert(rc == 0);
+
+    std::cout << "\n========== Legacy peer (no batch, no PeerStream) ==========" << std::endl;
+    receiver = StartReceiver(true);
+    for (const char* transport : { "unary", "stream" }) {
+        WriteConfig(transport);
+        sender = fork();
+        if (sender == 0) {
+            RunLegacyCheck(transport, 5000);
+        }
+        rc = WaitChild(sender);
+        assert(rc == 0);
+    }
+    StopReceiver(receiver);
+
+    std::cout << "\n========== Benchmark Complete ==========" << std::endl;
+    return rc;
+}
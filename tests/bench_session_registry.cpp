@@ -0,0 +1,157 @@
+// 在线会话表基准测试：单 mutex + unordered_map 对比 SessionRegistry（分片读写锁）
+// 1. Get / Set / Remove / RemoveIf 语义（重新登录后旧连接关闭不能删掉新会话）
+// 2. 1/2/4/8/16 个线程并发查询（混入少量登录 / 下线），统计每秒查询次数
+//
+// 编译：g++ -std=c++17 -O2 -pthread -I../ChatServer/ChatServer bench_session_registry.cpp -o bench_session_registry
+// 运行：./bench_session_registry [users] [ops_per_thread] [write_percent]
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "SessionRegistry.h"
+
+struct MockSession {
+    int uid;
+};
+
+// 原 UserMgr 的实现：一把 mutex 保护整张表
+class SingleMutexRegistry {
+public:
+    std::shared_ptr<MockSession> Get(int uid) {
+        std::lock_guard<std::mutex> lock(_mtx);
+        auto iter = _sessions.find(uid);
+        if (iter == _sessions.end()) {
+            return nullptr;
+        }
+        return iter->second;
+    }
+
+    void Set(int uid, std::shared_ptr<MockSession> session) {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _sessions[uid] = std::move(session);
+    }
+
+    void Remove(int uid) {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _sessions.erase(uid);
+    }
+
+private:
+    std::mutex _mtx;
+    std::unordered_map<int, std::shared_ptr<MockSession>> _sessions;
+};
+
+void TestSemantics() {
+    std::cout << "\n=== Test 1: Registry semantics ===" << std::endl;
+    SessionRegistry<MockSession> registry;
+    auto first = std::make_shared<MockSession>(MockSession{ 7 });
+    auto second = std::make_shared<MockSession>(MockSession{ 7 });
+
+    assert(registry.Get(7) == nullptr);
+    registry.Set(7, first);
+    assert(registry.Get(7) == first);
+
+    // 同一用户在新连接上重新登录，旧连接随后关闭：不能删掉新会话
+    registry.Set(7, second);
+    assert(!registry.RemoveIf(7, first.get()));
+    assert(registry.Get(7) == second);
+    assert(registry.RemoveIf(7, second.get()));
+    assert(registry.Get(7) == nullptr);
+
+    // 负数 uid 和跨分片的 uid 互不影响
+    for (int uid = -100; uid < 1000; ++uid) {
+        registry.Set(uid, std::make_shared<MockSession>(MockSession{ uid }));
+    }
+    assert(registry.Size() == 1100);
+    for (int uid = -100; uid < 1000; ++uid) {
+        assert(registry.Get(uid)->uid == uid);
+    }
+    registry.Remove(-100);
+    assert(registry.Size() == 1099);
+    registry.Clear();
+    assert(registry.Size() == 0);
+    std::cout << "✓ Test 1 passed" << std::endl;
+}
+
+template<typename Registry>
+double RunLookups(Registry& registry, int threads, int users, int ops_per_thread, int write_percent) {
+    for (int uid = 0; uid < users; ++uid) {
+        registry.Set(uid, std::make_shared<MockSession>(MockSession{ uid }));
+    }
+
+    std::vector<std::thread> workers;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            std::mt19937 rng(static_cast<unsigned int>(t + 1));
+            std::uniform_int_distribution<int> pick_uid(0, users - 1);
+            std::uniform_int_distribution<int> pick_op(0, 99);
+            std::size_t found = 0;
+            for (int i = 0; i < ops_per_thread; ++i) {
+                int uid = pick_uid(rng);
+                if (pick_op(rng) < write_percent) {
+                    // 下线后立即重新登录，表的大小保持不变
+                    registry.Remove(uid);
+                    registry.Set(uid, std::make_shared<MockSession>(MockSession{ uid }));
+                }
+                else if (registry.Get(uid)) {
+                    ++found;
+                }
+            }
+            assert(found > 0);
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return threads * static_cast<double>(ops_per_thread) / seconds;
+}
+
+void TestThroughput(int users, int ops_per_thread, int write_percent) {
+    std::cout << "\n=== Test 2: Lookup throughput vs threads (users=" << users
+              << ", writes=" << write_percent << "%) ===" << std::endl;
+    double single_at_max = 0;
+    double sharded_at_max = 0;
+    for (int threads : { 1, 2, 4, 8, 16 }) {
+        SingleMutexRegistry single;
+        SessionRegistry<MockSession> sharded;
+        double single_ops = RunLookups(single, threads, users, ops_per_thread, write_percent);
+        double sharded_ops = RunLookups(sharded, threads, users, ops_per_thread, write_percent);
+        std::cout << "threads=" << threads
+                  << " single_mutex=" << static_cast<long long>(single_ops) << " ops/sec"
+                  << " sharded=" << static_cast<long long>(sharded_ops) << " ops/sec"
+                  << " (" << sharded_ops / single_ops << "x)" << std::endl;
+        single_at_max = single_ops;
+        sharded_at_max = sharded_ops;
+    }
+    std::cout << "hardware threads=" << std::thread::hardware_concurrency() << std::endl;
+    // 多核机器上 16 线程时分片表应明显领先；单核机器上两者接近，不做断言
+    if (std::thread::hardware_concurrency() >= 4) {
+        assert(sharded_at_max > single_at_max);
+    }
+    std::cout << "✓ Test 2 passed" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int users = argc > 1 ? std::stoi(argv[1]) : 100000;
+    int ops_per_thread = argc > 2 ? std::stoi(argv[2]) : 1000000;
+    int write_percent = argc > 3 ? std::stoi(argv[3]) : 2;
+
+    std::cout << "========== SessionRegistry Benchmark ==========" << std::endl;
+
+    TestSemantics();
+    TestThroughput(users, ops_per_thread, write_percent);
+
+    std::cout << "\n========== All Tests Passed! ==========" << std::endl;
+    return 0;
+}
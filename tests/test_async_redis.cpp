@@ -0,0 +1,297 @@
+// 异步 Redis 客户端测试
+// 1. RESP 编码 / 增量解析（半包、粘包、畸形数据）
+// 2. 对本地模拟的 Redis 服务端做多线程 pipeline：回调一一对应、同一线程内按序，
+//    并统计服务端每次读到的命令数（>1 说明命令被合并写出）
+// 3. 服务端断开时未完成命令以错误回调，断线期间新命令快速失败，之后自动重连
+//
+// 编译（以下为同一条命令）：
+//   g++ -std=c++17 -O2 -pthread -I../ChatServer/ChatServer test_async_redis.cpp
+//       ../ChatServer/ChatServer/AsyncRedisConnection.cpp ../ChatServer/ChatServer/Logger.cpp -o test_async_redis
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+
+#include "AsyncRedisConnection.h"
+
+using boost::asio::ip::tcp;
+
+// 模拟 Redis：对每条命令回复其最后一个参数（bulk string），PING 回复 +PONG
+class FakeRedisServer {
+public:
+    FakeRedisServer() : _acceptor(_io, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)) {
+        _thread = std::thread([this]() { Serve(); });
+    }
+
+    // 阻塞中的 accept 不会因为另一个线程 close 而返回，用一次空连接把它唤醒
+    ~FakeRedisServer() {
+        _stop = true;
+        boost::asio::io_context io;
+        tcp::socket wake(io);
+        boost::system::error_code ignored;
+        wake.connect(_acceptor.local_endpoint(), ignored);
+        wake.close(ignored);
+        _thread.join();
+    }
+
+    unsigned short Port() const { return _acceptor.local_endpoint().port(); }
+
+    // 让服务端在处理完第 n 条命令后断开当前连接（不回复该命令）
+    void DropAfter(uint64_t n) { _drop_after = n; }
+
+    uint64_t Commands() const { return _commands; }
+    uint64_t Reads() const { return _reads; }
+
+private:
+    void Serve() {
+        while (!_stop) {
+            tcp::socket socket(_io);
+            boost::system::error_code ec;
+            _acceptor.accept(socket, ec);
+            if (ec) {
+                return;
+            }
+            RespParser parser;
+            char buf[16 * 1024];
+            for (;;) {
+                size_t n = socket.read_some(boost::asio::buffer(buf), ec);
+                if (ec) {
+                    break;
+                }
+                ++_reads;
+                parser.Feed(buf, n);
+                std::string out;
+                RedisValue cmd;
+                bool drop = false;
+                while (parser.Next(cmd) == RespParser::Result::Ok) {
+                    ++_commands;
+                    if (_drop_after != 0 && _commands >= _drop_after) {
+                        _drop_after = 0;
+                        drop = true;
+                        break;
+                    }
+                    if (cmd.elements[0].str == "PING") {
+                        out += "+PONG\r\n";
+                        continue;
+                    }
+                    const std::string& last = cmd.elements.back().str;
+                    out += "$" + std::to_string(last.size()) + "\r\n" + last + "\r\n";
+                }
+                if (!out.empty()) {
+                    boost::asio::write(socket, boost::asio::buffer(out), ec);
+                }
+                if (drop || ec) {
+                    break;
+                }
+            }
+            socket.close(ec);
+        }
+    }
+
+    boost::asio::io_context _io;
+    tcp::acceptor _acceptor;
+    std::thread _thread;
+    std::atomic<bool> _stop{ false };
+    std::atomic<uint64_t> _drop_after{ 0 };
+    std::atomic<uint64_t> _commands{ 0 };
+    std::atomic<uint64_t> _reads{ 0 };
+};
+
+// 客户端 io_context 及其线程
+struct ClientLoop {
+    boost::asio::io_context io;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work{ io.get_executor() };
+    std::thread thread{ [this]() { io.run(); } };
+
+    // 连接 Close 之后 socket 上不再有异步操作，run() 自然返回
+    ~ClientLoop() {
+        work.reset();
+        thread.join();
+    }
+};
+
+void WaitUntil(const std::function<bool()>& pred, int timeout_ms = 5000) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (!pred()) {
+        assert(std::chrono::steady_clock::now() < deadline);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void TestEncode() {
+    std::cout << "\n=== Test 1: RESP encode ===" << std::endl;
+    std::string out;
+    RespAppendCommand(out, std::vector<std::string>{ "SET", "k", "a b" });
+    assert(out == "*3\r\n$3\r\nSET\r\n$1\r\nk\r\n$3\r\na b\r\n");
+
+    // 二进制安全：参数中的 \r\n 和 \0 原样发送
+    out.clear();
+    std::string binary("x\r\n\0y", 5);
+    RespAppendCommand(out, std::vector<std::string>{ "GET", binary });
+    assert(out == std::string("*2\r\n$3\r\nGET\r\n$5\r\nx\r\n\0y\r\n", 24));
+    std::cout << "✓ Test 1 passed" << std::endl;
+}
+
+void TestIncrementalParse() {
+    std::cout << "\n=== Test 2: RESP incremental parse ===" << std::endl;
+    const std::string stream = "+OK\r\n:42\r\n$5\r\nhello\r\n$-1\r\n*2\r\n$1\r\na\r\n:1\r\n-ERR bad\r\n$0\r\n\r\n";
+
+    // 逐字节喂入，模拟最极端的半包
+    RespParser parser;
+    std::vector<RedisValue> values;
+    for (char c : stream) {
+        parser.Feed(&c, 1);
+        RedisValue value;
+        while (parser.Next(value) == RespParser::Result::Ok) {
+            values.push_back(value);
+        }
+    }
+    assert(values.size() == 7);
+    assert(values[0].IsOk());
+    assert(values[1].IsInteger() && values[1].integer == 42);
+    assert(values[2].IsString() && values[2].str == "hello");
+    assert(values[3].IsNil());
+    assert(values[4].type == RedisValue::Type::Array && values[4].elements.size() == 2);
+    assert(values[4].elements[0].str == "a" && values[4].elements[1].integer == 1);
+    assert(values[5].IsError() && values[5].str == "ERR bad");
+    assert(values[6].IsString() && values[6].str.empty());
+    assert(parser.Buffered() == 0);
+
+    // 一次喂入（粘包）结果相同
+    RespParser whole;
+    whole.Feed(stream.data(), stream.size());
+    RedisValue value;
+    int count = 0;
+    while (whole.Next(value) == RespParser::Result::Ok) {
+        ++count;
+    }
+    assert(count == 7);
+
+    // 畸形数据
+    RespParser bad;
+    bad.Feed("?x\r\n", 4);
+    assert(bad.Next(value) == RespParser::Result::Error);
+    // 声明了巨大元素个数但数据不足：等待更多数据，而不是按声明的个数分配
+    RespParser huge;
+    huge.Feed("*1000000000\r\n", 13);
+    assert(huge.Next(value) == RespParser::Result::NeedMore);
+    std::cout << "✓ Test 2 passed" << std::endl;
+}
+
+void TestPipeline() {
+    std::cout << "\n=== Test 3: Pipelined commands from multiple threads ===" << std::endl;
+    FakeRedisServer server;
+    ClientLoop loop;
+    auto conn = std::make_shared<AsyncRedisConnection>(loop.io, "127.0.0.1", server.Port(), "");
+    conn->Start();
+
+    const int threads = 4;
+    const int per_thread = 20000;
+    std::atomic<int> done(0);
+    std::atomic<bool> ok(true);
+    std::vector<int> next_expected(threads, 0);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t) {
+        producers.emplace_back([&, t]() {
+            for (int i = 0; i < per_thread; ++i) {
+                std::string value = std::to_string(t) + ":" + std::to_string(i);
+                conn->Submit({ "SET", "key", value }, [&, t, i, value](RedisValue reply) {
+                    // 回调全部在 IO 线程上执行，同一生产者线程的命令按提交顺序回复
+                    if (!reply.IsString() || reply.str != value || next_expected[t] != i) {
+                        ok = false;
+                    }
+                    next_expected[t] = i + 1;
+                    done.fetch_add(1);
+                });
+            }
+        });
+    }
+    for (auto& p : producers) {
+        p.join();
+    }
+    WaitUntil([&]() { return done.load() == threads * per_thread; });
+    auto end = std::chrono::high_resolution_clock::now();
+
+    assert(ok);
+    assert(conn->Pending() == 0);
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    std::cout << "commands=" << threads * per_thread << " elapsed=" << ms << " ms"
+              << " throughput=" << static_cast<long long>(threads * per_thread / (ms / 1000.0)) << " cmds/sec" << std::endl;
+    std::cout << "server reads=" << server.Reads() << " commands/read="
+              << static_cast<double>(server.Commands()) / server.Reads() << std::endl;
+    assert(server.Commands() > server.Reads());
+
+    conn->Close();
+    std::cout << "✓ Test 3 passed" << std::endl;
+}
+
+void TestConnectionLoss() {
+    std::cout << "\n=== Test 4: Connection loss and reconnect ===" << std::endl;
+    FakeRedisServer server;
+    ClientLoop loop;
+    auto conn = std::make_shared<AsyncRedisConnection>(loop.io, "127.0.0.1", server.Port(), "");
+    conn->Start();
+
+    // 先确认连接可用
+    std::promise<RedisValue> first;
+    conn->Submit({ "PING" }, [&](RedisValue reply) { first.set_value(reply); });
+    assert(first.get_future().get().str == "PONG");
+
+    // 服务端在第 3 条命令处断开：第 2 条成功，第 3 条起全部以错误回调
+    server.DropAfter(3);
+    std::atomic<int> succeeded(0);
+    std::atomic<int> failed(0);
+    for (int i = 0; i < 10; ++i) {
+        conn->Submit({ "GET", std::to_string(i) }, [&](RedisValue reply) {
+            if (reply.IsError()) {
+                failed.fetch_add(1);
+            }
+            else {
+                succeeded.fetch_add(1);
+            }
+        });
+    }
+    WaitUntil([&]() { return succeeded.load() + failed.load() == 10; });
+    std::cout << "before drop succeeded=" << succeeded.load() << " failed=" << failed.load() << std::endl;
+    assert(failed.load() >= 8);
+
+    // 断线重连期间，新命令立即以错误回调，不会挂起调用方
+    std::promise<RedisValue> fast;
+    conn->Submit({ "PING" }, [&](RedisValue reply) { fast.set_value(reply); });
+    assert(fast.get_future().get().IsError());
+
+    // ASYNC_REDIS_RECONNECT_MS 后重连成功
+    WaitUntil([&]() {
+        std::promise<RedisValue> probe;
+        auto future = probe.get_future();
+        conn->Submit({ "PING" }, [&](RedisValue reply) { probe.set_value(reply); });
+        bool pong = future.get().str == "PONG";
+        if (!pong) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        return pong;
+    });
+
+    conn->Close();
+    std::cout << "✓ Test 4 passed" << std::endl;
+}
+
+int main() {
+    std::cout << "========== AsyncRedis Tests ==========" << std::endl;
+
+    TestEncode();
+    TestIncrementalParse();
+    TestPipeline();
+    TestConnectionLoss();
+
+    std::cout << "\n========== All Tests Passed! ==========" << std::endl;
+    return 0;
+}
@@ -0,0 +1,114 @@
+// 消息 ID 生成器测试（MsgIdGenerator）
+// 1. 字段拆解：时间戳、服务器编号、序号，ID 不超过 53 位
+// 2. 单线程连续取号严格递增，同一毫秒超过 128 个时借用下一毫秒
+// 3. 多线程并发取号不重复，每个线程看到的 ID 严格递增
+// 4. 不同服务器编号的 ID 不会相同
+//
+// 编译：g++ -std=c++17 -O2 -pthread -I../ChatServer/ChatServer test_msg_id_generator.cpp -o test_msg_id_generator
+
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "MsgIdGenerator.h"
+
+int64_t NowUnixMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+void TestLayout() {
+    std::cout << "\n=== Test 1: ID layout ===" << std::endl;
+    MsgIdGenerator gen(7);
+    int64_t before = NowUnixMs();
+    int64_t id = gen.Next();
+    int64_t after = NowUnixMs();
+
+    assert(id > 0 && id < (1LL << 53));
+    assert(MsgIdGenerator::Worker(id) == 7);
+    assert(MsgIdGenerator::UnixMs(id) >= before && MsgIdGenerator::UnixMs(id) <= after);
+
+    // 编号超出 5 位时截断
+    MsgIdGenerator wide(33);
+    assert(wide.WorkerId() == 1);
+    std::cout << "id=" << id << " unix_ms=" << MsgIdGenerator::UnixMs(id) << std::endl;
+    std::cout << "✓ Test 1 passed" << std::endl;
+}
+
+void TestMonotonicBurst() {
+    std::cout << "\n=== Test 2: Monotonic under burst ===" << std::endl;
+    MsgIdGenerator gen(1);
+    const int kCount = 100000;
+    int64_t prev = 0;
+    int borrowed = 0;
+    for (int i = 0; i < kCount; ++i) {
+        int64_t id = gen.Next();
+        assert(id > prev);
+        if (prev != 0 && MsgIdGenerator::UnixMs(id) > MsgIdGenerator::UnixMs(prev)
+            && MsgIdGenerator::Sequence(id) == 0 && MsgIdGenerator::Sequence(prev) == MsgIdGenerator::kSeqMask) {
+            ++borrowed;
+        }
+        prev = id;
+    }
+    std::cout << "ids=" << kCount << " seq_overflows=" << borrowed << " ahead_ms=" << gen.AheadMs() << std::endl;
+    // 逻辑时钟最多超前 kCount / 128 毫秒，墙上时钟追上后恢复为 0
+    assert(gen.AheadMs() <= kCount / 128 + 1);
+    std::cout << "✓ Test 2 passed" << std::endl;
+}
+
+void TestConcurrent() {
+    std::cout << "\n=== Test 3: Concurrent unique ===" << std::endl;
+    MsgIdGenerator gen(3);
+    const int kThreads = 8;
+    const int kPerThread = 50000;
+    std::vector<std::vector<int64_t>> results(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&gen, &results, t]() {
+            results[t].reserve(kPerThread);
+            for (int i = 0; i < kPerThread; ++i) {
+                results[t].push_back(gen.Next());
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    std::unordered_set<int64_t> all;
+    for (const auto& ids : results) {
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            assert(i == 0 || ids[i] > ids[i - 1]);
+            assert(all.insert(ids[i]).second);
+        }
+    }
+    assert(all.size() == static_cast<std::size_t>(kThreads * kPerThread));
+    std::cout << "✓ Test 3 passed" << std::endl;
+}
+
+void TestWorkers() {
+    std::cout << "\n=== Test 4: Distinct workers never collide ===" << std::endl;
+    MsgIdGenerator a(1);
+    MsgIdGenerator b(2);
+    std::unordered_set<int64_t> all;
+    for (int i = 0; i < 10000; ++i) {
+        assert(all.insert(a.Next()).second);
+        assert(all.insert(b.Next()).second);
+    }
+    std::cout << "✓ Test 4 passed" << std::endl;
+}
+
+int main() {
+    std::cout << "========== MsgIdGenerator Test ==========" << std::endl;
+
+    TestLayout();
+    TestMonotonicBurst();
+    TestConcurrent();
+    TestWorkers();
+
+    std::cout << "\n========== All Tests Passed! ==========" << std::endl;
+    return 0;
+}
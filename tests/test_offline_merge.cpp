@@ -0,0 +1,91 @@
+// 离线消息两层合并测试（OfflineMerger / OfflineFrameEnds，不需要 Redis 和 MySQL）
+// 1. 数据库分页与收件箱按内容去重，重复的收件箱条目只在匹配时报告一次
+// 2. 同内容的多条消息逐条匹配，多出来的留作补发，补发按写入顺序
+// 3. 切帧：按编码后的帧长切，每帧至少一条；单条超过一帧时截到它之前
+//
+// 编译：g++ -std=c++17 -O2 -I../ChatServer/ChatServer test_offline_merge.cpp -o test_offline_merge
+
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "OfflineSync.h"
+
+InboxEntry Entry(const std::string& id, const std::string& payload) {
+    InboxEntry entry;
+    entry.id = id;
+    entry.payload = payload;
+    return entry;
+}
+
+void TestDedupAcrossPages() {
+    std::cout << "\n=== Test 1: Dedup across db pages ===" << std::endl;
+    OfflineMerger merger({ Entry("1-0", "a"), Entry("2-0", "b"), Entry("3-0", "c"), Entry("4-0", "d") });
+    assert(merger.InboxSize() == 4);
+
+    assert(merger.MatchDbPage({ "x", "a", "y" }) == 1);
+    std::vector<std::string> ids = merger.TakeMatchedIds();
+    assert(ids.size() == 1 && ids[0] == "1-0");
+    assert(merger.TakeMatchedIds().empty());
+
+    assert(merger.MatchDbPage({ "c", "b" }) == 2);
+    ids = merger.TakeMatchedIds();
+    assert(ids.size() == 2 && ids[0] == "3-0" && ids[1] == "2-0");
+
+    // 已匹配的不会再匹配
+    assert(merger.MatchDbPage({ "a", "b" }) == 0);
+    assert(merger.MatchedCount() == 3);
+
+    std::vector<InboxEntry> leftovers = merger.TakeLeftovers();
+    assert(leftovers.size() == 1 && leftovers[0].id == "4-0" && leftovers[0].payload == "d");
+    std::cout << "✓ Test 1 passed" << std::endl;
+}
+
+void TestRepeatedPayloads() {
+    std::cout << "\n=== Test 2: Same payload stored several times ===" << std::endl;
+    OfflineMerger merger({ Entry("1-0", "dup"), Entry("1-1", "z"), Entry("2-0", "dup"), Entry("3-0", "dup") });
+    // 库里只有两条 "dup"：按写入顺序消耗前两条，第三条留作补发
+    assert(merger.MatchDbPage({ "dup", "dup" }) == 2);
+    std::vector<std::string> ids = merger.TakeMatchedIds();
+    assert(ids.size() == 2 && ids[0] == "1-0" && ids[1] == "2-0");
+
+    std::vector<InboxEntry> leftovers = merger.TakeLeftovers();
+    assert(leftovers.size() == 2);
+    assert(leftovers[0].id == "1-1" && leftovers[1].id == "3-0");
+
+    // 空收件箱
+    OfflineMerger empty({});
+    assert(empty.MatchDbPage({ "a" }) == 0 && empty.TakeLeftovers().empty());
+    std::cout << "✓ Test 2 passed" << std::endl;
+}
+
+void TestFrameEnds() {
+    std::cout << "\n=== Test 3: Frame split by encoded size ===" << std::endl;
+    assert(OfflineFrameEnds({}).empty());
+
+    // 每条按 1000 + 1（逗号）计，每帧最多 OFFLINE_BATCH_BYTES（4096 - 128）字节：3 + 3 + 3 + 1
+    std::vector<std::string> payloads(10, std::string(1000, 'x'));
+    std::vector<std::size_t> ends = OfflineFrameEnds(payloads);
+    assert((ends == std::vector<std::size_t>{ 3, 6, 9, 10 }));
+
+    // 刚好放满一帧的单条可以发，再多一个字节就放不下，下发截到它之前（后面的也不发）
+    payloads = { "a", std::string(OFFLINE_BATCH_BYTES - 1, 'y'), std::string(OFFLINE_BATCH_BYTES, 'z'), "b" };
+    assert(FirstOversizedOffline(payloads) == 2);
+    payloads.resize(2);
+    assert(FirstOversizedOffline(payloads) == payloads.size());
+    ends = OfflineFrameEnds(payloads);
+    assert((ends == std::vector<std::size_t>{ 1, 2 }));
+    std::cout << "✓ Test 3 passed" << std::endl;
+}
+
+int main() {
+    std::cout << "========== Offline Merge Test ==========" << std::endl;
+
+    TestDedupAcrossPages();
+    TestRepeatedPayloads();
+    TestFrameEnds();
+
+    std::cout << "\n========== All Tests Passed! ==========" << std::endl;
+    return 0;
+}
@@ -0,0 +1,112 @@
+// SessionSlab 测试
+// 1. 句柄插入 / 查找 / 删除，槽位复用后旧句柄失效，重复删除不生效
+// 2. 模拟 accept + ClearSession：对比原来的 UUID 字符串 map 与 SessionSlab 的每次连接耗时
+//
+// 编译：g++ -std=c++17 -O2 -I../ChatServer/ChatServer test_session_slab.cpp -o test_session_slab
+// 运行：./test_session_slab [connections]
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <boost/uuid/uuid_io.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+
+#include "SessionSlab.h"
+
+struct MockSession {
+    int id;
+};
+
+void TestHandles() {
+    std::cout << "\n=== Test 1: Handles and slot reuse ===" << std::endl;
+    SessionSlab<MockSession> slab;
+    auto a = std::make_shared<MockSession>(MockSession{ 1 });
+    auto b = std::make_shared<MockSession>(MockSession{ 2 });
+
+    SessionHandle ha = slab.Insert(a);
+    SessionHandle hb = slab.Insert(b);
+    assert(ha != INVALID_SESSION_HANDLE && hb != INVALID_SESSION_HANDLE && ha != hb);
+    assert(slab.Get(ha) == a && slab.Get(hb) == b);
+    assert(slab.Size() == 2);
+    assert(slab.Get(INVALID_SESSION_HANDLE) == nullptr);
+
+    // 删除后返回被删除的会话，再删一次不生效（读写两端同时出错的情况）
+    assert(slab.Remove(ha) == a);
+    assert(slab.Remove(ha) == nullptr);
+    assert(slab.Get(ha) == nullptr);
+    assert(slab.Size() == 1);
+
+    // 槽位被新会话复用：下标相同、代数不同，旧句柄既查不到也删不掉新会话
+    auto c = std::make_shared<MockSession>(MockSession{ 3 });
+    SessionHandle hc = slab.Insert(c);
+    assert(SessionSlab<MockSession>::SlotIndex(hc) == SessionSlab<MockSession>::SlotIndex(ha));
+    assert(hc != ha);
+    assert(slab.Get(ha) == nullptr);
+    assert(slab.Remove(ha) == nullptr);
+    assert(slab.Get(hc) == c);
+    assert(slab.Capacity() == 2);
+    std::cout << "✓ Test 1 passed" << std::endl;
+}
+
+void TestAcceptChurn(int connections) {
+    std::cout << "\n=== Test 2: Accept + ClearSession churn (" << connections << " connections) ===" << std::endl;
+    const int live = 1000;
+    std::vector<std::shared_ptr<MockSession>> sessions;
+    for (int i = 0; i < live; ++i) {
+        sessions.push_back(std::make_shared<MockSession>(MockSession{ i }));
+    }
+
+    // 原实现：每个连接构造一次 random_generator 生成 UUID，以字符串为键放入 map
+    std::map<std::string, std::shared_ptr<MockSession>> by_uuid;
+    std::vector<std::string> ids(live);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < connections; ++i) {
+        int slot = i % live;
+        if (!ids[slot].empty()) {
+            by_uuid.erase(ids[slot]);
+        }
+        ids[slot] = boost::uuids::to_string(boost::uuids::random_generator()());
+        by_uuid.insert(std::make_pair(ids[slot], sessions[slot]));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double uuid_ns = std::chrono::duration<double, std::nano>(end - start).count() / connections;
+
+    SessionSlab<MockSession> slab;
+    std::vector<SessionHandle> handles(live, INVALID_SESSION_HANDLE);
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < connections; ++i) {
+        int slot = i % live;
+        if (handles[slot] != INVALID_SESSION_HANDLE) {
+            slab.Remove(handles[slot]);
+        }
+        handles[slot] = slab.Insert(sessions[slot]);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double slab_ns = std::chrono::duration<double, std::nano>(end - start).count() / connections;
+
+    assert(by_uuid.size() == static_cast<std::size_t>(live));
+    assert(slab.Size() == static_cast<std::size_t>(live));
+    // 槽位全部复用，不随连接数增长
+    assert(slab.Capacity() == static_cast<std::size_t>(live));
+
+    std::cout << "uuid map: " << uuid_ns << " ns/connection" << std::endl;
+    std::cout << "slab:     " << slab_ns << " ns/connection (" << uuid_ns / slab_ns << "x)" << std::endl;
+    assert(slab_ns < uuid_ns);
+    std::cout << "✓ Test 2 passed" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int connections = argc > 1 ? std::stoi(argv[1]) : 200000;
+
+    std::cout << "========== SessionSlab Tests ==========" << std::endl;
+
+    TestHandles();
+    TestAcceptChurn(connections);
+
+    std::cout << "\n========== All Tests Passed! ==========" << std::endl;
+    return 0;
+}